@@ -0,0 +1,1967 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <dirent.h>
+
+#include "voxelize.h"
+
+/* Bench - Headless Timing Helpers */
+f64 VOX__bench__seconds() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (f64)time.tv_sec + ((f64)time.tv_nsec / 1000000000.0);
+}
+
+/* Bench - Latency Distributions & Allocation Counts */
+// nearest rank on sorted nanosecond samples, percentile is in [0, 100]
+u64 VOX__read__bench_percentile(u64* sorted_samples, u64 sample_count, f64 percentile) {
+    return sorted_samples[(u64)((percentile / 100.0) * (f64)(sample_count - 1) + 0.5)];
+}
+
+void VOX__print__bench_latency(VOX__buffer samples, u64 sample_count) {
+    u64* times;
+
+    // nothing sampled
+    if (sample_count == 0) {
+        return;
+    }
+
+    // sort samples
+    times = (u64*)samples.p_data;
+    qsort(times, sample_count, sizeof(u64), VOX__compare__u64);
+
+    // report in microseconds
+    printf("\tlatency: min %.3f us, p50 %.3f us, p90 %.3f us, p99 %.3f us, max %.3f us\n", (f64)times[0] / 1000.0, (f64)VOX__read__bench_percentile(times, sample_count, 50.0) / 1000.0, (f64)VOX__read__bench_percentile(times, sample_count, 90.0) / 1000.0, (f64)VOX__read__bench_percentile(times, sample_count, 99.0) / 1000.0, (f64)times[sample_count - 1] / 1000.0);
+
+    return;
+}
+
+void VOX__print__bench_allocations(VOX__allocation_statistics before, u64 operation_count) {
+    VOX__allocation_statistics difference;
+
+    // counts since before
+    difference = VOX__calculate__allocation_statistics_difference(before, VOX__read__allocation_statistics());
+
+    // report per operation
+    printf("\tallocations: %lu (%.2f per op), frees: %lu, bytes: %lu (%.1f per op), still live: %ld\n", difference.p_allocation_count, (f64)difference.p_allocation_count / (f64)operation_count, difference.p_deallocation_count, difference.p_allocated_byte_count, (f64)difference.p_allocated_byte_count / (f64)operation_count, (s64)difference.p_live_byte_count);
+
+    return;
+}
+
+/* Bench - Terrain Noise Kernels, Checked Bit For Bit Against The Scalar Path */
+void VOX__bench__terrain_noise(u64 sample_count, u64 seed) {
+    char* names[] = { "scalar", "sse2", "avx2" };
+    VOX__buffer positions;
+    VOX__buffer results;
+    f32* xs;
+    f32* ys;
+    f32* zs;
+    f32* scalar_outputs[2];
+    f32* output;
+    u64 random;
+    u64 kernel_count;
+    u64 mismatch_count;
+    f64 start;
+    f64 seconds[2];
+
+    // setup random block positions over a wide area
+    positions = VOX__create__buffer(sizeof(f32) * sample_count * 3);
+    results = VOX__create__buffer(sizeof(f32) * sample_count * 3);
+    xs = (f32*)positions.p_data;
+    ys = xs + sample_count;
+    zs = ys + sample_count;
+    scalar_outputs[0] = (f32*)results.p_data;
+    scalar_outputs[1] = scalar_outputs[0] + sample_count;
+    output = scalar_outputs[1] + sample_count;
+    random = seed;
+    for (u64 i = 0; i < sample_count * 3; i++) {
+        random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+        xs[i] = (f32)((s64)((random >> 33) % 65536) - 32768);
+    }
+
+    // kernels this processor runs
+    kernel_count = 1;
+#if defined(__SSE2__)
+    kernel_count = (VOX__read__noise_kernel() == VOX__nkt__avx2) ? 3 : 2;
+#endif
+
+    for (u64 kernel = 0; kernel < kernel_count; kernel++) {
+        // 2d heights, 5 octaves
+        start = VOX__bench__seconds();
+        switch (kernel) {
+#if defined(__SSE2__)
+        case 2:
+            VOX__calculate__fractal_noise_2D__avx2(xs, zs, sample_count, 1.0f / 96.0f, 5, (u32)seed, output);
+            break;
+        case 1:
+            VOX__calculate__fractal_noise_2D__sse2(xs, zs, sample_count, 1.0f / 96.0f, 5, (u32)seed, output);
+            break;
+#endif
+        default:
+            VOX__calculate__fractal_noise_2D__scalar(xs, zs, sample_count, 1.0f / 96.0f, 5, (u32)seed, scalar_outputs[0]);
+            break;
+        }
+        seconds[0] = VOX__bench__seconds() - start;
+        mismatch_count = (kernel == 0) ? 0 : (VOX__check__bytes_are_equal(scalar_outputs[0], output, sizeof(f32) * sample_count) == VOX__bt__false);
+
+        printf("terrain noise 2d (%s, 5 octaves): %.1f M samples/s, %.1f ns per sample%s\n", names[kernel], (f64)sample_count / seconds[0] / 1000000.0, seconds[0] * 1000000000.0 / (f64)sample_count, (mismatch_count == 0) ? "" : ", DIFFERS FROM SCALAR");
+
+        // 3d caves, 2 octaves
+        start = VOX__bench__seconds();
+        switch (kernel) {
+#if defined(__SSE2__)
+        case 2:
+            VOX__calculate__fractal_noise_3D__avx2(xs, ys, zs, sample_count, 1.0f / 24.0f, 2, (u32)seed, output);
+            break;
+        case 1:
+            VOX__calculate__fractal_noise_3D__sse2(xs, ys, zs, sample_count, 1.0f / 24.0f, 2, (u32)seed, output);
+            break;
+#endif
+        default:
+            VOX__calculate__fractal_noise_3D__scalar(xs, ys, zs, sample_count, 1.0f / 24.0f, 2, (u32)seed, scalar_outputs[1]);
+            break;
+        }
+        seconds[1] = VOX__bench__seconds() - start;
+        mismatch_count = (kernel == 0) ? 0 : (VOX__check__bytes_are_equal(scalar_outputs[1], output, sizeof(f32) * sample_count) == VOX__bt__false);
+
+        printf("terrain noise 3d (%s, 2 octaves): %.1f M samples/s, %.1f ns per sample%s\n", names[kernel], (f64)sample_count / seconds[1] / 1000000.0, seconds[1] * 1000000000.0 / (f64)sample_count, (mismatch_count == 0) ? "" : ", DIFFERS FROM SCALAR");
+    }
+
+    // clean up
+    VOX__destroy__buffer(positions);
+    VOX__destroy__buffer(results);
+
+    return;
+}
+
+/* Bench - Chunk Fill From The Terrain Generator */
+void VOX__bench__chunk_fill(u64 chunk_count, u64 seed) {
+    VOX__buffer samples;
+    VOX__allocation_statistics before;
+    VOX__chunk chunk;
+    u64 sample_start;
+    u64 non_air_count;
+    f64 start;
+    f64 seconds;
+
+    // setup
+    samples = VOX__create__buffer(sizeof(u64) * chunk_count);
+    non_air_count = 0;
+    before = VOX__read__allocation_statistics();
+
+    // generate a slab of chunks around the surface
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < chunk_count; i++) {
+        sample_start = VOX__calculate__nanoseconds();
+        chunk = VOX__create__chunk__generated(VOX__create__chunk_position(i % 64, -1 - (s32)(i % 2), i / 64), seed);
+        ((u64*)samples.p_data)[i] = VOX__calculate__nanoseconds() - sample_start;
+
+        non_air_count += chunk.p_palette_count > 1 || ((VOX__block_ID*)chunk.p_palette.p_data)[0] != VOX__bit__air;
+        VOX__destroy__chunk(chunk);
+    }
+    seconds = VOX__bench__seconds() - start;
+
+    // report
+    printf("chunk fill: %lu chunks in %.3f s (%.1f chunks/s, %lu not all air)\n", chunk_count, seconds, (f64)chunk_count / seconds, non_air_count);
+    VOX__print__bench_latency(samples, chunk_count);
+    VOX__print__bench_allocations(before, chunk_count);
+
+    // clean up
+    VOX__destroy__buffer(samples);
+
+    return;
+}
+
+/* Bench - World Streaming Along A Camera Path */
+// chunk_io may be 0 to generate chunks inside the update
+void VOX__bench__world_streaming(u64 step_count, f32 speed, u64 seed, VOX__chunk_io* chunk_io) {
+    VOX__world world;
+    VOX__camera camera;
+    VOX__buffer samples;
+    VOX__allocation_statistics before;
+    u64 maximum_resident;
+    u64 stale_count;
+    u64 sample_start;
+    f64 start;
+    f64 seconds;
+
+    // setup world and camera
+    world = VOX__create__world(6, 2, 0, 16, seed, chunk_io);
+    camera = VOX__create__camera();
+    samples = VOX__create__buffer(sizeof(u64) * step_count);
+    maximum_resident = 0;
+    stale_count = 0;
+    before = VOX__read__allocation_statistics();
+
+    // fly forward while weaving side to side
+    start = VOX__bench__seconds();
+    for (u64 step = 0; step < step_count; step++) {
+        camera = VOX__move__camera(camera, VOX__create__3D_position(speed * sinf((f32)step * 0.01f), 0.0f, speed), VOX__create__3D_position(0.0f, 0.0f, 0.0f));
+        sample_start = VOX__calculate__nanoseconds();
+        VOX__update__world(&world, camera, 0);
+        ((u64*)samples.p_data)[step] = VOX__calculate__nanoseconds() - sample_start;
+
+        if (world.p_chunk_count > maximum_resident) {
+            maximum_resident = world.p_chunk_count;
+        }
+
+        // no chunk outside the unload radius survives an update
+        for (u64 i = 0; i < world.p_slot_count; i++) {
+            stale_count += ((VOX__world_slot*)world.p_slots.p_data)[i].p_occupied == VOX__bt__true && VOX__check__chunk_position_is_within_radius(world.p_center, ((VOX__world_slot*)world.p_slots.p_data)[i].p_position, world.p_load_radius + 1, world.p_load_height_radius + 1) == VOX__bt__false;
+        }
+    }
+    seconds = VOX__bench__seconds() - start;
+
+    // let background loads for the final position land so resident numbers are comparable
+    while (chunk_io != 0 && VOX__calculate__world_loading_count(&world) > 0) {
+        VOX__update__world(&world, camera, 0);
+        sched_yield();
+    }
+
+    // report
+    printf("world streaming%s: %lu steps in %.3f s (%.1f steps/s)\n", (chunk_io != 0) ? " (chunk io)" : "", step_count, seconds, (f64)step_count / seconds);
+    printf("\tloads: %lu, unloads: %lu, churn: %.1f chunks/s\n", world.p_total_loads, world.p_total_unloads, (f64)(world.p_total_loads + world.p_total_unloads) / seconds);
+    printf("\tresident chunks: %lu (peak %lu, bound %lu, %lu left out of range)\n", world.p_chunk_count, maximum_resident, world.p_maximum_chunk_count, stale_count);
+    printf("\tresident block memory: %lu bytes (%lu bytes unpacked)\n", VOX__calculate__world_block_memory_size(&world), world.p_chunk_count * sizeof(VOX__block_ID) * VOX__dt__chunk_block_count);
+    if (chunk_io != 0) {
+        printf("\tbackground: %lu loaded, %lu generated, %lu failed (%s)\n", atomic_load(&(*chunk_io).p_loaded_count), atomic_load(&(*chunk_io).p_generated_count), atomic_load(&(*chunk_io).p_failed_count), ((*chunk_io).p_uses_io_ring == VOX__bt__true) ? "io_uring" : "pread threads");
+    }
+    VOX__print__bench_latency(samples, step_count);
+    VOX__print__bench_allocations(before, step_count);
+
+    // clean up
+    VOX__destroy__world(world, 0);
+    VOX__destroy__buffer(samples);
+
+    return;
+}
+
+/* Bench - Chunk Meshing Throughput Across Worker Counts */
+void VOX__bench__meshing(u64 chunk_count, u64 seed) {
+    VOX__block_dictionary block_dictionary;
+    VOX__buffer chunks;
+    VOX__buffer samples;
+    VOX__allocation_statistics before;
+    VOX__chunk_position chunk_position;
+    VOX__object_datum mesh;
+    VOX__job_system* job_system;
+    VOX__job* job;
+    u64 vertex_count;
+    u64 element_count;
+    u64 sample_start;
+    u64 completed;
+    f64 start;
+    f64 seconds;
+    f64 baseline;
+
+    // setup chunks on the terrain surface
+    block_dictionary = VOX__create__test__block_dictionary__1();
+    chunks = VOX__create__buffer(sizeof(VOX__chunk) * chunk_count);
+    for (u64 i = 0; i < chunk_count; i++) {
+        ((VOX__chunk*)chunks.p_data)[i] = VOX__create__chunk__generated(VOX__create__chunk_position(i % 64, -1 - (s32)(i % 2), i / 64), seed);
+    }
+    samples = VOX__create__buffer(sizeof(u64) * chunk_count);
+
+    // single threaded baseline
+    vertex_count = 0;
+    element_count = 0;
+    before = VOX__read__allocation_statistics();
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < chunk_count; i++) {
+        sample_start = VOX__calculate__nanoseconds();
+        mesh = VOX__create__object_datum__greedy_mesh_from_chunk(((VOX__chunk*)chunks.p_data)[i], block_dictionary, VOX__create__3D_position(0.0f, 0.0f, 0.0f));
+        ((u64*)samples.p_data)[i] = VOX__calculate__nanoseconds() - sample_start;
+
+        vertex_count += mesh.p_vertices.p_vertex_count;
+        element_count += mesh.p_elements.p_element_count;
+        VOX__destroy__object_datum(mesh);
+    }
+    baseline = VOX__bench__seconds() - start;
+    printf("meshing (inline): %lu chunks in %.3f s (%.1f chunks/s, %.1f vertices/s, %.1f elements/s)\n", chunk_count, baseline, (f64)chunk_count / baseline, (f64)vertex_count / baseline, (f64)element_count / baseline);
+    VOX__print__bench_latency(samples, chunk_count);
+    VOX__print__bench_allocations(before, chunk_count);
+
+    // job system, doubling workers up to the processor count
+    for (u64 worker_count = 1; worker_count <= VOX__calculate__processor_count(); worker_count *= 2) {
+        job_system = VOX__open__job_system(worker_count);
+
+        start = VOX__bench__seconds();
+        for (u64 i = 0; i < chunk_count; i++) {
+            chunk_position = VOX__create__chunk_position(i % 64, -1 - (s32)(i % 2), i / 64);
+            VOX__submit__job(job_system, VOX__create__job__mesh_chunk(chunk_position, 0, ((VOX__chunk*)chunks.p_data)[i], 0, block_dictionary, VOX__vft__float, 0));
+        }
+        completed = 0;
+        while (completed < chunk_count) {
+            job = VOX__take__completed_job(job_system);
+            if (job != 0) {
+                VOX__destroy__job(job);
+                completed++;
+            } else {
+                sched_yield();
+            }
+        }
+        seconds = VOX__bench__seconds() - start;
+
+        printf("meshing (%lu workers): %lu chunks in %.3f s (%.1f chunks/s, %.2fx inline)\n", worker_count, chunk_count, seconds, (f64)chunk_count / seconds, baseline / seconds);
+
+        VOX__close__job_system(job_system);
+    }
+
+    // clean up
+    for (u64 i = 0; i < chunk_count; i++) {
+        VOX__destroy__chunk(((VOX__chunk*)chunks.p_data)[i]);
+    }
+    VOX__destroy__buffer(chunks);
+    VOX__destroy__buffer(samples);
+    VOX__destroy__block_dictionary(block_dictionary);
+
+    return;
+}
+
+/* Bench - Level Of Detail Meshing, Per Level & Across A Whole View */
+void VOX__bench__lod_meshing(u64 chunk_count, s32 view_radius, s32 lod_distance, u64 seed) {
+    VOX__block_dictionary block_dictionary;
+    VOX__buffer chunks;
+    VOX__object_datum mesh;
+    VOX__chunk chunk;
+    VOX__chunk_position chunk_position;
+    u64 vertex_counts[VOX__dt__chunk_lod_count];
+    u64 view_vertex_count;
+    u64 view_lod_vertex_count;
+    u64 view_level_counts[VOX__dt__chunk_lod_count];
+    u64 lod_level;
+    f64 start;
+    f64 seconds;
+
+    // setup chunks on the terrain surface
+    block_dictionary = VOX__create__test__block_dictionary__1();
+    chunks = VOX__create__buffer(sizeof(VOX__chunk) * chunk_count);
+    for (u64 i = 0; i < chunk_count; i++) {
+        ((VOX__chunk*)chunks.p_data)[i] = VOX__create__chunk__generated(VOX__create__chunk_position(i % 64, -1 - (s32)(i % 2), i / 64), seed);
+    }
+
+    // every chunk at every level
+    for (u64 level = 0; level < VOX__dt__chunk_lod_count; level++) {
+        vertex_counts[level] = 0;
+
+        start = VOX__bench__seconds();
+        for (u64 i = 0; i < chunk_count; i++) {
+            mesh = VOX__create__object_datum__greedy_mesh_from_chunk__lod(((VOX__chunk*)chunks.p_data)[i], block_dictionary, VOX__create__3D_position(0.0f, 0.0f, 0.0f), VOX__vft__float, level, &VOX__global__heap_allocator);
+            vertex_counts[level] += mesh.p_vertices.p_vertex_count;
+            VOX__destroy__object_datum(mesh);
+        }
+        seconds = VOX__bench__seconds() - start;
+
+        printf("lod meshing (%lux cells): %lu chunks in %.3f s (%.1f chunks/s), %lu vertices (%.2fx fewer than full detail)\n", (u64)1 << level, chunk_count, seconds, (f64)chunk_count / seconds, vertex_counts[level], (f64)vertex_counts[0] / (f64)vertex_counts[level]);
+    }
+
+    // whole view around the origin, each chunk at the level the world would pick
+    view_vertex_count = 0;
+    view_lod_vertex_count = 0;
+    for (u64 level = 0; level < VOX__dt__chunk_lod_count; level++) {
+        view_level_counts[level] = 0;
+    }
+    start = VOX__bench__seconds();
+    for (s32 y = -2; y <= 1; y++) {
+        for (s32 z = -view_radius; z <= view_radius; z++) {
+            for (s32 x = -view_radius; x <= view_radius; x++) {
+                chunk_position = VOX__create__chunk_position(x, y, z);
+                lod_level = VOX__calculate__chunk_lod_level(VOX__create__chunk_position(0, 0, 0), chunk_position, lod_distance);
+                chunk = VOX__create__chunk__generated(chunk_position, seed);
+
+                mesh = VOX__create__object_datum__greedy_mesh_from_chunk__lod(chunk, block_dictionary, VOX__create__3D_position(0.0f, 0.0f, 0.0f), VOX__vft__float, 0, &VOX__global__heap_allocator);
+                view_vertex_count += mesh.p_vertices.p_vertex_count;
+                VOX__destroy__object_datum(mesh);
+
+                mesh = VOX__create__object_datum__greedy_mesh_from_chunk__lod(chunk, block_dictionary, VOX__create__3D_position(0.0f, 0.0f, 0.0f), VOX__vft__float, lod_level, &VOX__global__heap_allocator);
+                view_lod_vertex_count += mesh.p_vertices.p_vertex_count;
+                view_level_counts[lod_level]++;
+                VOX__destroy__object_datum(mesh);
+
+                VOX__destroy__chunk(chunk);
+            }
+        }
+    }
+    seconds = VOX__bench__seconds() - start;
+    printf("lod view (radius %d, lod distance %d): %lu vertices at full detail, %lu with levels (%.2fx fewer), %.3f s\n", view_radius, lod_distance, view_vertex_count, view_lod_vertex_count, (f64)view_vertex_count / (f64)view_lod_vertex_count, seconds);
+    printf("\tchunks per level: %lu, %lu, %lu, %lu\n", view_level_counts[0], view_level_counts[1], view_level_counts[2], view_level_counts[3]);
+
+    // clean up
+    for (u64 i = 0; i < chunk_count; i++) {
+        VOX__destroy__chunk(((VOX__chunk*)chunks.p_data)[i]);
+    }
+    VOX__destroy__buffer(chunks);
+    VOX__destroy__block_dictionary(block_dictionary);
+
+    return;
+}
+
+/* Bench - Heap, Pool & Arena Allocators On Chunk Storage Sized Requests */
+void VOX__bench__allocators(u64 operation_count, u64 seed) {
+    VOX__allocator allocators[3];
+    char* names[] = { "heap", "pools", "arena" };
+    VOX__buffer live;
+    VOX__allocation_statistics before;
+    VOX__allocation_statistics statistics;
+    u64 live_count;
+    u64 random;
+    u64 length;
+    f64 start;
+    f64 seconds;
+
+    // setup allocators
+    allocators[0] = VOX__create__allocator__heap();
+    allocators[1] = VOX__open__allocator__pools(16, 1024, 65536);
+    allocators[2] = VOX__open__allocator__arena(1 << 20);
+    live = VOX__create__buffer(sizeof(VOX__buffer) * 256);
+
+    // churn a window of 256 live allocations between 16 & 1024 bytes, arenas reset when the window wraps
+    for (u64 allocator = 0; allocator < 3; allocator++) {
+        random = seed;
+        live_count = 0;
+        before = VOX__read__allocation_statistics();
+        start = VOX__bench__seconds();
+        for (u64 i = 0; i < operation_count; i++) {
+            random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+            length = 16llu << ((random >> 33) % 7);
+
+            if (live_count == 256) {
+                for (u64 j = 0; j < live_count; j++) {
+                    VOX__destroy__buffer__allocator(&allocators[allocator], ((VOX__buffer*)live.p_data)[j]);
+                }
+                VOX__reset__allocator(&allocators[allocator]);
+                live_count = 0;
+            }
+            ((VOX__buffer*)live.p_data)[live_count] = VOX__create__buffer__allocator(&allocators[allocator], length);
+            ((u8*)((VOX__buffer*)live.p_data)[live_count].p_data)[0] = (u8)i;
+            live_count++;
+        }
+        for (u64 j = 0; j < live_count; j++) {
+            VOX__destroy__buffer__allocator(&allocators[allocator], ((VOX__buffer*)live.p_data)[j]);
+        }
+        seconds = VOX__bench__seconds() - start;
+
+        // report
+        statistics = VOX__read__allocation_statistics__allocator(&allocators[allocator]);
+        printf("allocator (%s): %lu allocations in %.3f s (%.1f allocations/s, %lu bytes requested)\n", names[allocator], operation_count, seconds, (f64)operation_count / seconds, statistics.p_allocated_byte_count);
+        VOX__print__bench_allocations(before, operation_count);
+    }
+
+    // clean up
+    for (u64 allocator = 0; allocator < 3; allocator++) {
+        VOX__close__allocator(&allocators[allocator]);
+    }
+    VOX__destroy__buffer(live);
+
+    return;
+}
+
+/* Bench - Range Allocator Filled Up & Freed Out Of Order, Checked To Merge Back Into One Range */
+void VOX__bench__range_allocator(u64 capacity, u64 seed) {
+    VOX__range_allocator range_allocator;
+    VOX__buffer ranges;
+    VOX__range range;
+    VOX__range* free_ranges;
+    u64 range_count;
+    u64 random;
+    u64 swap;
+    u64 mismatch_count;
+    f64 start;
+    f64 seconds[2];
+
+    // setup
+    range_allocator = VOX__create__range_allocator(capacity);
+    ranges = VOX__create__buffer(sizeof(VOX__range) * capacity);
+    range_count = 0;
+    mismatch_count = 0;
+    random = seed;
+
+    // allocate between 1 & 64 at a time until one does not fit, then take exactly what is left
+    start = VOX__bench__seconds();
+    while (VOX__bt__true) {
+        random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+        range = VOX__create__range_allocation(&range_allocator, 1 + ((random >> 33) % 64));
+        if (VOX__check__range_is_null(range) == VOX__bt__true) {
+            break;
+        }
+        ((VOX__range*)ranges.p_data)[range_count] = range;
+        range_count++;
+    }
+    if (range_allocator.p_used < capacity) {
+        ((VOX__range*)ranges.p_data)[range_count] = VOX__create__range_allocation(&range_allocator, capacity - range_allocator.p_used);
+        mismatch_count += VOX__check__range_is_null(((VOX__range*)ranges.p_data)[range_count]) == VOX__bt__true;
+        range_count++;
+    }
+    seconds[0] = VOX__bench__seconds() - start;
+
+    // full, so even one more unit reports null
+    mismatch_count += range_allocator.p_used != capacity || range_allocator.p_free_range_count != 0;
+    mismatch_count += VOX__check__range_is_null(VOX__create__range_allocation(&range_allocator, 1)) == VOX__bt__false;
+
+    // free in a seeded shuffled order
+    for (u64 i = range_count - 1; i > 0; i--) {
+        random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+        swap = (random >> 33) % (i + 1);
+        range = ((VOX__range*)ranges.p_data)[i];
+        ((VOX__range*)ranges.p_data)[i] = ((VOX__range*)ranges.p_data)[swap];
+        ((VOX__range*)ranges.p_data)[swap] = range;
+    }
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < range_count; i++) {
+        VOX__destroy__range_allocation(&range_allocator, ((VOX__range*)ranges.p_data)[i]);
+    }
+    seconds[1] = VOX__bench__seconds() - start;
+
+    // everything merged back into the one range it started as
+    free_ranges = (VOX__range*)range_allocator.p_free_ranges.p_data;
+    mismatch_count += range_allocator.p_used != 0 || range_allocator.p_free_range_count != 1 || free_ranges[0].p_start != 0 || free_ranges[0].p_length != capacity;
+
+    printf("range allocator: %lu ranges filling %lu, allocate %.1f ns, free out of order %.1f ns, %lu mismatches\n", range_count, capacity, seconds[0] * 1000000000.0 / (f64)range_count, seconds[1] * 1000000000.0 / (f64)range_count, mismatch_count);
+
+    // clean up
+    VOX__destroy__range_allocator(range_allocator);
+    VOX__destroy__buffer(ranges);
+
+    return;
+}
+
+/* Bench - Bulk Memory Kernels Against The C Library */
+// the engine copies, fills & compares through the C library, these kernels stay here as what it is measured against
+typedef enum VOX__bmkt {
+    VOX__bmkt__library, // the C library itself
+    VOX__bmkt__scalar,
+    VOX__bmkt__sse2,
+    VOX__bmkt__avx2
+} VOX__bmkt;
+
+// widest kernel this processor runs
+VOX__bmkt VOX__calculate__bulk_memory_kernel() {
+#if defined(__SSE2__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return VOX__bmkt__avx2;
+    }
+
+    return VOX__bmkt__sse2;
+#else
+    return VOX__bmkt__scalar;
+#endif
+}
+
+// scalar kernels move 8 bytes per step
+void VOX__copy__bytes_to_bytes__scalar(void* source, u64 length, void* destination) {
+    u64 word;
+    u64 i;
+
+    for (i = 0; i + 8 <= length; i += 8) {
+        __builtin_memcpy(&word, (u8*)source + i, 8);
+        __builtin_memcpy((u8*)destination + i, &word, 8);
+    }
+    for (; i < length; i++) {
+        ((u8*)destination)[i] = ((u8*)source)[i];
+    }
+
+    return;
+}
+
+void VOX__fill__bytes__scalar(void* destination, u64 length, u8 value) {
+    u64 word;
+    u64 i;
+
+    word = (u64)value * 0x0101010101010101llu;
+    for (i = 0; i + 8 <= length; i += 8) {
+        __builtin_memcpy((u8*)destination + i, &word, 8);
+    }
+    for (; i < length; i++) {
+        ((u8*)destination)[i] = value;
+    }
+
+    return;
+}
+
+VOX__bt VOX__check__bytes_are_equal__scalar(void* a, void* b, u64 length) {
+    u64 word_a;
+    u64 word_b;
+    u64 i;
+
+    for (i = 0; i + 8 <= length; i += 8) {
+        __builtin_memcpy(&word_a, (u8*)a + i, 8);
+        __builtin_memcpy(&word_b, (u8*)b + i, 8);
+        if (word_a != word_b) {
+            return VOX__bt__false;
+        }
+    }
+    for (; i < length; i++) {
+        if (((u8*)a)[i] != ((u8*)b)[i]) {
+            return VOX__bt__false;
+        }
+    }
+
+    return VOX__bt__true;
+}
+
+#if defined(__SSE2__)
+// lengths shorter than one vector go to the next smaller kernel
+// the head & tail are unaligned vectors on the first & last bytes, the middle stores are aligned to the destination
+void VOX__copy__bytes_to_bytes__sse2(void* source, u64 length, void* destination) {
+    __m128i head;
+    __m128i tail;
+    u8* from;
+    u8* to;
+    u64 i;
+    u64 end;
+
+    // too short for one vector
+    if (length < 16) {
+        VOX__copy__bytes_to_bytes__scalar(source, length, destination);
+
+        return;
+    }
+
+    // setup pointers
+    from = (u8*)source;
+    to = (u8*)destination;
+    head = _mm_loadu_si128((__m128i*)from);
+    tail = _mm_loadu_si128((__m128i*)(from + length - 16));
+
+    // aligned middle
+    i = 16 - ((u64)to & 15);
+    end = length - 16;
+    for (; i + 64 <= end; i += 64) {
+        _mm_store_si128((__m128i*)(to + i), _mm_loadu_si128((__m128i*)(from + i)));
+        _mm_store_si128((__m128i*)(to + i + 16), _mm_loadu_si128((__m128i*)(from + i + 16)));
+        _mm_store_si128((__m128i*)(to + i + 32), _mm_loadu_si128((__m128i*)(from + i + 32)));
+        _mm_store_si128((__m128i*)(to + i + 48), _mm_loadu_si128((__m128i*)(from + i + 48)));
+    }
+    for (; i < end; i += 16) {
+        _mm_store_si128((__m128i*)(to + i), _mm_loadu_si128((__m128i*)(from + i)));
+    }
+
+    // ends last so the aligned stores may overrun into the tail
+    _mm_storeu_si128((__m128i*)to, head);
+    _mm_storeu_si128((__m128i*)(to + length - 16), tail);
+
+    return;
+}
+
+void VOX__fill__bytes__sse2(void* destination, u64 length, u8 value) {
+    __m128i fill;
+    u8* to;
+    u64 i;
+    u64 end;
+
+    // too short for one vector
+    if (length < 16) {
+        VOX__fill__bytes__scalar(destination, length, value);
+
+        return;
+    }
+
+    // unaligned ends
+    fill = _mm_set1_epi8((char)value);
+    to = (u8*)destination;
+    _mm_storeu_si128((__m128i*)to, fill);
+    _mm_storeu_si128((__m128i*)(to + length - 16), fill);
+
+    // aligned middle
+    i = 16 - ((u64)to & 15);
+    end = length - 16;
+    for (; i + 64 <= end; i += 64) {
+        _mm_store_si128((__m128i*)(to + i), fill);
+        _mm_store_si128((__m128i*)(to + i + 16), fill);
+        _mm_store_si128((__m128i*)(to + i + 32), fill);
+        _mm_store_si128((__m128i*)(to + i + 48), fill);
+    }
+    for (; i < end; i += 16) {
+        _mm_store_si128((__m128i*)(to + i), fill);
+    }
+
+    return;
+}
+
+VOX__bt VOX__check__bytes_are_equal__sse2(void* a, void* b, u64 length) {
+    __m128i equal;
+    u8* left;
+    u8* right;
+    u64 i;
+
+    // too short for one vector
+    if (length < 16) {
+        return VOX__check__bytes_are_equal__scalar(a, b, length);
+    }
+
+    // four vectors per step, one mask test
+    left = (u8*)a;
+    right = (u8*)b;
+    for (i = 0; i + 64 <= length; i += 64) {
+        equal = _mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(left + i)), _mm_loadu_si128((__m128i*)(right + i))), _mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(left + i + 16)), _mm_loadu_si128((__m128i*)(right + i + 16))));
+        equal = _mm_and_si128(equal, _mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(left + i + 32)), _mm_loadu_si128((__m128i*)(right + i + 32))));
+        equal = _mm_and_si128(equal, _mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(left + i + 48)), _mm_loadu_si128((__m128i*)(right + i + 48))));
+        if (_mm_movemask_epi8(equal) != 0xFFFF) {
+            return VOX__bt__false;
+        }
+    }
+    for (; i + 16 <= length; i += 16) {
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(left + i)), _mm_loadu_si128((__m128i*)(right + i)))) != 0xFFFF) {
+            return VOX__bt__false;
+        }
+    }
+    if (i < length && _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(left + length - 16)), _mm_loadu_si128((__m128i*)(right + length - 16)))) != 0xFFFF) {
+        return VOX__bt__false;
+    }
+
+    return VOX__bt__true;
+}
+
+__attribute__((target("avx2"))) void VOX__copy__bytes_to_bytes__avx2(void* source, u64 length, void* destination) {
+    __m256i head;
+    __m256i tail;
+    u8* from;
+    u8* to;
+    u64 i;
+    u64 end;
+
+    // too short for one vector
+    if (length < 32) {
+        VOX__copy__bytes_to_bytes__sse2(source, length, destination);
+
+        return;
+    }
+
+    // setup pointers
+    from = (u8*)source;
+    to = (u8*)destination;
+    head = _mm256_loadu_si256((__m256i*)from);
+    tail = _mm256_loadu_si256((__m256i*)(from + length - 32));
+
+    // aligned middle
+    i = 32 - ((u64)to & 31);
+    end = length - 32;
+    for (; i + 128 <= end; i += 128) {
+        _mm256_store_si256((__m256i*)(to + i), _mm256_loadu_si256((__m256i*)(from + i)));
+        _mm256_store_si256((__m256i*)(to + i + 32), _mm256_loadu_si256((__m256i*)(from + i + 32)));
+        _mm256_store_si256((__m256i*)(to + i + 64), _mm256_loadu_si256((__m256i*)(from + i + 64)));
+        _mm256_store_si256((__m256i*)(to + i + 96), _mm256_loadu_si256((__m256i*)(from + i + 96)));
+    }
+    for (; i < end; i += 32) {
+        _mm256_store_si256((__m256i*)(to + i), _mm256_loadu_si256((__m256i*)(from + i)));
+    }
+
+    // ends last so the aligned stores may overrun into the tail
+    _mm256_storeu_si256((__m256i*)to, head);
+    _mm256_storeu_si256((__m256i*)(to + length - 32), tail);
+
+    return;
+}
+
+__attribute__((target("avx2"))) void VOX__fill__bytes__avx2(void* destination, u64 length, u8 value) {
+    __m256i fill;
+    u8* to;
+    u64 i;
+    u64 end;
+
+    // too short for one vector
+    if (length < 32) {
+        VOX__fill__bytes__sse2(destination, length, value);
+
+        return;
+    }
+
+    // unaligned ends
+    fill = _mm256_set1_epi8((char)value);
+    to = (u8*)destination;
+    _mm256_storeu_si256((__m256i*)to, fill);
+    _mm256_storeu_si256((__m256i*)(to + length - 32), fill);
+
+    // aligned middle
+    i = 32 - ((u64)to & 31);
+    end = length - 32;
+    for (; i + 128 <= end; i += 128) {
+        _mm256_store_si256((__m256i*)(to + i), fill);
+        _mm256_store_si256((__m256i*)(to + i + 32), fill);
+        _mm256_store_si256((__m256i*)(to + i + 64), fill);
+        _mm256_store_si256((__m256i*)(to + i + 96), fill);
+    }
+    for (; i < end; i += 32) {
+        _mm256_store_si256((__m256i*)(to + i), fill);
+    }
+
+    return;
+}
+
+__attribute__((target("avx2"))) VOX__bt VOX__check__bytes_are_equal__avx2(void* a, void* b, u64 length) {
+    __m256i equal;
+    u8* left;
+    u8* right;
+    u64 i;
+
+    // too short for one vector
+    if (length < 32) {
+        return VOX__check__bytes_are_equal__sse2(a, b, length);
+    }
+
+    // four vectors per step, one mask test
+    left = (u8*)a;
+    right = (u8*)b;
+    for (i = 0; i + 128 <= length; i += 128) {
+        equal = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(left + i)), _mm256_loadu_si256((__m256i*)(right + i))), _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(left + i + 32)), _mm256_loadu_si256((__m256i*)(right + i + 32))));
+        equal = _mm256_and_si256(equal, _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(left + i + 64)), _mm256_loadu_si256((__m256i*)(right + i + 64))));
+        equal = _mm256_and_si256(equal, _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(left + i + 96)), _mm256_loadu_si256((__m256i*)(right + i + 96))));
+        if ((u32)_mm256_movemask_epi8(equal) != 0xFFFFFFFF) {
+            return VOX__bt__false;
+        }
+    }
+    for (; i + 32 <= length; i += 32) {
+        if ((u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(left + i)), _mm256_loadu_si256((__m256i*)(right + i)))) != 0xFFFFFFFF) {
+            return VOX__bt__false;
+        }
+    }
+    if (i < length && (u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(left + length - 32)), _mm256_loadu_si256((__m256i*)(right + length - 32)))) != 0xFFFFFFFF) {
+        return VOX__bt__false;
+    }
+
+    return VOX__bt__true;
+}
+#endif
+
+void VOX__bench__bulk_memory(u64 bytes_per_size, u64 seed) {
+    void* (*volatile library_copy)(void*, const void*, size_t);
+    void* (*volatile library_fill)(void*, int, size_t);
+    int (*volatile library_compare)(const void*, const void*, size_t);
+    char* kernel_names[] = { "libc", "scalar", "sse2", "avx2" };
+    u64 sizes[] = { 24, 64, 512, 1024, 4096, 65536, 1 << 20 };
+    VOX__bmkt widest_kernel;
+    VOX__buffer source;
+    VOX__buffer destination;
+    u64 repeat_count;
+    u64 mismatch_count;
+    u64 random;
+    f64 start;
+    f64 seconds[3];
+
+    // setup buffers with seeded bytes
+    library_copy = memcpy;
+    library_fill = memset;
+    library_compare = memcmp;
+    widest_kernel = VOX__calculate__bulk_memory_kernel();
+    source = VOX__create__buffer(sizes[(sizeof(sizes) / sizeof(u64)) - 1] + 1);
+    destination = VOX__create__buffer(sizes[(sizeof(sizes) / sizeof(u64)) - 1] + 1);
+    random = seed;
+    for (u64 i = 0; i < source.p_length; i++) {
+        random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+        ((u8*)source.p_data)[i] = (u8)(random >> 56);
+    }
+
+    printf("bulk memory: widest kernel %s, GB/s for copy / fill / compare\n", kernel_names[widest_kernel]);
+    for (u64 size = 0; size < sizeof(sizes) / sizeof(u64); size++) {
+        repeat_count = (bytes_per_size / sizes[size]) + 1;
+        printf("\t%7lu bytes:", sizes[size]);
+
+        // libc first, then every kernel this processor runs (odd offset so nothing is aligned)
+        for (u64 kernel = 0; kernel <= widest_kernel; kernel++) {
+            mismatch_count = 0;
+
+            start = VOX__bench__seconds();
+            for (u64 r = 0; r < repeat_count; r++) {
+                switch (kernel) {
+                case VOX__bmkt__scalar:
+                    VOX__copy__bytes_to_bytes__scalar((u8*)source.p_data + 1, sizes[size], (u8*)destination.p_data + 1);
+                    break;
+#if defined(__SSE2__)
+                case VOX__bmkt__sse2:
+                    VOX__copy__bytes_to_bytes__sse2((u8*)source.p_data + 1, sizes[size], (u8*)destination.p_data + 1);
+                    break;
+                case VOX__bmkt__avx2:
+                    VOX__copy__bytes_to_bytes__avx2((u8*)source.p_data + 1, sizes[size], (u8*)destination.p_data + 1);
+                    break;
+#endif
+                default:
+                    library_copy((u8*)destination.p_data + 1, (u8*)source.p_data + 1, sizes[size]);
+                    break;
+                }
+            }
+            seconds[0] = VOX__bench__seconds() - start;
+            mismatch_count += library_compare((u8*)destination.p_data + 1, (u8*)source.p_data + 1, sizes[size]) != 0;
+
+            start = VOX__bench__seconds();
+            for (u64 r = 0; r < repeat_count; r++) {
+                switch (kernel) {
+                case VOX__bmkt__scalar:
+                    mismatch_count += VOX__check__bytes_are_equal__scalar((u8*)source.p_data + 1, (u8*)destination.p_data + 1, sizes[size]) == VOX__bt__false;
+                    break;
+#if defined(__SSE2__)
+                case VOX__bmkt__sse2:
+                    mismatch_count += VOX__check__bytes_are_equal__sse2((u8*)source.p_data + 1, (u8*)destination.p_data + 1, sizes[size]) == VOX__bt__false;
+                    break;
+                case VOX__bmkt__avx2:
+                    mismatch_count += VOX__check__bytes_are_equal__avx2((u8*)source.p_data + 1, (u8*)destination.p_data + 1, sizes[size]) == VOX__bt__false;
+                    break;
+#endif
+                default:
+                    mismatch_count += library_compare((u8*)source.p_data + 1, (u8*)destination.p_data + 1, sizes[size]) != 0;
+                    break;
+                }
+            }
+            seconds[2] = VOX__bench__seconds() - start;
+
+            start = VOX__bench__seconds();
+            for (u64 r = 0; r < repeat_count; r++) {
+                switch (kernel) {
+                case VOX__bmkt__scalar:
+                    VOX__fill__bytes__scalar((u8*)destination.p_data + 1, sizes[size], (u8)r);
+                    break;
+#if defined(__SSE2__)
+                case VOX__bmkt__sse2:
+                    VOX__fill__bytes__sse2((u8*)destination.p_data + 1, sizes[size], (u8)r);
+                    break;
+                case VOX__bmkt__avx2:
+                    VOX__fill__bytes__avx2((u8*)destination.p_data + 1, sizes[size], (u8)r);
+                    break;
+#endif
+                default:
+                    library_fill((u8*)destination.p_data + 1, (u8)r, sizes[size]);
+                    break;
+                }
+            }
+            seconds[1] = VOX__bench__seconds() - start;
+            mismatch_count += ((u8*)destination.p_data)[sizes[size]] != (u8)(repeat_count - 1);
+
+            printf("  %s %.1f / %.1f / %.1f%s", kernel_names[kernel], (f64)(repeat_count * sizes[size]) / seconds[0] / 1e9, (f64)(repeat_count * sizes[size]) / seconds[1] / 1e9, (f64)(repeat_count * sizes[size]) / seconds[2] / 1e9, mismatch_count == 0 ? "" : " (WRONG)");
+        }
+        printf("\n");
+    }
+
+    // clean up
+    VOX__destroy__buffer(source);
+    VOX__destroy__buffer(destination);
+
+    return;
+}
+
+/* Bench - Vertex & Element Buffer Creation At Mesh Sizes */
+void VOX__bench__buffer_creation(u64 repeat_count) {
+    VOX__buffer samples;
+    VOX__allocation_statistics before;
+    VOX__vbo_vertices vertices;
+    VOX__ebo_vertices elements;
+    u64 quad_counts[] = { 1, 64, 512, VOX__dt__chunk_mesh_maximum_quad_count };
+    u64 sample_start;
+    f64 start;
+    f64 seconds;
+
+    // setup
+    samples = VOX__create__buffer(sizeof(u64) * repeat_count);
+
+    // create & destroy one mesh's buffers per sample, for a few mesh sizes
+    for (u64 size = 0; size < sizeof(quad_counts) / sizeof(u64); size++) {
+        before = VOX__read__allocation_statistics();
+        start = VOX__bench__seconds();
+        for (u64 i = 0; i < repeat_count; i++) {
+            sample_start = VOX__calculate__nanoseconds();
+            vertices = VOX__create__vbo_vertices(quad_counts[size] * 4);
+            elements = VOX__create__ebo_vertices(quad_counts[size] * 6);
+            ((u64*)samples.p_data)[i] = VOX__calculate__nanoseconds() - sample_start;
+
+            VOX__destroy__vbo_vertices(vertices);
+            VOX__destroy__ebo_vertices(elements);
+        }
+        seconds = VOX__bench__seconds() - start;
+
+        printf("buffer creation (%lu quads): %lu in %.3f s (%.1f buffer pairs/s)\n", quad_counts[size], repeat_count, seconds, (f64)repeat_count / seconds);
+        VOX__print__bench_latency(samples, repeat_count);
+        VOX__print__bench_allocations(before, repeat_count);
+    }
+
+    // clean up
+    VOX__destroy__buffer(samples);
+
+    return;
+}
+
+/* Bench - Camera Matrix Updates */
+void VOX__bench__camera_updates(u64 step_count) {
+    VOX__camera camera;
+    VOX__buffer samples;
+    VOX__allocation_statistics before;
+    u64 sample_start;
+    f64 start;
+    f64 seconds;
+
+    // setup
+    camera = VOX__create__camera();
+    samples = VOX__create__buffer(sizeof(u64) * step_count);
+    before = VOX__read__allocation_statistics();
+
+    // move & turn every step so every matrix is rebuilt
+    start = VOX__bench__seconds();
+    for (u64 step = 0; step < step_count; step++) {
+        sample_start = VOX__calculate__nanoseconds();
+        camera = VOX__move__camera(camera, VOX__create__3D_position(0.01f, 0.0f, 0.01f), VOX__create__3D_position(0.1f, 0.1f, 0.0f));
+        ((u64*)samples.p_data)[step] = VOX__calculate__nanoseconds() - sample_start;
+    }
+    seconds = VOX__bench__seconds() - start;
+
+    // report (position keeps the loop from being optimized out)
+    printf("camera updates: %lu in %.3f s (%.1f updates/s, ended at %.1f %.1f %.1f)\n", step_count, seconds, (f64)step_count / seconds, camera.p_position[0], camera.p_position[1], camera.p_position[2]);
+    VOX__print__bench_latency(samples, step_count);
+    VOX__print__bench_allocations(before, step_count);
+
+    // clean up
+    VOX__destroy__buffer(samples);
+
+    return;
+}
+
+/* Bench - Frustum Culling Of Chunk Boxes */
+void VOX__bench__frustum_culling(s32 radius, u64 repeat_count) {
+    VOX__camera camera;
+    VOX__frustum frustum;
+    VOX__buffer centers;
+    VOX__buffer visible;
+    f32* xs;
+    f32* ys;
+    f32* zs;
+    u64 box_count;
+    u64 visible_count;
+    u64 mismatch_count;
+    f64 start;
+    f64 scalar_seconds;
+    f64 batched_seconds;
+
+    // setup camera and a slab of chunk boxes around it
+    camera = VOX__move__camera(VOX__create__camera(), VOX__create__3D_position(0.0f, 0.0f, 0.0f), VOX__create__3D_position(0.0f, 0.0f, 0.0f));
+    frustum = VOX__create__frustum__from_camera(camera);
+    box_count = (u64)((radius * 2) + 1) * (u64)((radius * 2) + 1) * 5;
+    centers = VOX__create__buffer(sizeof(f32) * box_count * 3);
+    visible = VOX__create__buffer(sizeof(u8) * box_count);
+    xs = (f32*)centers.p_data;
+    ys = xs + box_count;
+    zs = ys + box_count;
+    box_count = 0;
+    for (s32 y = -2; y <= 2; y++) {
+        for (s32 z = -radius; z <= radius; z++) {
+            for (s32 x = -radius; x <= radius; x++) {
+                xs[box_count] = (x * VOX__dt__chunk_side_length) + (VOX__dt__chunk_side_length / 2.0f);
+                ys[box_count] = (y * VOX__dt__chunk_side_length) + (VOX__dt__chunk_side_length / 2.0f);
+                zs[box_count] = (z * VOX__dt__chunk_side_length) + (VOX__dt__chunk_side_length / 2.0f);
+                box_count++;
+            }
+        }
+    }
+
+    // one box at a time
+    visible_count = 0;
+    start = VOX__bench__seconds();
+    for (u64 r = 0; r < repeat_count; r++) {
+        for (u64 i = 0; i < box_count; i++) {
+            visible_count += VOX__check__box_is_in_frustum(&frustum, xs[i], ys[i], zs[i], VOX__dt__chunk_side_length / 2.0f);
+        }
+    }
+    scalar_seconds = VOX__bench__seconds() - start;
+
+    // batched
+    start = VOX__bench__seconds();
+    for (u64 r = 0; r < repeat_count; r++) {
+        VOX__calculate__boxes_in_frustum(&frustum, xs, ys, zs, VOX__dt__chunk_side_length / 2.0f, box_count, (u8*)visible.p_data);
+    }
+    batched_seconds = VOX__bench__seconds() - start;
+
+    // both paths must agree
+    mismatch_count = 0;
+    for (u64 i = 0; i < box_count; i++) {
+        mismatch_count += ((u8*)visible.p_data)[i] != VOX__check__box_is_in_frustum(&frustum, xs[i], ys[i], zs[i], VOX__dt__chunk_side_length / 2.0f);
+    }
+
+    // report
+    printf("frustum culling: %lu boxes, %.1f%% visible, %lu mismatches\n", box_count, 100.0 * (f64)visible_count / (f64)(box_count * repeat_count), mismatch_count);
+    printf("\tscalar: %.1f boxes/s, batched: %.1f boxes/s (%.2fx)\n", (f64)(box_count * repeat_count) / scalar_seconds, (f64)(box_count * repeat_count) / batched_seconds, scalar_seconds / batched_seconds);
+
+    // clean up
+    VOX__destroy__buffer(centers);
+    VOX__destroy__buffer(visible);
+
+    return;
+}
+
+void VOX__bench__region_files(u64 seed) {
+    char directory[] = "/tmp/voxelize_bench_XXXXXX";
+    VOX__error error;
+    VOX__region region;
+    VOX__buffer samples;
+    VOX__chunk chunk;
+    VOX__chunk generated;
+    VOX__chunk_position chunk_position;
+    u64 chunk_count;
+    u64 sample_start;
+    u64 memory_size;
+    u64 mismatch_count;
+    f64 start;
+    f64 seconds;
+
+    // setup one full region straddling the surface
+    error = VOX__create__error__no_error();
+    chunk_count = VOX__dt__region_chunk_count;
+    samples = VOX__create__buffer(sizeof(u64) * chunk_count);
+    memory_size = 0;
+    mismatch_count = 0;
+    if (mkdtemp(directory) == 0) {
+        printf("region files: could not create %s\n", directory);
+        VOX__destroy__buffer(samples);
+
+        return;
+    }
+    region = VOX__open__region(&error, directory, VOX__create__chunk_position(0, -1, 0));
+
+    // save
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < chunk_count && VOX__check__error__has_error_occured(&error) == VOX__bt__false; i++) {
+        chunk_position = VOX__create__chunk_position(i % 16, -1 - (s32)((i / 16) % 16), i / 256);
+        chunk = VOX__create__chunk__generated(chunk_position, seed);
+        memory_size += VOX__calculate__chunk_memory_size(chunk);
+
+        sample_start = VOX__calculate__nanoseconds();
+        VOX__write__chunk_to_region(&error, &region, chunk_position, chunk);
+        ((u64*)samples.p_data)[i] = VOX__calculate__nanoseconds() - sample_start;
+
+        VOX__destroy__chunk(chunk);
+    }
+    seconds = VOX__bench__seconds() - start;
+    printf("region save: %lu chunks, %lu bytes in memory -> %lu bytes on disk (%.1f bytes/chunk payload)\n", chunk_count, memory_size, region.p_file_length, (f64)region.p_live_length / (f64)chunk_count);
+    VOX__print__bench_latency(samples, chunk_count);
+
+    // load back through the mapping, checking every chunk against a fresh generation
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < chunk_count && VOX__check__error__has_error_occured(&error) == VOX__bt__false; i++) {
+        chunk_position = VOX__create__chunk_position(i % 16, -1 - (s32)((i / 16) % 16), i / 256);
+
+        sample_start = VOX__calculate__nanoseconds();
+        if (VOX__read__chunk_from_region(&region, chunk_position, &chunk) == VOX__bt__false) {
+            mismatch_count++;
+            ((u64*)samples.p_data)[i] = VOX__calculate__nanoseconds() - sample_start;
+
+            continue;
+        }
+        ((u64*)samples.p_data)[i] = VOX__calculate__nanoseconds() - sample_start;
+
+        if (i % 64 == 0) {
+            generated = VOX__create__chunk__generated(chunk_position, seed);
+
+            for (u64 b = 0; b < VOX__dt__chunk_block_count; b++) {
+                mismatch_count += VOX__read__block_ID_from_chunk(chunk, b % 8, (b / 8) % 8, b / 64) != VOX__read__block_ID_from_chunk(generated, b % 8, (b / 8) % 8, b / 64);
+            }
+            VOX__destroy__chunk(generated);
+        }
+        VOX__destroy__chunk(chunk);
+    }
+    seconds = VOX__bench__seconds() - start;
+    printf("region load: %lu chunks in %.3f s (%.1f chunks/s, %lu mismatches)\n", chunk_count, seconds, (f64)chunk_count / seconds, mismatch_count);
+    VOX__print__bench_latency(samples, chunk_count);
+
+    // report failures
+    if (VOX__check__error__has_error_occured(&error) == VOX__bt__true) {
+        VOX__print__error(error);
+    }
+
+    // clean up
+    VOX__close__region(region);
+    remove(region.p_path);
+    remove(directory);
+    VOX__destroy__buffer(samples);
+
+    return;
+}
+
+void VOX__bench__chunk_io(u64 chunk_count, u64 seed) {
+    char directory[] = "/tmp/voxelize_bench_XXXXXX";
+    char path[VOX__dt__region_path_length + 300];
+    VOX__chunk_io* chunk_io;
+    VOX__chunk_io_request* request;
+    VOX__chunk_io_request* next;
+    VOX__buffer samples;
+    VOX__chunk generated;
+    DIR* listing;
+    struct dirent* listing_entry;
+    u64 sample_start;
+    u64 received_count;
+    u64 mismatch_count;
+    f64 start;
+    f64 seconds;
+
+    // setup
+    samples = VOX__create__buffer(sizeof(u64) * chunk_count);
+    received_count = 0;
+    mismatch_count = 0;
+    if (mkdtemp(directory) == 0) {
+        printf("chunk io: could not create %s\n", directory);
+        VOX__destroy__buffer(samples);
+
+        return;
+    }
+
+    // save a slab, closing waits for every write
+    chunk_io = VOX__open__chunk_io(directory, 0);
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < chunk_count; i++) {
+        VOX__request__chunk_save(chunk_io, VOX__create__chunk_position(i % 64, -1 - (s32)((i / 64) % 4), i / 256), VOX__create__chunk__generated(VOX__create__chunk_position(i % 64, -1 - (s32)((i / 64) % 4), i / 256), seed));
+    }
+    VOX__close__chunk_io(chunk_io);
+    seconds = VOX__bench__seconds() - start;
+    printf("chunk io save: %lu chunks in %.3f s (%.1f chunks/s, generation included)\n", chunk_count, seconds, (f64)chunk_count / seconds);
+
+    // load it back, timing only what the requesting thread pays
+    chunk_io = VOX__open__chunk_io(directory, 0);
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < chunk_count; i++) {
+        sample_start = VOX__calculate__nanoseconds();
+        VOX__request__chunk_load(chunk_io, VOX__create__chunk_position(i % 64, -1 - (s32)((i / 64) % 4), i / 256), seed);
+        ((u64*)samples.p_data)[i] = VOX__calculate__nanoseconds() - sample_start;
+    }
+    while (received_count < chunk_count) {
+        request = VOX__take__completed_chunk_io_requests(chunk_io);
+        if (request == 0) {
+            sched_yield();
+        }
+        while (request != 0) {
+            next = (*request).p_next;
+
+            // spot check against a fresh generation
+            if ((*request).p_status != VOX__cist__loaded) {
+                mismatch_count++;
+            } else if (received_count % 64 == 0) {
+                generated = VOX__create__chunk__generated((*request).p_position, seed);
+                for (u64 b = 0; b < VOX__dt__chunk_block_count; b++) {
+                    mismatch_count += VOX__read__block_ID_from_chunk((*request).p_chunk, b % 8, (b / 8) % 8, b / 64) != VOX__read__block_ID_from_chunk(generated, b % 8, (b / 8) % 8, b / 64);
+                }
+                VOX__destroy__chunk(generated);
+            }
+
+            VOX__destroy__chunk_io_request(request);
+            received_count++;
+            request = next;
+        }
+    }
+    seconds = VOX__bench__seconds() - start;
+    printf("chunk io load: %lu chunks in %.3f s (%.1f chunks/s, %lu mismatches, %s, %lu decode threads)\n", chunk_count, seconds, (f64)chunk_count / seconds, mismatch_count, ((*chunk_io).p_uses_io_ring == VOX__bt__true) ? "io_uring" : "pread threads", (*chunk_io).p_decode_thread_count);
+    printf("\trequest cost on the calling thread:\n");
+    VOX__print__bench_latency(samples, chunk_count);
+    VOX__close__chunk_io(chunk_io);
+
+    // clean up
+    listing = opendir(directory);
+    while (listing != 0 && (listing_entry = readdir(listing)) != 0) {
+        if ((*listing_entry).d_name[0] != '.') {
+            snprintf(path, sizeof(path), "%s/%s", directory, (*listing_entry).d_name);
+            remove(path);
+        }
+    }
+    if (listing != 0) {
+        closedir(listing);
+    }
+    remove(directory);
+    VOX__destroy__buffer(samples);
+
+    return;
+}
+
+/* Bench - Brick Tree Point, Box & Empty Space Queries Against The Flat World */
+void VOX__bench__brick_tree(s32 radius, s32 height_radius, u64 query_count, u64 seed) {
+    VOX__world world;
+    VOX__camera camera;
+    VOX__brick_tree tree;
+    VOX__buffer points;
+    s64* point;
+    s64 box_minimum[3];
+    s64 box_maximum[3];
+    s64 cube_corner[3];
+    u64 random;
+    u64 mismatch_count;
+    u64 solid_count;
+    u64 flat_solid_count;
+    u64 empty_count;
+    u64 empty_volume;
+    u64 cube_side_length;
+    VOX__bt found;
+    f64 start;
+    f64 seconds;
+    f64 flat_seconds;
+
+    // load a whole world synchronously (tall enough for lots of sky & solid ground)
+    world = VOX__create__world(radius, height_radius, 0, ~(u64)0, seed, 0);
+    camera = VOX__create__camera();
+    VOX__update__world(&world, camera, 0);
+
+    // build
+    start = VOX__bench__seconds();
+    tree = VOX__create__brick_tree__from_world(&world);
+    seconds = VOX__bench__seconds() - start;
+    printf("brick tree: %lu chunks in %.3f s (%.1f chunks/s), depth %lu, %lu nodes, %lu bricks\n", world.p_chunk_count, seconds, (f64)world.p_chunk_count / seconds, tree.p_depth, tree.p_node_count, tree.p_brick_count);
+    printf("\tmemory: %lu bytes tree, %lu bytes world (%lu slots + %lu chunks), %lu bytes unpacked\n", VOX__calculate__brick_tree_memory_size(&tree), world.p_slots.p_length + VOX__calculate__world_block_memory_size(&world), world.p_slots.p_length, VOX__calculate__world_block_memory_size(&world), world.p_chunk_count * sizeof(VOX__block_ID) * VOX__dt__chunk_block_count);
+
+    // random points inside the loaded volume
+    points = VOX__create__buffer(sizeof(s64) * 3 * query_count);
+    random = seed;
+    for (u64 i = 0; i < query_count * 3; i++) {
+        random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+        ((s64*)points.p_data)[i] = (s64)((random >> 33) % (u64)(((((i % 3) == 1) ? height_radius : radius) * 2 + 1) * VOX__dt__chunk_side_length)) - ((((i % 3) == 1) ? height_radius : radius) * VOX__dt__chunk_side_length);
+    }
+
+    // point queries
+    mismatch_count = 0;
+    solid_count = 0;
+    flat_solid_count = 0;
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < query_count; i++) {
+        point = (s64*)points.p_data + (i * 3);
+        solid_count += VOX__read__block_ID_from_brick_tree(&tree, point[0], point[1], point[2]) != VOX__bit__air;
+    }
+    seconds = VOX__bench__seconds() - start;
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < query_count; i++) {
+        point = (s64*)points.p_data + (i * 3);
+        flat_solid_count += VOX__read__block_ID_from_world(&world, point[0], point[1], point[2]) != VOX__bit__air;
+    }
+    flat_seconds = VOX__bench__seconds() - start;
+    for (u64 i = 0; i < query_count; i++) {
+        point = (s64*)points.p_data + (i * 3);
+        mismatch_count += VOX__read__block_ID_from_brick_tree(&tree, point[0], point[1], point[2]) != VOX__read__block_ID_from_world(&world, point[0], point[1], point[2]);
+    }
+    printf("\tpoint queries: %.1f M/s tree, %.1f M/s world hash, %lu solid (%lu in world), %lu mismatches\n", (f64)query_count / seconds / 1000000.0, (f64)query_count / flat_seconds / 1000000.0, solid_count, flat_solid_count, mismatch_count);
+
+    // 16 block box queries (checked against a block by block scan of the world)
+    mismatch_count = 0;
+    solid_count = 0;
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < query_count / 64; i++) {
+        point = (s64*)points.p_data + (i * 3);
+        for (u64 axis = 0; axis < 3; axis++) {
+            box_minimum[axis] = point[axis];
+            box_maximum[axis] = point[axis] + 15;
+        }
+        solid_count += VOX__check__brick_tree_box_has_solid_blocks(&tree, box_minimum, box_maximum);
+    }
+    seconds = VOX__bench__seconds() - start;
+    for (u64 i = 0; i < query_count / 64; i++) {
+        point = (s64*)points.p_data + (i * 3);
+        found = VOX__bt__false;
+        for (s64 z = point[2]; z <= point[2] + 15 && found == VOX__bt__false; z++) {
+            for (s64 y = point[1]; y <= point[1] + 15 && found == VOX__bt__false; y++) {
+                for (s64 x = point[0]; x <= point[0] + 15 && found == VOX__bt__false; x++) {
+                    found = VOX__read__block_ID_from_world(&world, x, y, z) != VOX__bit__air;
+                }
+            }
+        }
+        for (u64 axis = 0; axis < 3; axis++) {
+            box_minimum[axis] = point[axis];
+            box_maximum[axis] = point[axis] + 15;
+        }
+        mismatch_count += VOX__check__brick_tree_box_has_solid_blocks(&tree, box_minimum, box_maximum) != found;
+    }
+    printf("\tbox queries (16 blocks a side): %lu in %.3f s (%.1f k/s), %lu holding blocks, %lu mismatches\n", query_count / 64, seconds, (f64)(query_count / 64) / seconds / 1000.0, solid_count, mismatch_count);
+
+    // how far empty space lets a query jump
+    empty_count = 0;
+    empty_volume = 0;
+    for (u64 i = 0; i < query_count; i++) {
+        point = (s64*)points.p_data + (i * 3);
+        cube_side_length = VOX__calculate__brick_tree_empty_cube(&tree, point[0], point[1], point[2], cube_corner);
+        if (cube_side_length > 0) {
+            empty_count++;
+            empty_volume += cube_side_length;
+        }
+    }
+    printf("\tempty space: %lu of %lu points in air, mean empty cube %.1f blocks a side\n", empty_count, query_count, (f64)empty_volume / (f64)empty_count);
+
+    // clean up
+    VOX__destroy__buffer(points);
+    VOX__destroy__brick_tree(tree);
+    VOX__destroy__world(world, 0);
+
+    return;
+}
+
+/* Bench - Flood Fill Lighting, Lit Meshing & Block Edits Against A Full Relight */
+// copies every loaded chunk's light into snapshot (slot order), returns the byte count
+u64 VOX__bench__copy_world_light(VOX__world* world, VOX__buffer snapshot) {
+    VOX__world_slot* slot;
+    u64 byte_count;
+
+    // copy
+    byte_count = 0;
+    for (u64 i = 0; i < (*world).p_slot_count; i++) {
+        slot = &((VOX__world_slot*)(*world).p_slots.p_data)[i];
+        if ((*slot).p_occupied == VOX__bt__true && (*slot).p_light.p_data != 0 && byte_count + VOX__dt__chunk_block_count <= snapshot.p_length) {
+            memcpy((u8*)snapshot.p_data + byte_count, (*slot).p_light.p_data, VOX__dt__chunk_block_count);
+            byte_count += VOX__dt__chunk_block_count;
+        }
+    }
+
+    return byte_count;
+}
+
+void VOX__bench__lighting(s32 radius, s32 height_radius, u64 edit_count, u64 seed) {
+    VOX__world world;
+    VOX__camera camera;
+    VOX__block_dictionary block_dictionary;
+    VOX__chunk_neighborhood neighborhood;
+    VOX__world_slot* slot;
+    VOX__object_datum mesh;
+    VOX__buffer incremental;
+    VOX__buffer relit;
+    VOX__buffer samples;
+    VOX__block_ID edit_block_IDs[3] = { VOX__bit__air, VOX__bit__stone, VOX__bit__lamp };
+    u64 byte_count;
+    u64 mismatch_count;
+    u64 random;
+    u64 sample_start;
+    u64 mesh_count;
+    u64 lit_vertex_count;
+    u64 unlit_vertex_count;
+    f64 start;
+    f64 seconds;
+    f64 unlit_seconds;
+
+    // load a whole world synchronously, each arriving chunk is lit incrementally
+    start = VOX__bench__seconds();
+    world = VOX__create__world(radius, height_radius, 0, ~(u64)0, seed, 0);
+    camera = VOX__create__camera();
+    VOX__update__world(&world, camera, 0);
+    seconds = VOX__bench__seconds() - start;
+    printf("lighting: %lu chunks generated & lit in %.3f s (%.1f chunks/s)\n", world.p_chunk_count, seconds, (f64)world.p_chunk_count / seconds);
+
+    // full relight from scratch, checked against the incremental result
+    incremental = VOX__create__buffer(world.p_chunk_count * VOX__dt__chunk_block_count);
+    relit = VOX__create__buffer(world.p_chunk_count * VOX__dt__chunk_block_count);
+    byte_count = VOX__bench__copy_world_light(&world, incremental);
+    start = VOX__bench__seconds();
+    VOX__relight__world(&world);
+    seconds = VOX__bench__seconds() - start;
+    VOX__bench__copy_world_light(&world, relit);
+    mismatch_count = 0;
+    for (u64 i = 0; i < byte_count; i++) {
+        mismatch_count += ((u8*)incremental.p_data)[i] != ((u8*)relit.p_data)[i];
+    }
+    printf("\tfull relight: %.3f s (%.1f chunks/s), %lu of %lu cells differ from incremental load\n", seconds, (f64)world.p_chunk_count / seconds, mismatch_count, byte_count);
+
+    // lit (neighborhood gather + ao + smooth light) vs unlit greedy meshing
+    block_dictionary = VOX__create__test__block_dictionary__1();
+    mesh_count = 0;
+    lit_vertex_count = 0;
+    unlit_vertex_count = 0;
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < world.p_slot_count; i++) {
+        slot = &((VOX__world_slot*)world.p_slots.p_data)[i];
+        if ((*slot).p_occupied == VOX__bt__true) {
+            VOX__read__chunk_neighborhood_from_world(&world, slot, &neighborhood);
+            mesh = VOX__create__object_datum__greedy_mesh_from_chunk__lit((*slot).p_chunk, &neighborhood, block_dictionary, VOX__create__3D_position(0.0f, 0.0f, 0.0f), VOX__vft__packed, 0, &VOX__global__heap_allocator);
+            lit_vertex_count += mesh.p_vertices.p_vertex_count;
+            VOX__destroy__object_datum(mesh);
+            mesh_count++;
+        }
+    }
+    seconds = VOX__bench__seconds() - start;
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < world.p_slot_count; i++) {
+        slot = &((VOX__world_slot*)world.p_slots.p_data)[i];
+        if ((*slot).p_occupied == VOX__bt__true) {
+            mesh = VOX__create__object_datum__greedy_mesh_from_chunk__lit((*slot).p_chunk, 0, block_dictionary, VOX__create__3D_position(0.0f, 0.0f, 0.0f), VOX__vft__packed, 0, &VOX__global__heap_allocator);
+            unlit_vertex_count += mesh.p_vertices.p_vertex_count;
+            VOX__destroy__object_datum(mesh);
+        }
+    }
+    unlit_seconds = VOX__bench__seconds() - start;
+    printf("\tmeshing: %.1f chunks/s lit, %.1f chunks/s unlit (%.2fx cost), %lu vertices lit vs %lu unlit\n", (f64)mesh_count / seconds, (f64)mesh_count / unlit_seconds, seconds / unlit_seconds, lit_vertex_count, unlit_vertex_count);
+
+    // random digs, placements & lamps near the surface
+    samples = VOX__create__buffer(sizeof(u64) * edit_count);
+    random = seed;
+    start = VOX__bench__seconds();
+    for (u64 i = 0; i < edit_count; i++) {
+        random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+        sample_start = VOX__calculate__nanoseconds();
+        VOX__write__block_ID_to_world(&world, (s64)((random >> 33) % (u64)(radius * VOX__dt__chunk_side_length)) - (radius * VOX__dt__chunk_side_length / 2), (s64)((random >> 20) % (u64)(height_radius * VOX__dt__chunk_side_length)) - (height_radius * VOX__dt__chunk_side_length / 2), (s64)((random >> 40) % (u64)(radius * VOX__dt__chunk_side_length)) - (radius * VOX__dt__chunk_side_length / 2), edit_block_IDs[(random >> 50) % 3]);
+        ((u64*)samples.p_data)[i] = VOX__calculate__nanoseconds() - sample_start;
+    }
+    seconds = VOX__bench__seconds() - start;
+
+    // edits must land on the same light as a full relight
+    byte_count = VOX__bench__copy_world_light(&world, incremental);
+    VOX__relight__world(&world);
+    VOX__bench__copy_world_light(&world, relit);
+    mismatch_count = 0;
+    for (u64 i = 0; i < byte_count; i++) {
+        mismatch_count += ((u8*)incremental.p_data)[i] != ((u8*)relit.p_data)[i];
+    }
+    printf("\tedits: %lu in %.3f s (%.1f k/s), %lu of %lu cells differ from full relight\n", edit_count, seconds, (f64)edit_count / seconds / 1000.0, mismatch_count, byte_count);
+    VOX__print__bench_latency(samples, edit_count);
+
+    // clean up
+    VOX__destroy__buffer(samples);
+    VOX__destroy__buffer(incremental);
+    VOX__destroy__buffer(relit);
+    VOX__destroy__block_dictionary(block_dictionary);
+    VOX__destroy__world(world, 0);
+
+    return;
+}
+
+/* Bench - DDA Raycasts Through The World & Brick Tree, Checked Against A Hash Lookup Per Block */
+// the plain traversal every faster path has to agree with
+VOX__ray_hit VOX__bench__cast_ray_block_by_block(VOX__world* world, VOX__3D_position origin, VOX__3D_position direction, f32 maximum_distance) {
+    VOX__ray ray;
+    VOX__block_ID block_ID;
+
+    // walk blocks
+    ray = VOX__create__ray(origin, direction);
+    while (ray.p_distance <= maximum_distance) {
+        block_ID = VOX__read__block_ID_from_world(world, ray.p_block[0], ray.p_block[1], ray.p_block[2]);
+        if (block_ID != VOX__bit__air) {
+            return VOX__create__ray_hit(&ray, block_ID);
+        }
+
+        VOX__step__ray(&ray);
+    }
+
+    return VOX__create_null__ray_hit();
+}
+
+VOX__bt VOX__bench__check_ray_hits_are_equal(VOX__ray_hit a, VOX__ray_hit b) {
+    // both missed
+    if (a.p_hit == VOX__bt__false && b.p_hit == VOX__bt__false) {
+        return VOX__bt__true;
+    }
+
+    return a.p_hit == b.p_hit && a.p_block_ID == b.p_block_ID && a.p_block[0] == b.p_block[0] && a.p_block[1] == b.p_block[1] && a.p_block[2] == b.p_block[2] && a.p_normal[0] == b.p_normal[0] && a.p_normal[1] == b.p_normal[1] && a.p_normal[2] == b.p_normal[2];
+}
+
+void VOX__bench__raycasting(s32 radius, s32 height_radius, u64 ray_count, u64 seed) {
+    VOX__world world;
+    VOX__camera camera;
+    VOX__brick_tree tree;
+    VOX__buffer origins;
+    VOX__buffer directions;
+    VOX__buffer expected;
+    VOX__buffer hits;
+    f32 maximum_distances[2] = { 8.0f, (f32)(radius * VOX__dt__chunk_side_length) };
+    f32 span;
+    u64 random;
+    u64 hit_count;
+    u64 world_mismatch_count;
+    u64 tree_mismatch_count;
+    f64 start;
+    f64 block_seconds;
+    f64 world_seconds;
+    f64 tree_seconds;
+
+    // load a whole world synchronously & build its brick tree
+    world = VOX__create__world(radius, height_radius, 0, ~(u64)0, seed, 0);
+    camera = VOX__create__camera();
+    VOX__update__world(&world, camera, 0);
+    tree = VOX__create__brick_tree__from_world(&world);
+
+    // random rays starting above & around the surface
+    origins = VOX__create__buffer(sizeof(VOX__3D_position) * ray_count);
+    directions = VOX__create__buffer(sizeof(VOX__3D_position) * ray_count);
+    expected = VOX__create__buffer(sizeof(VOX__ray_hit) * ray_count);
+    hits = VOX__create__buffer(sizeof(VOX__ray_hit) * ray_count);
+    span = (f32)(radius * VOX__dt__chunk_side_length);
+    random = seed;
+    for (u64 i = 0; i < ray_count * 6; i++) {
+        random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+        if (i % 6 < 3) {
+            ((f32*)origins.p_data)[i - ((i / 6) * 3)] = ((f32)((random >> 40) & 0xFFFFFF) / (f32)0x1000000) * ((i % 6 == 1) ? 32.0f : span) - ((i % 6 == 1) ? 0.0f : span / 2.0f);
+        } else {
+            ((f32*)directions.p_data)[i - ((i / 6) * 3) - 3] = ((f32)((random >> 40) & 0xFFFFFF) / (f32)0x800000) - 1.0f;
+        }
+    }
+
+    // short picking rays & long line of sight rays
+    printf("raycasting: %lu rays, %lu chunks, brick tree depth %lu\n", ray_count, world.p_chunk_count, tree.p_depth);
+    for (u64 distance = 0; distance < 2; distance++) {
+        // hash lookup per block
+        start = VOX__bench__seconds();
+        for (u64 i = 0; i < ray_count; i++) {
+            ((VOX__ray_hit*)expected.p_data)[i] = VOX__bench__cast_ray_block_by_block(&world, ((VOX__3D_position*)origins.p_data)[i], ((VOX__3D_position*)directions.p_data)[i], maximum_distances[distance]);
+        }
+        block_seconds = VOX__bench__seconds() - start;
+
+        // lookup per chunk with empty chunk jumps
+        hit_count = 0;
+        world_mismatch_count = 0;
+        start = VOX__bench__seconds();
+        for (u64 i = 0; i < ray_count; i++) {
+            ((VOX__ray_hit*)hits.p_data)[i] = VOX__cast__ray_through_world(&world, ((VOX__3D_position*)origins.p_data)[i], ((VOX__3D_position*)directions.p_data)[i], maximum_distances[distance]);
+        }
+        world_seconds = VOX__bench__seconds() - start;
+        for (u64 i = 0; i < ray_count; i++) {
+            hit_count += ((VOX__ray_hit*)expected.p_data)[i].p_hit;
+            world_mismatch_count += VOX__bench__check_ray_hits_are_equal(((VOX__ray_hit*)expected.p_data)[i], ((VOX__ray_hit*)hits.p_data)[i]) == VOX__bt__false;
+        }
+
+        // batch through the brick tree
+        tree_mismatch_count = 0;
+        start = VOX__bench__seconds();
+        VOX__cast__rays_through_brick_tree(&tree, (VOX__3D_position*)origins.p_data, (VOX__3D_position*)directions.p_data, ray_count, maximum_distances[distance], (VOX__ray_hit*)hits.p_data);
+        tree_seconds = VOX__bench__seconds() - start;
+        for (u64 i = 0; i < ray_count; i++) {
+            tree_mismatch_count += VOX__bench__check_ray_hits_are_equal(((VOX__ray_hit*)expected.p_data)[i], ((VOX__ray_hit*)hits.p_data)[i]) == VOX__bt__false;
+        }
+
+        printf("\tup to %.0f blocks: %lu hits, %.2f M rays/s block by block, %.2f M rays/s world (%lu mismatches), %.2f M rays/s brick tree batch (%lu mismatches)\n", maximum_distances[distance], hit_count, (f64)ray_count / block_seconds / 1000000.0, (f64)ray_count / world_seconds / 1000000.0, world_mismatch_count, (f64)ray_count / tree_seconds / 1000000.0, tree_mismatch_count);
+    }
+
+    // clean up
+    VOX__destroy__buffer(origins);
+    VOX__destroy__buffer(directions);
+    VOX__destroy__buffer(expected);
+    VOX__destroy__buffer(hits);
+    VOX__destroy__brick_tree(tree);
+    VOX__destroy__world(world, 0);
+
+    return;
+}
+
+/* Bench - Rapid Block Edits, Coalesced Remeshes & Patched Uploads Against Whole Mesh Uploads */
+// order independent sum over drawn quads, so a patched copy can be checked against a fresh mesh
+u64 VOX__bench__sum_patchable_mesh_quads(VOX__patchable_mesh* patchable_mesh, u64* quad_count) {
+    u64 output;
+
+    // sum live slots
+    output = 0;
+    *quad_count = 0;
+    for (u64 i = 0; i < (*patchable_mesh).p_quad_count; i++) {
+        if ((((u8*)(*patchable_mesh).p_quad_states.p_data)[i] & VOX__qst__live) != 0) {
+            output += VOX__calculate__patchable_mesh_quad_hash((u8*)(*patchable_mesh).p_vertices.p_data + (i * 4 * (*patchable_mesh).p_vertex_size), (*patchable_mesh).p_vertex_size);
+            (*quad_count)++;
+        }
+    }
+
+    return output;
+}
+
+void VOX__bench__block_edits(s32 radius, s32 height_radius, u64 frame_count, u64 edits_per_frame, u64 seed) {
+    VOX__world world;
+    VOX__camera camera;
+    VOX__block_dictionary block_dictionary;
+    VOX__chunk_neighborhood neighborhood;
+    VOX__world_slot* slots;
+    VOX__object_datum mesh;
+    VOX__ray_hit ray_hit;
+    VOX__buffer samples;
+    VOX__range run;
+    u64 vertex_size;
+    u64 random;
+    u64 cursor;
+    u64 remesh_count;
+    u64 patch_count;
+    u64 run_count;
+    u64 whole_byte_count;
+    u64 patched_byte_count;
+    u64 mismatch_count;
+    u64 sample_start;
+    u64 edit_nanoseconds;
+    u64 quad_count;
+    u64 sum;
+    f32 cursor_x;
+    f32 cursor_z;
+    f64 start;
+    f64 seconds;
+
+    // load a whole world synchronously, treating every chunk as already meshed
+    world = VOX__create__world(radius, height_radius, 0, ~(u64)0, seed, 0);
+    camera = VOX__create__camera();
+    VOX__update__world(&world, camera, 0);
+    block_dictionary = VOX__create__test__block_dictionary__1();
+    slots = (VOX__world_slot*)world.p_slots.p_data;
+    for (u64 i = 0; i < world.p_slot_count; i++) {
+        slots[i].p_needs_mesh = VOX__bt__false;
+    }
+    vertex_size = VOX__calculate__vbo_vertex_size(VOX__vft__packed);
+
+    // a player wandering the surface, digging & building around where they look
+    samples = VOX__create__buffer(sizeof(u64) * frame_count);
+    random = seed;
+    cursor_x = 0.5f;
+    cursor_z = 0.5f;
+    remesh_count = 0;
+    patch_count = 0;
+    run_count = 0;
+    whole_byte_count = 0;
+    patched_byte_count = 0;
+    mismatch_count = 0;
+    edit_nanoseconds = 0;
+    start = VOX__bench__seconds();
+    for (u64 frame = 0; frame < frame_count; frame++) {
+        sample_start = VOX__calculate__nanoseconds();
+
+        // edits
+        for (u64 i = 0; i < edits_per_frame; i++) {
+            random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+            cursor_x += ((f32)((random >> 33) % 3) - 1.0f) * 0.25f;
+            cursor_z += ((f32)((random >> 40) % 3) - 1.0f) * 0.25f;
+            ray_hit = VOX__cast__ray_through_world(&world, VOX__create__3D_position(cursor_x + (f32)((random >> 45) % 5) - 2.0f, (f32)(height_radius * VOX__dt__chunk_side_length), cursor_z + (f32)((random >> 50) % 5) - 2.0f), VOX__create__3D_position(0.0f, -1.0f, 0.0f), (f32)(height_radius * VOX__dt__chunk_side_length * 2));
+            if (ray_hit.p_hit == VOX__bt__false) {
+                continue;
+            }
+            if (((random >> 55) & 1) == 0) {
+                VOX__write__block_ID_to_world(&world, ray_hit.p_block[0], ray_hit.p_block[1], ray_hit.p_block[2], VOX__bit__air);
+            } else {
+                VOX__write__block_ID_to_world(&world, ray_hit.p_block[0] + ray_hit.p_normal[0], ray_hit.p_block[1] + ray_hit.p_normal[1], ray_hit.p_block[2] + ray_hit.p_normal[2], VOX__bit__stone);
+            }
+        }
+
+        edit_nanoseconds += VOX__calculate__nanoseconds() - sample_start;
+
+        // one remesh per touched chunk, patched like VOX__send__mesh_to_world_slot does (without the gl calls)
+        for (u64 i = 0; i < world.p_slot_count; i++) {
+            if (slots[i].p_occupied == VOX__bt__false || slots[i].p_needs_mesh == VOX__bt__false) {
+                continue;
+            }
+
+            VOX__read__chunk_neighborhood_from_world(&world, &slots[i], &neighborhood);
+            mesh = VOX__create__object_datum__greedy_mesh_from_chunk__lit(slots[i].p_chunk, &neighborhood, block_dictionary, VOX__create__3D_position(0.0f, 0.0f, 0.0f), VOX__vft__packed, 0, &VOX__global__heap_allocator);
+            whole_byte_count += mesh.p_vertices.p_vertices.p_length + mesh.p_elements.p_elements.p_length;
+            remesh_count++;
+
+            if (slots[i].p_patchable_mesh != 0 && VOX__patch__patchable_mesh(slots[i].p_patchable_mesh, mesh) == VOX__bt__true) {
+                patch_count++;
+            } else {
+                VOX__close__world_slot_patchable_mesh(&slots[i]);
+                if (slots[i].p_edited == VOX__bt__true) {
+                    slots[i].p_patchable_mesh = (VOX__patchable_mesh*)VOX__create__allocation__allocator(&VOX__global__pool_allocator, sizeof(VOX__patchable_mesh));
+                    *slots[i].p_patchable_mesh = VOX__create__patchable_mesh(mesh, vertex_size);
+                } else {
+                    patched_byte_count += mesh.p_vertices.p_vertices.p_length + mesh.p_elements.p_elements.p_length;
+                }
+            }
+            if (slots[i].p_patchable_mesh != 0) {
+                cursor = 0;
+                while (VOX__take__patchable_mesh_changed_run(slots[i].p_patchable_mesh, &cursor, &run) == VOX__bt__true) {
+                    patched_byte_count += run.p_length * ((4 * vertex_size) + (6 * sizeof(VOX__ebo_vertex)));
+                    run_count++;
+                }
+
+                // drawn quads must be exactly the fresh mesh's
+                sum = VOX__bench__sum_patchable_mesh_quads(slots[i].p_patchable_mesh, &quad_count);
+                for (u64 quad = 0; quad < mesh.p_vertices.p_vertex_count / 4; quad++) {
+                    sum -= VOX__calculate__patchable_mesh_quad_hash((u8*)mesh.p_vertices.p_vertices.p_data + (quad * 4 * vertex_size), vertex_size);
+                }
+                mismatch_count += (sum != 0 || quad_count != mesh.p_vertices.p_vertex_count / 4);
+            }
+            VOX__destroy__object_datum(mesh);
+
+            slots[i].p_edited = VOX__bt__false;
+            slots[i].p_needs_mesh = VOX__bt__false;
+        }
+
+        ((u64*)samples.p_data)[frame] = VOX__calculate__nanoseconds() - sample_start;
+    }
+    seconds = VOX__bench__seconds() - start;
+
+    printf("block edits: %lu frames of %lu edits in %.3f s (%.3f ms per frame, %.3f ms editing & relighting), %lu remeshes (%.2f per edit), %lu patched in place\n", frame_count, edits_per_frame, seconds, seconds * 1000.0 / (f64)frame_count, (f64)edit_nanoseconds / 1000000.0 / (f64)frame_count, remesh_count, (f64)remesh_count / (f64)(frame_count * edits_per_frame), patch_count);
+    printf("\tuploads: %lu bytes whole meshes, %lu bytes patched (%.1f%%) in %lu ranges, %lu patched meshes differ from a fresh mesh\n", whole_byte_count, patched_byte_count, 100.0 * (f64)patched_byte_count / (f64)whole_byte_count, run_count, mismatch_count);
+    VOX__print__bench_latency(samples, frame_count);
+
+    // clean up
+    VOX__destroy__buffer(samples);
+    VOX__destroy__block_dictionary(block_dictionary);
+    VOX__destroy__world(world, 0);
+
+    return;
+}
+
+/* Bench - Fixed Tick Simulation Under Uneven Frames, Frame Cap Accuracy & Headless Tick Rates */
+// the plain alternative to sleeping then spinning, one absolute sleep straight to the deadline
+void VOX__bench__wait_by_sleeping(u64 deadline) {
+    struct timespec wake_time;
+
+    wake_time.tv_sec = (time_t)(deadline / 1000000000llu);
+    wake_time.tv_nsec = (long)(deadline % 1000000000llu);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake_time, 0) == EINTR) {}
+
+    return;
+}
+
+void VOX__bench__spin_until(u64 deadline) {
+    while (VOX__calculate__nanoseconds() < deadline) {}
+
+    return;
+}
+
+void VOX__bench__loop_scheduler(u64 ticks_per_second, u64 virtual_frame_count, u64 capped_frame_count, u64 headless_tick_count, u64 seed) {
+    VOX__loop_scheduler loop_scheduler;
+    VOX__loop_scheduler steady_loop_scheduler;
+    VOX__simulation simulation;
+    VOX__simulation steady_simulation;
+    VOX__user_input user_input;
+    VOX__3D_position drawn;
+    VOX__camera camera;
+    VOX__world world;
+    VOX__buffer samples;
+    u64 random;
+    u64 elapsed;
+    u64 total_elapsed;
+    u64 tick_count;
+    u64 target_tick_count;
+    u64 mismatch_count;
+    u64 frame_length;
+    u64 deadline;
+    u64 last_frame_end;
+    u64 now;
+    f32 alpha;
+    f64 start;
+    f64 seconds;
+
+    // uneven frames on a virtual clock, mostly 1 to 30 ms with an occasional 250 ms stall
+    loop_scheduler = VOX__create__loop_scheduler(ticks_per_second, 0, VOX__dt__simulation_maximum_ticks_per_frame);
+    simulation = VOX__create__simulation(VOX__create__3D_position(0.0f, 0.0f, 0.0f), ticks_per_second);
+    user_input = VOX__create_null__user_input();
+    user_input.p_w = VOX__bt__true;
+    random = seed;
+    total_elapsed = 0;
+    mismatch_count = 0;
+    for (u64 frame = 0; frame < virtual_frame_count; frame++) {
+        random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+        elapsed = ((random >> 33) % 64 == 0) ? 250000000llu : 1000000llu + ((random >> 33) % 29000000llu);
+        total_elapsed += elapsed;
+
+        tick_count = VOX__advance__loop_scheduler(&loop_scheduler, elapsed);
+        for (u64 i = 0; i < tick_count; i++) {
+            VOX__tick__simulation(&simulation, user_input);
+        }
+
+        // drawn position must stay between the last two ticks
+        alpha = VOX__calculate__loop_scheduler_alpha(&loop_scheduler);
+        drawn = VOX__calculate__simulation_position(&simulation, alpha);
+        if (alpha < 0.0f || alpha >= 1.0f || drawn.p_z < simulation.p_previous_position.p_z || drawn.p_z > simulation.p_position.p_z) {
+            mismatch_count++;
+        }
+    }
+
+    // every tick owed was either simulated or reported missed
+    if (loop_scheduler.p_tick_count + loop_scheduler.p_missed_tick_count != total_elapsed / loop_scheduler.p_tick_length || simulation.p_tick_count != loop_scheduler.p_tick_count) {
+        mismatch_count++;
+    }
+
+    // the same ticks on steady frames end in the same place, whatever the frame times were
+    steady_loop_scheduler = VOX__create__loop_scheduler(ticks_per_second, 0, VOX__dt__simulation_maximum_ticks_per_frame);
+    steady_simulation = VOX__create__simulation(VOX__create__3D_position(0.0f, 0.0f, 0.0f), ticks_per_second);
+    while (steady_simulation.p_tick_count < simulation.p_tick_count) {
+        tick_count = VOX__advance__loop_scheduler(&steady_loop_scheduler, 16666667llu);
+        for (u64 i = 0; i < tick_count && steady_simulation.p_tick_count < simulation.p_tick_count; i++) {
+            VOX__tick__simulation(&steady_simulation, user_input);
+        }
+    }
+    if (steady_simulation.p_position.p_z != simulation.p_position.p_z) {
+        mismatch_count++;
+    }
+
+    printf("loop scheduler: %lu uneven frames over %.1f s at %lu ticks/s\n", virtual_frame_count, (f64)total_elapsed / 1000000000.0, ticks_per_second);
+    printf("\tticks: %lu run, %lu missed (catch up bound %d a frame), %.2f blocks moved (%.2f on steady frames)\n", loop_scheduler.p_tick_count, loop_scheduler.p_missed_tick_count, VOX__dt__simulation_maximum_ticks_per_frame, simulation.p_position.p_z, steady_simulation.p_position.p_z);
+    printf("\tmismatches: %lu\n", mismatch_count);
+
+    // frame cap accuracy, 240 frames a second with 0 to 3 ms of work, sleeping then spinning vs sleeping alone
+    samples = VOX__create__buffer(sizeof(u64) * capped_frame_count);
+    frame_length = 1000000000llu / 240;
+    for (u64 mode = 0; mode < 2; mode++) {
+        loop_scheduler = VOX__create__loop_scheduler(ticks_per_second, 240, VOX__dt__simulation_maximum_ticks_per_frame);
+        random = seed;
+        deadline = VOX__calculate__nanoseconds();
+        last_frame_end = deadline;
+        for (u64 frame = 0; frame < capped_frame_count; frame++) {
+            VOX__start__loop_scheduler_frame(&loop_scheduler);
+            random = (random * 6364136223846793005llu) + 1442695040888963407llu;
+            VOX__bench__spin_until(VOX__calculate__nanoseconds() + ((random >> 33) % 3000000llu));
+
+            if (mode == 0) {
+                VOX__wait__loop_scheduler_frame(&loop_scheduler);
+            } else {
+                deadline += frame_length;
+                VOX__bench__wait_by_sleeping(deadline);
+            }
+
+            // distance from the ideal frame length
+            now = VOX__calculate__nanoseconds();
+            elapsed = now - last_frame_end;
+            ((u64*)samples.p_data)[frame] = (elapsed > frame_length) ? elapsed - frame_length : frame_length - elapsed;
+            last_frame_end = now;
+        }
+
+        printf("\tframe cap (240 fps, %s): %lu frames\n", (mode == 0) ? "sleep then spin" : "sleep only", capped_frame_count);
+        if (mode == 0) {
+            printf("\t\tslept %.3f s, spun %.3f s, spin length settled at %.3f ms, %lu late\n", (f64)loop_scheduler.p_sleep_time / 1000000000.0, (f64)loop_scheduler.p_spin_time / 1000000000.0, (f64)loop_scheduler.p_spin_length / 1000000.0, loop_scheduler.p_late_frame_count);
+        }
+        printf("\t");
+        VOX__print__bench_latency(samples, capped_frame_count);
+    }
+    VOX__destroy__buffer(samples);
+
+    // headless, ticks back to back with nothing else (a thousand times as many) & then streaming the world every tick
+    for (u64 mode = 0; mode < 2; mode++) {
+        target_tick_count = (mode == 0) ? headless_tick_count * 1000 : headless_tick_count;
+        loop_scheduler = VOX__create__loop_scheduler(ticks_per_second, 0, VOX__dt__simulation_maximum_ticks_per_frame);
+        simulation = VOX__create__simulation(VOX__create__3D_position(0.0f, 0.0f, 0.0f), ticks_per_second);
+        camera = VOX__create__camera();
+        world = VOX__create__world(6, 2, 0, 16, seed, 0);
+
+        start = VOX__bench__seconds();
+        while (simulation.p_tick_count < target_tick_count) {
+            tick_count = VOX__advance__loop_scheduler(&loop_scheduler, loop_scheduler.p_tick_length);
+            for (u64 i = 0; i < tick_count; i++) {
+                VOX__tick__simulation(&simulation, user_input);
+            }
+            if (mode == 1) {
+                camera = VOX__move__camera__to_simulation(camera, &simulation, 1.0f, VOX__create__3D_position(0.0f, 0.0f, 0.0f));
+                VOX__update__world(&world, camera, 0);
+            }
+        }
+        seconds = VOX__bench__seconds() - start;
+
+        printf("\theadless (%s): %lu ticks in %.3f s (%.1f ticks/s, %.1fx real time), %lu chunks loaded\n", (mode == 0) ? "simulation only" : "streaming world", target_tick_count, seconds, (f64)target_tick_count / seconds, ((f64)target_tick_count / (f64)ticks_per_second) / seconds, world.p_total_loads);
+
+        VOX__destroy__world(world, 0);
+    }
+
+    return;
+}
+
+int main() {
+    u64 seed;
+    VOX__chunk_io* chunk_io;
+
+    // fixed seed so runs are comparable
+    seed = 1234;
+
+    // chunk storage & jobs come from pools like in game
+    VOX__open__global_allocators();
+
+    // run benchmarks
+    VOX__bench__allocators(4000000, seed);
+    VOX__bench__range_allocator(1 << 16, seed);
+    VOX__bench__bulk_memory(1 << 28, seed);
+    VOX__bench__terrain_noise(1 << 20, seed);
+    VOX__bench__chunk_fill(16384, seed);
+    VOX__bench__meshing(16384, seed);
+    VOX__bench__lod_meshing(16384, 32, 2, seed);
+    VOX__bench__buffer_creation(4096);
+    VOX__bench__camera_updates(100000);
+    VOX__bench__world_streaming(20000, 0.5f, seed, 0);
+    chunk_io = VOX__open__chunk_io(0, 0);
+    VOX__bench__world_streaming(20000, 0.5f, seed, chunk_io);
+    VOX__close__chunk_io(chunk_io);
+    VOX__bench__frustum_culling(16, 2000);
+    VOX__bench__region_files(seed);
+    VOX__bench__chunk_io(16384, seed);
+    VOX__bench__brick_tree(32, 16, 4000000, seed);
+    VOX__bench__lighting(8, 3, 100000, seed);
+    VOX__bench__raycasting(16, 4, 250000, seed);
+    VOX__bench__block_edits(8, 3, 2000, 8, seed);
+    VOX__bench__loop_scheduler(60, 100000, 1200, 20000, seed);
+
+    // clean up
+    VOX__close__global_allocators();
+
+    return 0;
+}
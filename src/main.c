@@ -8,8 +8,12 @@ int main() {
     // setup error
     error = VOX__create__error__no_error();
 
-    // run engine
-    VOX__play(&error);
+    // run engine (VOXELIZE_HEADLESS_TICKS simulates that many ticks without a window, VOXELIZE_HEADLESS_REAL_TIME paces them to the tick rate)
+    if (VOX__read__environment_u64("VOXELIZE_HEADLESS_TICKS", 0) != 0) {
+        VOX__play__headless(VOX__read__environment_u64("VOXELIZE_TICK_RATE", VOX__dt__simulation_ticks_per_second), VOX__read__environment_u64("VOXELIZE_HEADLESS_TICKS", 0), VOX__read__environment_u64("VOXELIZE_HEADLESS_REAL_TIME", 0) != 0);
+    } else {
+        VOX__play(&error);
+    }
 
     // print error code
     VOX__print__error(error);
@@ -13,13 +13,80 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <math.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <errno.h>
+
+// SIMD (AVX2 kernels are compiled with a target attribute & only run when the processor has AVX2)
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#include <immintrin.h>
+#endif
+
+// Operating System
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+
+// Linux (io_uring is driven through raw system calls, so no library is needed)
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
 
 /* Defines */
 // define type
 typedef enum VOX__dt {
     VOX__dt__opengl_error_info_log_length = 1024,
     VOX__dt__chunk_side_length = 8,
-    VOX__dt__chunk_block_count = VOX__dt__chunk_side_length * VOX__dt__chunk_side_length * VOX__dt__chunk_side_length
+    VOX__dt__chunk_block_count = VOX__dt__chunk_side_length * VOX__dt__chunk_side_length * VOX__dt__chunk_side_length,
+    VOX__dt__block_face_count = 6,
+    VOX__dt__chunk_mesh_maximum_quad_count = VOX__dt__chunk_block_count * VOX__dt__block_face_count,
+    VOX__dt__chunk_lod_count = 4, // level n meshes cells of 2^n blocks a side, the last level must still fit one cell per chunk
+    VOX__dt__chunk_neighborhood_side_length = VOX__dt__chunk_side_length + 2, // one border block on every side
+    VOX__dt__chunk_neighborhood_block_count = VOX__dt__chunk_neighborhood_side_length * VOX__dt__chunk_neighborhood_side_length * VOX__dt__chunk_neighborhood_side_length,
+    VOX__dt__light_maximum = 15, // sky light under open sky, brightest block light
+    VOX__dt__job_deque_capacity = 256,
+    VOX__dt__job_worker_idle_pause_count = 64, // empty sweeps a worker pauses through before it starts yielding its processor
+    VOX__dt__profiler_scope_count = 10,
+    VOX__dt__profiler_frame_history = 1024,
+    VOX__dt__profiler_gpu_query_count = 4,
+    VOX__dt__upload_ring_section_count = 3,
+    VOX__dt__simulation_ticks_per_second = 60,
+    VOX__dt__simulation_maximum_ticks_per_second = 1000000000, // one tick a nanosecond, faster would round the tick length to zero
+    VOX__dt__simulation_maximum_ticks_per_frame = 8, // catch up bound, stalls longer than this are dropped as missed ticks instead of simulated in one burst
+    VOX__dt__player_blocks_per_second = 30,
+    VOX__dt__loop_scheduler_minimum_spin_nanoseconds = 50000, // waits always spin at least this long before the deadline
+    VOX__dt__loop_scheduler_maximum_spin_nanoseconds = 4000000, // sleeps that overshoot further than this are treated as outliers
+    VOX__dt__patchable_mesh_minimum_spare_quad_count = 16, // power of two (also the smallest match table)
+    VOX__dt__patchable_mesh_upload_gap_quad_count = 4, // changed runs this close are uploaded as one range
+    VOX__dt__uniform_count = 1,
+    VOX__dt__frame_uniform_block_binding = 0,
+    VOX__dt__shader_cache_file_magic = 0x56534843, // "CHSV"
+    VOX__dt__shader_cache_file_version = 1,
+    VOX__dt__shader_cache_path_length = 1024,
+    VOX__dt__region_side_length = 16, // in chunks
+    VOX__dt__region_chunk_count = VOX__dt__region_side_length * VOX__dt__region_side_length * VOX__dt__region_side_length,
+    VOX__dt__region_file_magic = 0x52584F56, // "VOXR"
+    VOX__dt__region_file_version = 1,
+    VOX__dt__region_path_length = 1024,
+    VOX__dt__region_chunk_payload_maximum_length = 4 + (2 * VOX__dt__chunk_block_count) + (3 * VOX__dt__chunk_block_count), // header, full palette, one run per block
+    VOX__dt__region_compaction_minimum_dead_length = 1 << 16,
+    VOX__dt__io_ring_entry_count = 64,
+    VOX__dt__chunk_io_batch_length = 32, // requests taken by the io thread at once
+    VOX__dt__chunk_io_maximum_decode_count = 64, // loads past the queue stay in the priority queue where they can still be reordered or cancelled
+    VOX__dt__chunk_io_open_region_count = 64, // must be at least the batch length
+    VOX__dt__brick_tree_maximum_depth = 20, // levels above chunk size, 2^20 chunks a side
+    VOX__dt__brick_cell_side_length = 2, // blocks a side per occupancy bit inside a brick
+    VOX__dt__brick_cells_per_side = VOX__dt__chunk_side_length / VOX__dt__brick_cell_side_length, // 4 a side, 64 bits per brick
+    VOX__dt__terrain_sea_level = -6, // world y, air at or below it is water
+    VOX__dt__terrain_snow_level = 20, // world y, mountain tops above it are snow
+    VOX__dt__terrain_filler_depth = 4, // blocks of biome filler under the top block
+    VOX__dt__terrain_cave_crust_depth = 4 // blocks under the surface caves never open into
 } VOX__dt;
 
 // base types
@@ -59,7 +126,12 @@ typedef enum VOX__et {
     // shaders
     VOX__et__vertex_shader_compilation_failure,
     VOX__et__fragment_shader_compilation_failure,
-    VOX__et__shader_linking_failure
+    VOX__et__shader_linking_failure,
+
+    // files
+    VOX__et__file_open_failure,
+    VOX__et__file_write_failure,
+    VOX__et__file_map_failure
 } VOX__et;
 
 typedef struct VOX__error {
@@ -157,6 +229,36 @@ VOX__error VOX__create__error__shader_linking_failure(char* opengl_log, GLenum o
     return output;
 }
 
+VOX__error VOX__create__error__file_open_failure() {
+    VOX__error output;
+
+    // setup output
+    output.p_type = VOX__et__file_open_failure;
+    output.p_has_extra_data = VOX__bt__false;
+    
+    return output;
+}
+
+VOX__error VOX__create__error__file_write_failure() {
+    VOX__error output;
+
+    // setup output
+    output.p_type = VOX__et__file_write_failure;
+    output.p_has_extra_data = VOX__bt__false;
+    
+    return output;
+}
+
+VOX__error VOX__create__error__file_map_failure() {
+    VOX__error output;
+
+    // setup output
+    output.p_type = VOX__et__file_map_failure;
+    output.p_has_extra_data = VOX__bt__false;
+    
+    return output;
+}
+
 VOX__error VOX__try_create__error__other_opengl() {
     VOX__error output;
     GLenum opengl_error;
@@ -197,16 +299,86 @@ void VOX__print__error(VOX__error error) {
 }
 
 /* Allocation */
+// process wide allocation counters (updated from any thread)
+typedef struct VOX__allocation_counters {
+    _Atomic u64 p_allocation_count;
+    _Atomic u64 p_deallocation_count;
+    _Atomic u64 p_allocated_byte_count;
+    _Atomic u64 p_live_byte_count;
+} VOX__allocation_counters;
+
+VOX__allocation_counters VOX__global__allocation_counters;
+
+// plain copy of the counters at one moment
+typedef struct VOX__allocation_statistics {
+    u64 p_allocation_count;
+    u64 p_deallocation_count;
+    u64 p_allocated_byte_count;
+    u64 p_live_byte_count;
+} VOX__allocation_statistics;
+
+void VOX__record__allocation(VOX__allocation_counters* counters, u64 length) {
+    atomic_fetch_add_explicit(&(*counters).p_allocation_count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&(*counters).p_allocated_byte_count, length, memory_order_relaxed);
+    atomic_fetch_add_explicit(&(*counters).p_live_byte_count, length, memory_order_relaxed);
+
+    return;
+}
+
+void VOX__record__deallocation(VOX__allocation_counters* counters, u64 length) {
+    atomic_fetch_add_explicit(&(*counters).p_deallocation_count, 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&(*counters).p_live_byte_count, length, memory_order_relaxed);
+
+    return;
+}
+
 void* VOX__create__allocation(u64 length) {
+    VOX__record__allocation(&VOX__global__allocation_counters, length);
+
     return malloc(length);
 }
 
 void VOX__destroy__allocation(void* allocation, u64 length) {
+    // null is never handed out by create so it is not counted
+    if (allocation != 0) {
+        VOX__record__deallocation(&VOX__global__allocation_counters, length);
+    }
+
     free(allocation);
 
     return;
 }
 
+VOX__allocation_statistics VOX__read__allocation_statistics__counters(VOX__allocation_counters* counters) {
+    VOX__allocation_statistics output;
+
+    // setup output
+    output.p_allocation_count = atomic_load_explicit(&(*counters).p_allocation_count, memory_order_relaxed);
+    output.p_deallocation_count = atomic_load_explicit(&(*counters).p_deallocation_count, memory_order_relaxed);
+    output.p_allocated_byte_count = atomic_load_explicit(&(*counters).p_allocated_byte_count, memory_order_relaxed);
+    output.p_live_byte_count = atomic_load_explicit(&(*counters).p_live_byte_count, memory_order_relaxed);
+
+    return output;
+}
+
+// every heap allocation in the process, including the memory behind arenas & pools
+VOX__allocation_statistics VOX__read__allocation_statistics() {
+    return VOX__read__allocation_statistics__counters(&VOX__global__allocation_counters);
+}
+
+// counts between two reads
+VOX__allocation_statistics VOX__calculate__allocation_statistics_difference(VOX__allocation_statistics before, VOX__allocation_statistics after) {
+    VOX__allocation_statistics output;
+
+    // setup output
+    output.p_allocation_count = after.p_allocation_count - before.p_allocation_count;
+    output.p_deallocation_count = after.p_deallocation_count - before.p_deallocation_count;
+    output.p_allocated_byte_count = after.p_allocated_byte_count - before.p_allocated_byte_count;
+    output.p_live_byte_count = after.p_live_byte_count - before.p_live_byte_count;
+
+    return output;
+}
+
 /* Deallocate Error */
 void VOX__destroy__error(VOX__error error) {
     if (error.p_has_extra_data == VOX__bt__true) {
@@ -224,15 +396,33 @@ void VOX__destroy__error(VOX__error error) {
     return;
 }
 
-/* Copy Bytes */
+/* Bulk Memory - Copy, Fill & Compare Through The C Library */
+// hand written vector kernels never beat the C library reliably at any engine size (see VOX__bench__bulk_memory)
+// source & destination must not overlap
 void VOX__copy__bytes_to_bytes(void* source, u64 length, void* destination) {
-    for (u64 i = 0; i < length; i++) {
-        ((u8*)destination)[i] = ((u8*)source)[i];
+    if (length != 0) {
+        __builtin_memcpy(destination, source, length);
+    }
+
+    return;
+}
+
+void VOX__fill__bytes(void* destination, u64 length, u8 value) {
+    if (length != 0) {
+        __builtin_memset(destination, value, length);
     }
 
     return;
 }
 
+VOX__bt VOX__check__bytes_are_equal(void* a, void* b, u64 length) {
+    if (length == 0 || __builtin_memcmp(a, b, length) == 0) {
+        return VOX__bt__true;
+    }
+
+    return VOX__bt__false;
+}
+
 /* Strings */
 u64 VOX__string__length_without_null(char* string_start) {
     u64 output;
@@ -247,6 +437,43 @@ u64 VOX__string__length_without_null(char* string_start) {
     return output;
 }
 
+VOX__bt VOX__check__c_strings_are_equal(char* a, char* b) {
+    u64 i;
+
+    // compare up to & including the null
+    i = 0;
+    while (a[i] == b[i]) {
+        if (a[i] == 0) {
+            return VOX__bt__true;
+        }
+
+        i++;
+    }
+
+    return VOX__bt__false;
+}
+
+// unset, empty or non numeric variables give default_value
+u64 VOX__read__environment_u64(char* name, u64 default_value) {
+    char* value;
+    char* end;
+    u64 output;
+
+    // get variable
+    value = getenv(name);
+    if (value == 0 || value[0] == 0) {
+        return default_value;
+    }
+
+    // parse
+    output = (u64)strtoull(value, &end, 10);
+    if (*end != 0) {
+        return default_value;
+    }
+
+    return output;
+}
+
 /* Buffer - A Pointer With A Length */
 typedef struct VOX__buffer {
     void* p_data;
@@ -292,9 +519,7 @@ VOX__buffer VOX__create__buffer_from_buffer__add_null_termination(VOX__buffer bu
     output = VOX__create__buffer(buffer.p_length + 1);
 
     // copy
-    for (u64 i = 0; i < buffer.p_length; i++) {
-        ((char*)output.p_data)[i] = ((char*)buffer.p_data)[i];
-    }
+    VOX__copy__bytes_to_bytes(buffer.p_data, buffer.p_length, output.p_data);
 
     // add null
     ((char*)output.p_data)[buffer.p_length] = 0;
@@ -308,6 +533,331 @@ void VOX__destroy__buffer(VOX__buffer buffer) {
     return;
 }
 
+/* Allocators - Heap, Linear Arena & Fixed Size Pools Behind One Interface */
+// allocator type
+typedef enum VOX__at {
+    VOX__at__heap, // zero initialized allocators are heap allocators
+    VOX__at__arena,
+    VOX__at__pools
+} VOX__at;
+
+typedef struct VOX__pool {
+    u64 p_block_size;
+    u64 p_page_length; // whole blocks
+    void* p_free_blocks; // each free block starts with the address of the next one
+    VOX__buffer p_pages; // void* per page
+    u64 p_page_count;
+    pthread_mutex_t p_lock;
+} VOX__pool;
+
+typedef struct VOX__allocator {
+    VOX__at p_type;
+
+    // arena (one thread only, everything is given back at once by reset)
+    VOX__buffer p_arena;
+    u64 p_arena_offset;
+    u64 p_arena_high_water;
+    VOX__buffer p_arena_overflow; // VOX__buffer per heap allocation made while the arena was full
+    u64 p_arena_overflow_count;
+
+    // pools (thread safe, one pool per power of two block size, longer lengths use the heap)
+    VOX__buffer p_pools; // VOX__pool per size class
+    u64 p_pool_count;
+
+    // counters for allocations made through this allocator
+    VOX__allocation_counters p_counters;
+} VOX__allocator;
+
+// shared allocators, heap allocators until VOX__open__global_allocators
+VOX__allocator VOX__global__heap_allocator;
+VOX__allocator VOX__global__pool_allocator; // chunk storage & jobs
+
+VOX__allocator VOX__create__allocator__heap() {
+    VOX__allocator output;
+
+    // setup output
+    output.p_type = VOX__at__heap;
+    output.p_arena = VOX__create__buffer__add_address(0, 0);
+    output.p_arena_offset = 0;
+    output.p_arena_high_water = 0;
+    output.p_arena_overflow = VOX__create__buffer__add_address(0, 0);
+    output.p_arena_overflow_count = 0;
+    output.p_pools = VOX__create__buffer__add_address(0, 0);
+    output.p_pool_count = 0;
+    atomic_init(&output.p_counters.p_allocation_count, 0);
+    atomic_init(&output.p_counters.p_deallocation_count, 0);
+    atomic_init(&output.p_counters.p_allocated_byte_count, 0);
+    atomic_init(&output.p_counters.p_live_byte_count, 0);
+
+    return output;
+}
+
+VOX__allocator VOX__open__allocator__arena(u64 length) {
+    VOX__allocator output;
+
+    // setup output
+    output = VOX__create__allocator__heap();
+    output.p_type = VOX__at__arena;
+    output.p_arena = VOX__create__buffer(length);
+    output.p_arena_offset = 0;
+    output.p_arena_high_water = 0;
+    output.p_arena_overflow = VOX__create__buffer(sizeof(VOX__buffer) * 16);
+    output.p_arena_overflow_count = 0;
+
+    return output;
+}
+
+// block sizes double from smallest_block_size up to largest_block_size, both powers of two
+VOX__allocator VOX__open__allocator__pools(u64 smallest_block_size, u64 largest_block_size, u64 page_length) {
+    VOX__allocator output;
+    VOX__pool* pools;
+
+    // setup output
+    output = VOX__create__allocator__heap();
+    output.p_type = VOX__at__pools;
+    output.p_pool_count = 0;
+    for (u64 block_size = smallest_block_size; block_size <= largest_block_size; block_size *= 2) {
+        output.p_pool_count++;
+    }
+    output.p_pools = VOX__create__buffer(sizeof(VOX__pool) * output.p_pool_count);
+
+    // setup pools (pages are made on first use)
+    pools = (VOX__pool*)output.p_pools.p_data;
+    for (u64 i = 0; i < output.p_pool_count; i++) {
+        pools[i].p_block_size = smallest_block_size << i;
+        pools[i].p_page_length = (page_length / pools[i].p_block_size) * pools[i].p_block_size;
+        if (pools[i].p_page_length == 0) {
+            pools[i].p_page_length = pools[i].p_block_size;
+        }
+        pools[i].p_free_blocks = 0;
+        pools[i].p_pages = VOX__create__buffer(sizeof(void*) * 4);
+        pools[i].p_page_count = 0;
+        pthread_mutex_init(&pools[i].p_lock, NULL);
+    }
+
+    return output;
+}
+
+// returns p_pool_count when the length is too long for every pool
+u64 VOX__calculate__allocator_pool_index(VOX__allocator* allocator, u64 length) {
+    u64 output;
+
+    // smallest pool that fits
+    output = 0;
+    while (output < (*allocator).p_pool_count && ((VOX__pool*)(*allocator).p_pools.p_data)[output].p_block_size < length) {
+        output++;
+    }
+
+    return output;
+}
+
+void VOX__grow__pool(VOX__pool* pool) {
+    VOX__buffer pages;
+    u8* page;
+    u64 block_count;
+
+    // room for the page address
+    if ((*pool).p_page_count * sizeof(void*) == (*pool).p_pages.p_length) {
+        pages = VOX__create__buffer((*pool).p_pages.p_length * 2);
+        VOX__copy__bytes_to_bytes((*pool).p_pages.p_data, (*pool).p_pages.p_length, pages.p_data);
+        VOX__destroy__buffer((*pool).p_pages);
+        (*pool).p_pages = pages;
+    }
+
+    // new page
+    block_count = (*pool).p_page_length / (*pool).p_block_size;
+    page = (u8*)VOX__create__allocation((*pool).p_page_length);
+    ((void**)(*pool).p_pages.p_data)[(*pool).p_page_count] = page;
+    (*pool).p_page_count++;
+
+    // thread the page's blocks onto the free list
+    for (u64 i = 0; i < block_count; i++) {
+        *(void**)(page + (i * (*pool).p_block_size)) = (*pool).p_free_blocks;
+        (*pool).p_free_blocks = page + (i * (*pool).p_block_size);
+    }
+
+    return;
+}
+
+void* VOX__create__allocation__allocator(VOX__allocator* allocator, u64 length) {
+    void* output;
+    VOX__pool* pool;
+    VOX__buffer overflow;
+    u64 offset;
+    u64 pool_index;
+
+    // count
+    VOX__record__allocation(&(*allocator).p_counters, length);
+
+    switch ((*allocator).p_type) {
+    case VOX__at__arena:
+        // bump a 16 byte aligned offset
+        offset = ((*allocator).p_arena_offset + 15) & ~(u64)15;
+        if (offset + length <= (*allocator).p_arena.p_length) {
+            output = (u8*)(*allocator).p_arena.p_data + offset;
+            (*allocator).p_arena_offset = offset + length;
+            if ((*allocator).p_arena_offset > (*allocator).p_arena_high_water) {
+                (*allocator).p_arena_high_water = (*allocator).p_arena_offset;
+            }
+
+            return output;
+        }
+
+        // full, fall back to the heap until the next reset
+        if ((*allocator).p_arena_overflow_count * sizeof(VOX__buffer) == (*allocator).p_arena_overflow.p_length) {
+            overflow = VOX__create__buffer((*allocator).p_arena_overflow.p_length * 2);
+            VOX__copy__bytes_to_bytes((*allocator).p_arena_overflow.p_data, (*allocator).p_arena_overflow.p_length, overflow.p_data);
+            VOX__destroy__buffer((*allocator).p_arena_overflow);
+            (*allocator).p_arena_overflow = overflow;
+        }
+        ((VOX__buffer*)(*allocator).p_arena_overflow.p_data)[(*allocator).p_arena_overflow_count] = VOX__create__buffer(length);
+        (*allocator).p_arena_overflow_count++;
+
+        return ((VOX__buffer*)(*allocator).p_arena_overflow.p_data)[(*allocator).p_arena_overflow_count - 1].p_data;
+    case VOX__at__pools:
+        // too long for any pool
+        pool_index = VOX__calculate__allocator_pool_index(allocator, length);
+        if (pool_index == (*allocator).p_pool_count) {
+            return VOX__create__allocation(length);
+        }
+
+        // pop a free block
+        pool = &((VOX__pool*)(*allocator).p_pools.p_data)[pool_index];
+        pthread_mutex_lock(&(*pool).p_lock);
+        if ((*pool).p_free_blocks == 0) {
+            VOX__grow__pool(pool);
+        }
+        output = (*pool).p_free_blocks;
+        (*pool).p_free_blocks = *(void**)output;
+        pthread_mutex_unlock(&(*pool).p_lock);
+
+        return output;
+    default:
+        return VOX__create__allocation(length);
+    }
+}
+
+// length must be the length the allocation was created with
+void VOX__destroy__allocation__allocator(VOX__allocator* allocator, void* allocation, u64 length) {
+    VOX__pool* pool;
+    u64 pool_index;
+
+    // null is never handed out by create so it is not counted
+    if (allocation == 0) {
+        return;
+    }
+
+    // count
+    VOX__record__deallocation(&(*allocator).p_counters, length);
+
+    switch ((*allocator).p_type) {
+    case VOX__at__arena:
+        // given back by reset
+        break;
+    case VOX__at__pools:
+        // too long for any pool
+        pool_index = VOX__calculate__allocator_pool_index(allocator, length);
+        if (pool_index == (*allocator).p_pool_count) {
+            VOX__destroy__allocation(allocation, length);
+
+            break;
+        }
+
+        // push the free block
+        pool = &((VOX__pool*)(*allocator).p_pools.p_data)[pool_index];
+        pthread_mutex_lock(&(*pool).p_lock);
+        *(void**)allocation = (*pool).p_free_blocks;
+        (*pool).p_free_blocks = allocation;
+        pthread_mutex_unlock(&(*pool).p_lock);
+
+        break;
+    default:
+        VOX__destroy__allocation(allocation, length);
+
+        break;
+    }
+
+    return;
+}
+
+VOX__buffer VOX__create__buffer__allocator(VOX__allocator* allocator, u64 length) {
+    return VOX__create__buffer__add_address(VOX__create__allocation__allocator(allocator, length), length);
+}
+
+void VOX__destroy__buffer__allocator(VOX__allocator* allocator, VOX__buffer buffer) {
+    VOX__destroy__allocation__allocator(allocator, buffer.p_data, buffer.p_length);
+
+    return;
+}
+
+// gives back every arena allocation at once, does nothing for other allocators
+void VOX__reset__allocator(VOX__allocator* allocator) {
+    if ((*allocator).p_type != VOX__at__arena) {
+        return;
+    }
+
+    // free heap fallbacks
+    for (u64 i = 0; i < (*allocator).p_arena_overflow_count; i++) {
+        VOX__destroy__buffer(((VOX__buffer*)(*allocator).p_arena_overflow.p_data)[i]);
+    }
+    (*allocator).p_arena_overflow_count = 0;
+
+    // rewind
+    (*allocator).p_arena_offset = 0;
+    atomic_store_explicit(&(*allocator).p_counters.p_live_byte_count, 0, memory_order_relaxed);
+
+    return;
+}
+
+VOX__allocation_statistics VOX__read__allocation_statistics__allocator(VOX__allocator* allocator) {
+    return VOX__read__allocation_statistics__counters(&(*allocator).p_counters);
+}
+
+void VOX__close__allocator(VOX__allocator* allocator) {
+    VOX__pool* pools;
+
+    switch ((*allocator).p_type) {
+    case VOX__at__arena:
+        VOX__reset__allocator(allocator);
+        VOX__destroy__buffer((*allocator).p_arena);
+        VOX__destroy__buffer((*allocator).p_arena_overflow);
+
+        break;
+    case VOX__at__pools:
+        pools = (VOX__pool*)(*allocator).p_pools.p_data;
+        for (u64 i = 0; i < (*allocator).p_pool_count; i++) {
+            for (u64 j = 0; j < pools[i].p_page_count; j++) {
+                VOX__destroy__allocation(((void**)pools[i].p_pages.p_data)[j], pools[i].p_page_length);
+            }
+            VOX__destroy__buffer(pools[i].p_pages);
+            pthread_mutex_destroy(&pools[i].p_lock);
+        }
+        VOX__destroy__buffer((*allocator).p_pools);
+
+        break;
+    default:
+        break;
+    }
+
+    // back to a plain heap allocator
+    *allocator = VOX__create__allocator__heap();
+
+    return;
+}
+
+// call before any chunk or job is made & close after the last one is destroyed
+void VOX__open__global_allocators() {
+    VOX__global__pool_allocator = VOX__open__allocator__pools(16, 1024, 65536);
+
+    return;
+}
+
+void VOX__close__global_allocators() {
+    VOX__close__allocator(&VOX__global__pool_allocator);
+
+    return;
+}
+
 /* Graphics - Getting Window Open */
 typedef struct VOX__window_configuration {
     VOX__buffer p_title;
@@ -396,114 +946,488 @@ void VOX__close__graphics__old_window(VOX__graphics window) {
     return;
 }
 
-/* Shaders - Programming The GPU */
-typedef struct VOX__shader {
-    GLuint p_shader_ID;
-    VOX__buffer p_program;
-} VOX__shader;
+/* Shader Cache - Linked Program Binaries Kept On Disk Between Runs */
+typedef struct VOX__shader_cache {
+    VOX__bt p_enabled; // false when no directory was given or the driver cannot hand back program binaries
+    VOX__buffer p_directory; // null terminated
+    u64 p_driver_hash; // vendor, renderer & version strings, a driver update invalidates every entry
+    u64 p_hit_count;
+    u64 p_miss_count;
+} VOX__shader_cache;
+
+// one cache file is this header followed by the driver's program binary
+typedef struct VOX__shader_cache_file_header {
+    u32 p_magic;
+    u32 p_version;
+    u64 p_key;
+    u32 p_binary_format;
+    u32 p_padding;
+    u64 p_binary_length;
+} VOX__shader_cache_file_header;
+
+// fnv-1a, chained by passing the previous hash back in
+u64 VOX__calculate__bytes_hash(u64 hash, VOX__buffer bytes) {
+    for (u64 i = 0; i < bytes.p_length; i++) {
+        hash ^= ((u8*)bytes.p_data)[i];
+        hash *= 0x100000001B3llu;
+    }
 
-typedef struct VOX__shaders_program {
-    GLuint p_program_ID;
-    VOX__shader p_vertex_shader;
-    VOX__shader p_fragment_shader;
-} VOX__shaders_program;
+    return hash;
+}
 
-VOX__shader VOX__create_null__shader() {
-    VOX__shader output;
+u64 VOX__calculate__c_string_hash(u64 hash, const char* string) {
+    if (string == 0) {
+        return hash;
+    }
+
+    // include the terminator so "ab" + "c" does not hash like "a" + "bc"
+    return VOX__calculate__bytes_hash(hash, VOX__create__buffer__add_address((void*)string, VOX__string__length_without_null((char*)string) + 1));
+}
+
+VOX__shader_cache VOX__create_null__shader_cache() {
+    VOX__shader_cache output;
 
     // setup output
-    output.p_shader_ID = 0;
-    output.p_program = VOX__create__buffer__add_address(0, 0);
+    output.p_enabled = VOX__bt__false;
+    output.p_directory = VOX__create__buffer__add_address(0, 0);
+    output.p_driver_hash = 0;
+    output.p_hit_count = 0;
+    output.p_miss_count = 0;
 
     return output;
 }
 
-VOX__shader VOX__compile__shader(VOX__error* error, VOX__buffer shader_data, GLenum shader_type) {
-    VOX__shader output;
-    VOX__buffer shader_with_null_termination;
-    GLint error_log_length;
-    char* opengl_error_log;
+// directory may be 0 to turn caching off, it is created if missing (the opengl context must be current)
+VOX__shader_cache VOX__open__shader_cache(char* directory) {
+    VOX__shader_cache output;
+    GLint binary_format_count;
 
     // setup output
-    output = VOX__create_null__shader();
+    output = VOX__create_null__shader_cache();
 
-    // setup shader copy with null termination
-    shader_with_null_termination = VOX__create__buffer_from_buffer__add_null_termination(shader_data);
-
-    // create shader space
-    output.p_shader_ID = glCreateShader(shader_type);
+    // check support
+    if (directory == 0 || !GLEW_ARB_get_program_binary) {
+        return output;
+    }
+    binary_format_count = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binary_format_count);
+    if (binary_format_count <= 0) {
+        return output;
+    }
 
-    // send program to gpu
-    glShaderSource(output.p_shader_ID, 1, (const GLchar* const*)&shader_with_null_termination.p_data, NULL);
+    // setup directory (already existing is fine, a real failure shows up as every write failing)
+    output.p_directory = VOX__create__buffer_from_buffer__add_null_termination(VOX__create__buffer__add_address(directory, VOX__string__length_without_null(directory)));
+    mkdir(directory, 0755);
 
-    // compile shader
-    glCompileShader(output.p_shader_ID);
+    // binaries are only valid for the exact driver that produced them
+    output.p_driver_hash = 0xCBF29CE484222325llu;
+    output.p_driver_hash = VOX__calculate__c_string_hash(output.p_driver_hash, (const char*)glGetString(GL_VENDOR));
+    output.p_driver_hash = VOX__calculate__c_string_hash(output.p_driver_hash, (const char*)glGetString(GL_RENDERER));
+    output.p_driver_hash = VOX__calculate__c_string_hash(output.p_driver_hash, (const char*)glGetString(GL_VERSION));
+    output.p_driver_hash = VOX__calculate__c_string_hash(output.p_driver_hash, (const char*)glGetString(GL_SHADING_LANGUAGE_VERSION));
+    output.p_enabled = VOX__bt__true;
 
-    // check for errors
-    glGetShaderiv(output.p_shader_ID, GL_INFO_LOG_LENGTH, &error_log_length);
-    if (error_log_length > 0) {
-        opengl_error_log = VOX__create__allocation(sizeof(char) * VOX__dt__opengl_error_info_log_length);
+    return output;
+}
 
-        glGetShaderInfoLog(output.p_shader_ID, VOX__dt__opengl_error_info_log_length, NULL, opengl_error_log);
+u64 VOX__calculate__shader_cache_key(VOX__shader_cache* shader_cache, VOX__buffer vertex_shader, VOX__buffer fragment_shader) {
+    u64 output;
 
-        if (shader_type == GL_VERTEX_SHADER) {
-            *error = VOX__create__error__vertex_shader_compilation_failure(opengl_error_log, glGetError());
-        } else if (shader_type == GL_FRAGMENT_SHADER) {
-            *error = VOX__create__error__fragment_shader_compilation_failure(opengl_error_log, glGetError());
-        }
-    }
+    // setup output
+    output = (*shader_cache).p_driver_hash;
 
-    // delete shader copy
-    VOX__destroy__buffer(shader_with_null_termination);
+    // hash sources (lengths keep the split between the two stages part of the key)
+    output = VOX__calculate__bytes_hash(output, VOX__create__buffer__add_address(&vertex_shader.p_length, sizeof(vertex_shader.p_length)));
+    output = VOX__calculate__bytes_hash(output, vertex_shader);
+    output = VOX__calculate__bytes_hash(output, VOX__create__buffer__add_address(&fragment_shader.p_length, sizeof(fragment_shader.p_length)));
+    output = VOX__calculate__bytes_hash(output, fragment_shader);
 
     return output;
 }
 
-VOX__shaders_program VOX__compile__shaders_program(VOX__error* error, VOX__buffer vertex_shader, VOX__buffer fragment_shader) {
-    VOX__shaders_program output;
-    GLint error_log_length;
-    char* opengl_error_log;
+void VOX__calculate__shader_cache_file_path(VOX__shader_cache* shader_cache, u64 key, char* path, u64 path_length) {
+    snprintf(path, path_length, "%s/%016lx.bin", (char*)(*shader_cache).p_directory.p_data, key);
 
-    // setup output
-    output.p_program_ID = 0;
-    output.p_vertex_shader = VOX__create_null__shader();
-    output.p_fragment_shader = VOX__create_null__shader();
-    
-    // compile shaders
-    output.p_vertex_shader = VOX__compile__shader(error, vertex_shader, GL_VERTEX_SHADER);
-    if (VOX__check__error__has_error_occured(error) == VOX__bt__true) {
-        return output;
-    }
+    return;
+}
 
-    output.p_fragment_shader = VOX__compile__shader(error, fragment_shader, GL_FRAGMENT_SHADER);
-    if (VOX__check__error__has_error_occured(error) == VOX__bt__true) {
-        return output;
+// loads a cached binary into the program, false when there is no usable entry & the program must be compiled
+VOX__bt VOX__read__shader_cache_program(VOX__shader_cache* shader_cache, u64 key, GLuint program_ID) {
+    char path[VOX__dt__shader_cache_path_length];
+    FILE* file;
+    VOX__shader_cache_file_header header;
+    VOX__buffer binary;
+    long file_length;
+    GLint link_status;
+
+    // check cache
+    if ((*shader_cache).p_enabled == VOX__bt__false) {
+        return VOX__bt__false;
     }
 
+    // open file
+    VOX__calculate__shader_cache_file_path(shader_cache, key, path, sizeof(path));
+    file = fopen(path, "rb");
+    if (file == 0) {
+        (*shader_cache).p_miss_count++;
+
+        return VOX__bt__false;
+    }
+
+    // check header against the file so a truncated or foreign entry is never handed to the driver
+    fseek(file, 0, SEEK_END);
+    file_length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.p_magic != VOX__dt__shader_cache_file_magic || header.p_version != VOX__dt__shader_cache_file_version || header.p_key != key || file_length < 0 || header.p_binary_length != (u64)file_length - sizeof(header)) {
+        fclose(file);
+        (*shader_cache).p_miss_count++;
+
+        return VOX__bt__false;
+    }
+
+    // read binary
+    binary = VOX__create__buffer(header.p_binary_length);
+    if (fread(binary.p_data, 1, binary.p_length, file) != binary.p_length) {
+        VOX__destroy__buffer(binary);
+        fclose(file);
+        (*shader_cache).p_miss_count++;
+
+        return VOX__bt__false;
+    }
+    fclose(file);
+
+    // hand binary to driver, which may still refuse it (eg. after a driver update with the same strings)
+    glProgramBinary(program_ID, header.p_binary_format, binary.p_data, (GLsizei)binary.p_length);
+    VOX__destroy__buffer(binary);
+    glGetProgramiv(program_ID, GL_LINK_STATUS, &link_status);
+    if (link_status == GL_FALSE) {
+        (*shader_cache).p_miss_count++;
+
+        return VOX__bt__false;
+    }
+
+    (*shader_cache).p_hit_count++;
+
+    return VOX__bt__true;
+}
+
+// stores a linked program's binary, failing quietly since the cache is only a speed up
+void VOX__write__shader_cache_program(VOX__shader_cache* shader_cache, u64 key, GLuint program_ID) {
+    char path[VOX__dt__shader_cache_path_length];
+    char temporary_path[VOX__dt__shader_cache_path_length];
+    FILE* file;
+    VOX__shader_cache_file_header header;
+    VOX__buffer binary;
+    GLint binary_length;
+    GLsizei written_length;
+    GLenum binary_format;
+    VOX__bt written;
+
+    // check cache
+    if ((*shader_cache).p_enabled == VOX__bt__false) {
+        return;
+    }
+
+    // get binary
+    binary_length = 0;
+    glGetProgramiv(program_ID, GL_PROGRAM_BINARY_LENGTH, &binary_length);
+    if (binary_length <= 0) {
+        return;
+    }
+    binary = VOX__create__buffer(binary_length);
+    written_length = 0;
+    binary_format = 0;
+    glGetProgramBinary(program_ID, binary_length, &written_length, &binary_format, binary.p_data);
+    if (written_length <= 0) {
+        VOX__destroy__buffer(binary);
+
+        return;
+    }
+
+    // setup header
+    header.p_magic = VOX__dt__shader_cache_file_magic;
+    header.p_version = VOX__dt__shader_cache_file_version;
+    header.p_key = key;
+    header.p_binary_format = binary_format;
+    header.p_padding = 0;
+    header.p_binary_length = written_length;
+
+    // write to a private file then rename it into place, so processes sharing the directory never read half an entry
+    VOX__calculate__shader_cache_file_path(shader_cache, key, path, sizeof(path));
+    snprintf(temporary_path, sizeof(temporary_path), "%s/%016lx.%d.tmp", (char*)(*shader_cache).p_directory.p_data, key, (int)getpid());
+    written = VOX__bt__false;
+    file = fopen(temporary_path, "wb");
+    if (file != 0) {
+        written = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(binary.p_data, 1, written_length, file) == (u64)written_length;
+        written = (fclose(file) == 0 && written == VOX__bt__true) ? VOX__bt__true : VOX__bt__false;
+        if (written == VOX__bt__true) {
+            written = rename(temporary_path, path) == 0;
+        }
+        if (written == VOX__bt__false) {
+            remove(temporary_path);
+        }
+    }
+
+    // clean up
+    VOX__destroy__buffer(binary);
+
+    return;
+}
+
+void VOX__close__shader_cache(VOX__shader_cache shader_cache) {
+    if (shader_cache.p_directory.p_data != 0) {
+        VOX__destroy__buffer(shader_cache.p_directory);
+    }
+
+    return;
+}
+
+/* Shaders - Programming The GPU */
+typedef struct VOX__shader {
+    GLuint p_shader_ID;
+    VOX__buffer p_program;
+} VOX__shader;
+
+// uniform type (every loose uniform a program may declare, located once at link time)
+typedef enum VOX__ut {
+    VOX__ut__sampler_2D_array
+} VOX__ut;
+
+char* VOX__read__uniform_name(VOX__ut uniform) {
+    switch (uniform) {
+    case VOX__ut__sampler_2D_array:
+        return "u_sampler_2D_array";
+    }
+
+    return "";
+}
+
+typedef struct VOX__shaders_program {
+    GLuint p_program_ID;
+    VOX__shader p_vertex_shader;
+    VOX__shader p_fragment_shader;
+    GLint p_uniform_locations[VOX__dt__uniform_count]; // -1 when the program does not use the uniform
+    u64 p_cache_key;
+    VOX__bt p_from_cache; // true when linked from a cached binary, there are no shader objects then
+} VOX__shaders_program;
+
+VOX__shader VOX__create_null__shader() {
+    VOX__shader output;
+
+    // setup output
+    output.p_shader_ID = 0;
+    output.p_program = VOX__create__buffer__add_address(0, 0);
+
+    return output;
+}
+
+// sends & starts compiling one stage without waiting for the driver to finish
+VOX__shader VOX__start__shader_compilation(VOX__buffer shader_data, GLenum shader_type) {
+    VOX__shader output;
+    VOX__buffer shader_with_null_termination;
+
+    // setup output
+    output = VOX__create_null__shader();
+
+    // setup shader copy with null termination
+    shader_with_null_termination = VOX__create__buffer_from_buffer__add_null_termination(shader_data);
+
+    // create shader space
+    output.p_shader_ID = glCreateShader(shader_type);
+
+    // send program to gpu
+    glShaderSource(output.p_shader_ID, 1, (const GLchar* const*)&shader_with_null_termination.p_data, NULL);
+
+    // compile shader
+    glCompileShader(output.p_shader_ID);
+
+    // delete shader copy
+    VOX__destroy__buffer(shader_with_null_termination);
+
+    return output;
+}
+
+// waits for a started stage & reports its compile log as an error
+void VOX__check__shader_compilation(VOX__error* error, VOX__shader shader, GLenum shader_type) {
+    GLint error_log_length;
+    char* opengl_error_log;
+
+    // check for errors
+    glGetShaderiv(shader.p_shader_ID, GL_INFO_LOG_LENGTH, &error_log_length);
+    if (error_log_length > 0) {
+        opengl_error_log = VOX__create__allocation(sizeof(char) * VOX__dt__opengl_error_info_log_length);
+
+        glGetShaderInfoLog(shader.p_shader_ID, VOX__dt__opengl_error_info_log_length, NULL, opengl_error_log);
+
+        if (shader_type == GL_VERTEX_SHADER) {
+            *error = VOX__create__error__vertex_shader_compilation_failure(opengl_error_log, glGetError());
+        } else if (shader_type == GL_FRAGMENT_SHADER) {
+            *error = VOX__create__error__fragment_shader_compilation_failure(opengl_error_log, glGetError());
+        }
+    }
+
+    return;
+}
+
+VOX__shader VOX__compile__shader(VOX__error* error, VOX__buffer shader_data, GLenum shader_type) {
+    VOX__shader output;
+
+    // compile & wait
+    output = VOX__start__shader_compilation(shader_data, shader_type);
+    VOX__check__shader_compilation(error, output, shader_type);
+
+    return output;
+}
+
+// fills the uniform table, ties the frame block to its binding point & sets uniforms that never change
+void VOX__read__shaders_program_uniforms(VOX__shaders_program* shaders_program) {
+    GLuint frame_block_index;
+
+    // uniform table
+    for (u64 i = 0; i < VOX__dt__uniform_count; i++) {
+        (*shaders_program).p_uniform_locations[i] = glGetUniformLocation((*shaders_program).p_program_ID, VOX__read__uniform_name(i));
+    }
+
+    // shared camera & frame data
+    frame_block_index = glGetUniformBlockIndex((*shaders_program).p_program_ID, "VOX_frame");
+    if (frame_block_index != GL_INVALID_INDEX) {
+        glUniformBlockBinding((*shaders_program).p_program_ID, frame_block_index, VOX__dt__frame_uniform_block_binding);
+    }
+
+    // block textures always come from texture unit 0
+    if ((*shaders_program).p_uniform_locations[VOX__ut__sampler_2D_array] != -1) {
+        glUseProgram((*shaders_program).p_program_ID);
+        glUniform1i((*shaders_program).p_uniform_locations[VOX__ut__sampler_2D_array], 0);
+        glUseProgram(0);
+    }
+
+    return;
+}
+
+// starts compiling & linking without waiting, or loads the cached binary, so the driver can work on many programs at once
+VOX__shaders_program VOX__start__shaders_program_compilation(VOX__shader_cache* shader_cache, VOX__buffer vertex_shader, VOX__buffer fragment_shader) {
+    VOX__shaders_program output;
+
+    // setup output
+    output.p_program_ID = 0;
+    output.p_vertex_shader = VOX__create_null__shader();
+    output.p_fragment_shader = VOX__create_null__shader();
+    for (u64 i = 0; i < VOX__dt__uniform_count; i++) {
+        output.p_uniform_locations[i] = -1;
+    }
+    output.p_cache_key = 0;
+    output.p_from_cache = VOX__bt__false;
+
     // create shader program
     output.p_program_ID = glCreateProgram();
 
+    // try the cache first
+    if (shader_cache != 0 && (*shader_cache).p_enabled == VOX__bt__true) {
+        output.p_cache_key = VOX__calculate__shader_cache_key(shader_cache, vertex_shader, fragment_shader);
+        output.p_from_cache = VOX__read__shader_cache_program(shader_cache, output.p_cache_key, output.p_program_ID);
+        if (output.p_from_cache == VOX__bt__true) {
+            return output;
+        }
+
+        // ask the driver to keep the binary around for writing back
+        glProgramParameteri(output.p_program_ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    // compile shaders
+    output.p_vertex_shader = VOX__start__shader_compilation(vertex_shader, GL_VERTEX_SHADER);
+    output.p_fragment_shader = VOX__start__shader_compilation(fragment_shader, GL_FRAGMENT_SHADER);
+
     // setup shader linking
     glAttachShader(output.p_program_ID, output.p_vertex_shader.p_shader_ID);
     glAttachShader(output.p_program_ID, output.p_fragment_shader.p_shader_ID);
     
     // link shaders
     glLinkProgram(output.p_program_ID);
-    
-    // check for errors
-    glGetProgramiv(output.p_program_ID, GL_LINK_STATUS, &error_log_length);
 
-    if (error_log_length > 1) {
-        opengl_error_log = VOX__create__allocation(sizeof(char) * VOX__dt__opengl_error_info_log_length);
+    return output;
+}
+
+// waits for a started program, reports errors, fills the cache & locates uniforms
+void VOX__finish__shaders_program_compilation(VOX__error* error, VOX__shader_cache* shader_cache, VOX__shaders_program* shaders_program) {
+    GLint link_status;
+    char* opengl_error_log;
+
+    // compiled programs still need checking
+    if ((*shaders_program).p_from_cache == VOX__bt__false) {
+        // check shaders
+        VOX__check__shader_compilation(error, (*shaders_program).p_vertex_shader, GL_VERTEX_SHADER);
+        if (VOX__check__error__has_error_occured(error) == VOX__bt__true) {
+            return;
+        }
+
+        VOX__check__shader_compilation(error, (*shaders_program).p_fragment_shader, GL_FRAGMENT_SHADER);
+        if (VOX__check__error__has_error_occured(error) == VOX__bt__true) {
+            return;
+        }
+
+        // check linking
+        glGetProgramiv((*shaders_program).p_program_ID, GL_LINK_STATUS, &link_status);
+        if (link_status == GL_FALSE) {
+            opengl_error_log = VOX__create__allocation(sizeof(char) * VOX__dt__opengl_error_info_log_length);
+
+            glGetProgramInfoLog((*shaders_program).p_program_ID, VOX__dt__opengl_error_info_log_length, NULL, opengl_error_log);
 
-        glGetProgramInfoLog(output.p_program_ID, VOX__dt__opengl_error_info_log_length, NULL, opengl_error_log);
+            *error = VOX__create__error__shader_linking_failure(opengl_error_log, glGetError());
 
-        *error = VOX__create__error__shader_linking_failure(opengl_error_log, glGetError());
+            return;
+        }
+
+        // save for next launch
+        if (shader_cache != 0) {
+            VOX__write__shader_cache_program(shader_cache, (*shaders_program).p_cache_key, (*shaders_program).p_program_ID);
+        }
     }
 
+    // locate uniforms once
+    VOX__read__shaders_program_uniforms(shaders_program);
+
+    return;
+}
+
+// shader_cache may be 0
+VOX__shaders_program VOX__compile__shaders_program(VOX__error* error, VOX__shader_cache* shader_cache, VOX__buffer vertex_shader, VOX__buffer fragment_shader) {
+    VOX__shaders_program output;
+
+    // compile & wait
+    output = VOX__start__shaders_program_compilation(shader_cache, vertex_shader, fragment_shader);
+    VOX__finish__shaders_program_compilation(error, shader_cache, &output);
+
     return output;
 }
 
+// starts every program before waiting on any, so drivers with background compiler threads build them side by side
+void VOX__compile__shaders_programs(VOX__error* error, VOX__shader_cache* shader_cache, VOX__buffer* vertex_shaders, VOX__buffer* fragment_shaders, VOX__shaders_program* shaders_programs, u64 count) {
+    VOX__error program_error;
+
+    // let the driver use as many threads as it likes
+    if (GLEW_KHR_parallel_shader_compile) {
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    }
+
+    // start all
+    for (u64 i = 0; i < count; i++) {
+        shaders_programs[i] = VOX__start__shaders_program_compilation(shader_cache, vertex_shaders[i], fragment_shaders[i]);
+    }
+
+    // finish all (every program is left closable, the first error is the one reported)
+    for (u64 i = 0; i < count; i++) {
+        program_error = VOX__create__error__no_error();
+        VOX__finish__shaders_program_compilation(&program_error, shader_cache, &shaders_programs[i]);
+        if (VOX__check__error__has_error_occured(&program_error) == VOX__bt__true && VOX__check__error__has_error_occured(error) == VOX__bt__false) {
+            *error = program_error;
+        } else if (VOX__check__error__has_error_occured(&program_error) == VOX__bt__true) {
+            VOX__destroy__error(program_error);
+        }
+    }
+
+    return;
+}
+
 void VOX__use__use_shaders(VOX__shaders_program shaders_program) {
     glUseProgram(shaders_program.p_program_ID);
 
@@ -555,23 +1479,40 @@ VOX__3D_position VOX__create__3D_position(f32 x, f32 y, f32 z) {
 /* Vertex - One OpenGL Vertex */
 typedef GLfloat VOX__texture_number_type;
 
+// vertex lighting = light | ambient occlusion << 8, light = sky light << 4 | block light (0 to 15 each), ambient occlusion runs 0 (corner enclosed) to 3 (open)
+typedef u32 VOX__vertex_lighting;
+
+VOX__vertex_lighting VOX__create__vertex_lighting(u8 ambient_occlusion, u8 light) {
+    return (VOX__vertex_lighting)light | ((VOX__vertex_lighting)ambient_occlusion << 8);
+}
+
+VOX__vertex_lighting VOX__create__vertex_lighting__full_bright() {
+    return VOX__create__vertex_lighting(3, 0xF0);
+}
+
 typedef struct VOX__vbo_vertex {
     VOX__3D_position p_positional_coordinate;
     VOX__2D_position p_texture_coordinate;
     VOX__texture_number_type p_texture_number;
+    VOX__vertex_lighting p_lighting;
 } VOX__vbo_vertex;
 
-VOX__vbo_vertex VOX__create__vbo_vertex(VOX__3D_position positional_coordinate, VOX__2D_position texture_coordinate, VOX__texture_number_type texture_number) {
+VOX__vbo_vertex VOX__create__vbo_vertex__lit(VOX__3D_position positional_coordinate, VOX__2D_position texture_coordinate, VOX__texture_number_type texture_number, VOX__vertex_lighting lighting) {
     VOX__vbo_vertex output;
 
     // setup output
     output.p_positional_coordinate = positional_coordinate;
     output.p_texture_coordinate = texture_coordinate;
     output.p_texture_number = texture_number;
+    output.p_lighting = lighting;
 
     return output;
 }
 
+VOX__vbo_vertex VOX__create__vbo_vertex(VOX__3D_position positional_coordinate, VOX__2D_position texture_coordinate, VOX__texture_number_type texture_number) {
+    return VOX__create__vbo_vertex__lit(positional_coordinate, texture_coordinate, texture_number, VOX__create__vertex_lighting__full_bright());
+}
+
 void VOX__send__vbo_attributes() {
     // physical positions
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(VOX__vbo_vertex), (void*)0);
@@ -585,6 +1526,69 @@ void VOX__send__vbo_attributes() {
     glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(VOX__vbo_vertex), (void*)(sizeof(VOX__3D_position) + sizeof(VOX__2D_position)));
     glEnableVertexAttribArray(2);
 
+    // lighting (location 3 is taken by the per draw chunk offset)
+    glVertexAttribIPointer(4, 1, GL_UNSIGNED_INT, sizeof(VOX__vbo_vertex), (void*)(sizeof(VOX__3D_position) + sizeof(VOX__2D_position) + sizeof(VOX__texture_number_type)));
+    glEnableVertexAttribArray(4);
+
+    return;
+}
+
+/* Packed Vertex - Compact Integer OpenGL Vertex For Chunk Local Geometry */
+// vertex format type
+typedef enum VOX__vft {
+    VOX__vft__float,
+    VOX__vft__packed
+} VOX__vft;
+
+// position word = x | y << 8 | z << 16 | block face << 24 | ambient occlusion << 27, texture word = u | v << 8 | texture number << 16 | light << 24
+typedef struct VOX__packed_vbo_vertex {
+    u32 p_position;
+    u32 p_texture;
+} VOX__packed_vbo_vertex;
+
+VOX__packed_vbo_vertex VOX__create__packed_vbo_vertex(u8 x, u8 y, u8 z, u8 block_face, u8 texture_u, u8 texture_v, u8 texture_number, VOX__vertex_lighting lighting) {
+    VOX__packed_vbo_vertex output;
+
+    // setup output
+    output.p_position = (u32)x | ((u32)y << 8) | ((u32)z << 16) | ((u32)block_face << 24) | (((lighting >> 8) & 3) << 27);
+    output.p_texture = (u32)texture_u | ((u32)texture_v << 8) | ((u32)texture_number << 16) | ((lighting & 255) << 24);
+
+    return output;
+}
+
+void VOX__send__packed_vbo_attributes() {
+    // packed positions
+    glVertexAttribIPointer(0, 1, GL_UNSIGNED_INT, sizeof(VOX__packed_vbo_vertex), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    // packed texture positions and numbers
+    glVertexAttribIPointer(1, 1, GL_UNSIGNED_INT, sizeof(VOX__packed_vbo_vertex), (void*)sizeof(u32));
+    glEnableVertexAttribArray(1);
+
+    return;
+}
+
+u64 VOX__calculate__vbo_vertex_size(VOX__vft vertex_format) {
+    switch (vertex_format) {
+    case VOX__vft__float:
+        return sizeof(VOX__vbo_vertex);
+    case VOX__vft__packed:
+        return sizeof(VOX__packed_vbo_vertex);
+    }
+
+    return 0;
+}
+
+void VOX__send__vbo_attributes__vertex_format(VOX__vft vertex_format) {
+    switch (vertex_format) {
+    case VOX__vft__float:
+        VOX__send__vbo_attributes();
+        break;
+    case VOX__vft__packed:
+        VOX__send__packed_vbo_attributes();
+        break;
+    }
+
     return;
 }
 
@@ -614,6 +1618,16 @@ VOX__vbo_vertices VOX__create__vbo_vertices(u64 vertex_count) {
     return output;
 }
 
+VOX__vbo_vertices VOX__create__vbo_vertices__packed(u64 vertex_count) {
+    VOX__vbo_vertices output;
+
+    // setup output
+    output.p_vertices = VOX__create__buffer(sizeof(VOX__packed_vbo_vertex) * vertex_count);
+    output.p_vertex_count = vertex_count;
+
+    return output;
+}
+
 void VOX__write__vbo_vertex_to_vbo_vertices(VOX__vbo_vertices vbo_vertices, u64 index, VOX__vbo_vertex vbo_vertex) {
     ((VOX__vbo_vertex*)vbo_vertices.p_vertices.p_data)[index] = vbo_vertex;
 
@@ -624,6 +1638,16 @@ VOX__vbo_vertex VOX__read__vbo_vertex_from_vbo_vertices(VOX__vbo_vertices vbo_ve
     return ((VOX__vbo_vertex*)vbo_vertices.p_vertices.p_data)[index];
 }
 
+void VOX__write__packed_vbo_vertex_to_vbo_vertices(VOX__vbo_vertices vbo_vertices, u64 index, VOX__packed_vbo_vertex packed_vbo_vertex) {
+    ((VOX__packed_vbo_vertex*)vbo_vertices.p_vertices.p_data)[index] = packed_vbo_vertex;
+
+    return;
+}
+
+VOX__packed_vbo_vertex VOX__read__packed_vbo_vertex_from_vbo_vertices(VOX__vbo_vertices vbo_vertices, u64 index) {
+    return ((VOX__packed_vbo_vertex*)vbo_vertices.p_vertices.p_data)[index];
+}
+
 void VOX__draw__send__vbo_vertices_to_gpu(VOX__vbo_vertices vbo_vertecies) {
     glBufferData(GL_ARRAY_BUFFER, vbo_vertecies.p_vertices.p_length, vbo_vertecies.p_vertices.p_data, GL_DYNAMIC_DRAW);
 
@@ -935,40 +1959,1642 @@ void VOX__close__drawable_object(VOX__drawable_object drawable_object) {
     return;
 }
 
-/* 2D Texture Array */
-typedef struct VOX__2D_texture_array {
-    VOX__buffer p_textures;
-    u64 p_single_texture_width;
-    u64 p_single_texture_height;
-    u64 p_texel_byte_count;
-    u64 p_texture_count;
-    GLenum p_texture_type;
-} VOX__2D_texture_array;
+/* Batched Drawable Object - All Datums Of One Object Packed Into One VBO & EBO And Drawn In One Call */
+typedef struct VOX__batched_drawable_object {
+    VOX__object_datum p_batch;
+    VOX__buffer p_element_counts; // GLsizei per datum
+    VOX__buffer p_element_offsets; // byte offset into ebo per datum
+    VOX__buffer p_base_vertices; // GLint per datum
+    u64 p_datums_count;
+    VOX__opengl_object_handle p_handle;
+} VOX__batched_drawable_object;
 
-VOX__2D_texture_array VOX__create__2D_texture_array(u64 texture_count, u64 single_texture_width, u64 single_texture_height, u64 texel_byte_count, GLenum texture_type) {
-    VOX__2D_texture_array output;
+VOX__batched_drawable_object VOX__open__batched_drawable_object__object_data(VOX__object_data object_data) {
+    VOX__batched_drawable_object output;
+    VOX__object_datum datum;
+    u64 vertex_count;
+    u64 element_count;
 
-    // setup textures buffer
-    output.p_textures = VOX__create__buffer(texture_count * single_texture_width * single_texture_height * texel_byte_count);
+    // count total vertices and elements
+    vertex_count = 0;
+    element_count = 0;
+    for (u64 i = 0; i < object_data.p_datums_count; i++) {
+        datum = VOX__read__object_datum_from_object_data(object_data, i);
+        vertex_count += datum.p_vertices.p_vertex_count;
+        element_count += datum.p_elements.p_element_count;
+    }
 
-    // setup other data
-    output.p_single_texture_width = single_texture_width;
-    output.p_single_texture_height = single_texture_height;
-    output.p_texel_byte_count = texel_byte_count;
-    output.p_texture_count = texture_count;
-    output.p_texture_type = texture_type;
+    // setup output
+    output.p_batch = VOX__create_null__object_datum();
+    output.p_batch.p_vertices = VOX__create__vbo_vertices(vertex_count);
+    output.p_batch.p_elements = VOX__create__ebo_vertices(element_count);
+    output.p_element_counts = VOX__create__buffer(sizeof(GLsizei) * object_data.p_datums_count);
+    output.p_element_offsets = VOX__create__buffer(sizeof(void*) * object_data.p_datums_count);
+    output.p_base_vertices = VOX__create__buffer(sizeof(GLint) * object_data.p_datums_count);
+    output.p_datums_count = object_data.p_datums_count;
+
+    // pack datums back to back (indices stay local, each draw range gets a base vertex instead)
+    vertex_count = 0;
+    element_count = 0;
+    for (u64 i = 0; i < object_data.p_datums_count; i++) {
+        datum = VOX__read__object_datum_from_object_data(object_data, i);
 
-    return output;
-}
+        // copy data
+        VOX__copy__bytes_to_bytes(datum.p_vertices.p_vertices.p_data, datum.p_vertices.p_vertices.p_length, output.p_batch.p_vertices.p_vertices.p_data + (sizeof(VOX__vbo_vertex) * vertex_count));
+        VOX__copy__bytes_to_bytes(datum.p_elements.p_elements.p_data, datum.p_elements.p_elements.p_length, output.p_batch.p_elements.p_elements.p_data + (sizeof(VOX__ebo_vertex) * element_count));
 
-u64 VOX__calculate__2D_texture_offset_in_2D_texture_array(VOX__2D_texture_array texture_array, u64 index) {
-    return texture_array.p_single_texture_height * texture_array.p_single_texture_width * texture_array.p_texel_byte_count * index;
-}
+        // setup draw range
+        ((GLsizei*)output.p_element_counts.p_data)[i] = datum.p_elements.p_element_count;
+        ((void**)output.p_element_offsets.p_data)[i] = (void*)(sizeof(VOX__ebo_vertex) * element_count);
+        ((GLint*)output.p_base_vertices.p_data)[i] = vertex_count;
 
-void VOX__write__2D_texture_data_to_2D_texture_array(VOX__2D_texture_array texture_array, VOX__buffer texture_data, u64 index) {
-    VOX__copy__bytes_to_bytes(texture_data.p_data, texture_data.p_length, texture_array.p_textures.p_data + VOX__calculate__2D_texture_offset_in_2D_texture_array(texture_array, index));
+        // next datum
+        vertex_count += datum.p_vertices.p_vertex_count;
+        element_count += datum.p_elements.p_element_count;
+    }
 
-    return;
+    // setup one buffer pair
+    output.p_handle = VOX__open__opengl_object_handle(1);
+
+    return output;
+}
+
+void VOX__send__batched_drawable_object_to_opengl(VOX__batched_drawable_object batched_drawable_object) {
+    // bind vao and its only buffer pair
+    VOX__draw__bind__vao(batched_drawable_object.p_handle);
+    VOX__draw__bind__vbo_and_ebo(batched_drawable_object.p_handle, 0);
+
+    // tell gpu layout of vertices (recorded in the vao)
+    VOX__send__vbo_attributes();
+
+    // send packed buffers
+    VOX__draw__send__vbo_and_ebo_vertices_to_gpu(batched_drawable_object.p_batch.p_vertices, batched_drawable_object.p_batch.p_elements);
+
+    // unbind vao first so it keeps its ebo binding
+    VOX__draw__unbind__vao(batched_drawable_object.p_handle);
+    VOX__draw__unbind__vbo_and_ebo(batched_drawable_object.p_handle, 0);
+
+    return;
+}
+
+void VOX__draw__batched_drawable_object(VOX__batched_drawable_object batched_drawable_object) {
+    // bind vao (buffers and layout come with it)
+    VOX__draw__bind__vao(batched_drawable_object.p_handle);
+
+    // draw every datum in one call
+    glMultiDrawElementsBaseVertex(GL_TRIANGLES, (const GLsizei*)batched_drawable_object.p_element_counts.p_data, GL_UNSIGNED_SHORT, (const void* const*)batched_drawable_object.p_element_offsets.p_data, batched_drawable_object.p_datums_count, (const GLint*)batched_drawable_object.p_base_vertices.p_data);
+
+    // unbind vao
+    VOX__draw__unbind__vao(batched_drawable_object.p_handle);
+
+    return;
+}
+
+void VOX__close__batched_drawable_object(VOX__batched_drawable_object batched_drawable_object) {
+    // deallocate opengl side
+    VOX__close__opengl_object_handle(batched_drawable_object.p_handle);
+
+    // deallocate cpu side
+    VOX__destroy__object_datum(batched_drawable_object.p_batch);
+    VOX__destroy__buffer(batched_drawable_object.p_element_counts);
+    VOX__destroy__buffer(batched_drawable_object.p_element_offsets);
+    VOX__destroy__buffer(batched_drawable_object.p_base_vertices);
+
+    return;
+}
+
+/* Range Allocator - CPU Side Offset Bookkeeping For Sub Allocating One Large Buffer */
+typedef struct VOX__range {
+    u64 p_start;
+    u64 p_length;
+} VOX__range;
+
+VOX__range VOX__create__range(u64 start, u64 length) {
+    VOX__range output;
+
+    // setup output
+    output.p_start = start;
+    output.p_length = length;
+
+    return output;
+}
+
+VOX__range VOX__create_null__range() {
+    return VOX__create__range(0, 0);
+}
+
+VOX__bt VOX__check__range_is_null(VOX__range range) {
+    return range.p_length == 0;
+}
+
+typedef struct VOX__range_allocator {
+    VOX__buffer p_free_ranges; // sorted by start, never adjacent
+    u64 p_free_range_count;
+    u64 p_capacity;
+    u64 p_used;
+} VOX__range_allocator;
+
+VOX__range_allocator VOX__create__range_allocator(u64 capacity) {
+    VOX__range_allocator output;
+
+    // setup output
+    output.p_free_ranges = VOX__create__buffer(sizeof(VOX__range) * 16);
+    output.p_free_range_count = 1;
+    output.p_capacity = capacity;
+    output.p_used = 0;
+
+    // everything starts free
+    ((VOX__range*)output.p_free_ranges.p_data)[0] = VOX__create__range(0, capacity);
+
+    return output;
+}
+
+VOX__range VOX__create__range_allocation(VOX__range_allocator* range_allocator, u64 length) {
+    VOX__range output;
+    VOX__range* free_ranges;
+    u64 best;
+
+    // setup output
+    output = VOX__create_null__range();
+    free_ranges = (VOX__range*)(*range_allocator).p_free_ranges.p_data;
+
+    // empty allocations are null
+    if (length == 0) {
+        return output;
+    }
+
+    // find best fitting free range
+    best = (*range_allocator).p_free_range_count;
+    for (u64 i = 0; i < (*range_allocator).p_free_range_count; i++) {
+        if (free_ranges[i].p_length >= length && (best == (*range_allocator).p_free_range_count || free_ranges[i].p_length < free_ranges[best].p_length)) {
+            best = i;
+        }
+    }
+
+    // out of space
+    if (best == (*range_allocator).p_free_range_count) {
+        return output;
+    }
+
+    // take front of free range
+    output = VOX__create__range(free_ranges[best].p_start, length);
+    free_ranges[best].p_start += length;
+    free_ranges[best].p_length -= length;
+
+    // remove exhausted free range
+    if (free_ranges[best].p_length == 0) {
+        for (u64 i = best; i + 1 < (*range_allocator).p_free_range_count; i++) {
+            free_ranges[i] = free_ranges[i + 1];
+        }
+        (*range_allocator).p_free_range_count--;
+    }
+
+    (*range_allocator).p_used += length;
+
+    return output;
+}
+
+void VOX__destroy__range_allocation(VOX__range_allocator* range_allocator, VOX__range range) {
+    VOX__range* free_ranges;
+    VOX__buffer larger_free_ranges;
+    u64 insert;
+    VOX__bt merges_previous;
+    VOX__bt merges_next;
+
+    // null ranges were never allocated
+    if (VOX__check__range_is_null(range) == VOX__bt__true) {
+        return;
+    }
+
+    // find insertion point
+    free_ranges = (VOX__range*)(*range_allocator).p_free_ranges.p_data;
+    insert = 0;
+    while (insert < (*range_allocator).p_free_range_count && free_ranges[insert].p_start < range.p_start) {
+        insert++;
+    }
+
+    // check neighbors
+    merges_previous = insert > 0 && free_ranges[insert - 1].p_start + free_ranges[insert - 1].p_length == range.p_start;
+    merges_next = insert < (*range_allocator).p_free_range_count && range.p_start + range.p_length == free_ranges[insert].p_start;
+
+    // coalesce or insert
+    if (merges_previous == VOX__bt__true && merges_next == VOX__bt__true) {
+        free_ranges[insert - 1].p_length += range.p_length + free_ranges[insert].p_length;
+        for (u64 i = insert; i + 1 < (*range_allocator).p_free_range_count; i++) {
+            free_ranges[i] = free_ranges[i + 1];
+        }
+        (*range_allocator).p_free_range_count--;
+    } else if (merges_previous == VOX__bt__true) {
+        free_ranges[insert - 1].p_length += range.p_length;
+    } else if (merges_next == VOX__bt__true) {
+        free_ranges[insert].p_start = range.p_start;
+        free_ranges[insert].p_length += range.p_length;
+    } else {
+        // grow free range list
+        if (sizeof(VOX__range) * ((*range_allocator).p_free_range_count + 1) > (*range_allocator).p_free_ranges.p_length) {
+            larger_free_ranges = VOX__create__buffer((*range_allocator).p_free_ranges.p_length * 2);
+            VOX__copy__bytes_to_bytes((*range_allocator).p_free_ranges.p_data, (*range_allocator).p_free_ranges.p_length, larger_free_ranges.p_data);
+            VOX__destroy__buffer((*range_allocator).p_free_ranges);
+            (*range_allocator).p_free_ranges = larger_free_ranges;
+            free_ranges = (VOX__range*)larger_free_ranges.p_data;
+        }
+
+        // shift and insert
+        for (u64 i = (*range_allocator).p_free_range_count; i > insert; i--) {
+            free_ranges[i] = free_ranges[i - 1];
+        }
+        free_ranges[insert] = range;
+        (*range_allocator).p_free_range_count++;
+    }
+
+    (*range_allocator).p_used -= range.p_length;
+
+    return;
+}
+
+void VOX__destroy__range_allocator(VOX__range_allocator range_allocator) {
+    VOX__destroy__buffer(range_allocator.p_free_ranges);
+
+    return;
+}
+
+/* Upload Ring - Mapped Staging Memory Copied Into Place By The GPU, One Section Per Frame In Flight */
+typedef struct VOX__upload_ring {
+    GLuint p_buffer_ID;
+    VOX__bt p_persistent; // mapped once for its whole life, otherwise mapped unsynchronized per write
+    u8* p_mapping; // persistent mapping, 0 when not persistent
+    u64 p_section_length;
+    u64 p_section; // section written this frame
+    u64 p_offset; // next free byte in the section
+    GLsync p_fences[VOX__dt__upload_ring_section_count]; // 0 when the gpu is done with the section
+
+    // counters, reset by whoever reads them
+    u64 p_written_byte_count;
+    u64 p_stall_count; // frames that waited on the gpu to give a section back
+    u64 p_full_count; // writes that did not fit in the section
+} VOX__upload_ring;
+
+// persistent mapping is used when allowed & the driver has buffer storage
+VOX__upload_ring VOX__open__upload_ring(u64 section_length, VOX__bt allow_persistent_mapping) {
+    VOX__upload_ring output;
+    GLbitfield flags;
+
+    // setup output
+    output.p_persistent = (allow_persistent_mapping == VOX__bt__true && GLEW_ARB_buffer_storage) ? VOX__bt__true : VOX__bt__false;
+    output.p_mapping = 0;
+    output.p_section_length = section_length;
+    output.p_section = 0;
+    output.p_offset = 0;
+    for (u64 i = 0; i < VOX__dt__upload_ring_section_count; i++) {
+        output.p_fences[i] = 0;
+    }
+    output.p_written_byte_count = 0;
+    output.p_stall_count = 0;
+    output.p_full_count = 0;
+
+    // setup buffer
+    glGenBuffers(1, &output.p_buffer_ID);
+    glBindBuffer(GL_COPY_READ_BUFFER, output.p_buffer_ID);
+    if (output.p_persistent == VOX__bt__true) {
+        flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_COPY_READ_BUFFER, section_length * VOX__dt__upload_ring_section_count, NULL, flags);
+        output.p_mapping = (u8*)glMapBufferRange(GL_COPY_READ_BUFFER, 0, section_length * VOX__dt__upload_ring_section_count, flags);
+
+        // mapping refused, use the unsynchronized path on a plain buffer
+        if (output.p_mapping == 0) {
+            output.p_persistent = VOX__bt__false;
+            glDeleteBuffers(1, &output.p_buffer_ID);
+            glGenBuffers(1, &output.p_buffer_ID);
+            glBindBuffer(GL_COPY_READ_BUFFER, output.p_buffer_ID);
+        }
+    }
+    if (output.p_persistent == VOX__bt__false) {
+        glBufferData(GL_COPY_READ_BUFFER, section_length * VOX__dt__upload_ring_section_count, NULL, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+    return output;
+}
+
+// returns the ring range written, null when the section has no room left this frame
+VOX__range VOX__write__bytes_to_upload_ring(VOX__upload_ring* upload_ring, void* data, u64 length) {
+    VOX__range output;
+    u8* destination;
+    u64 offset;
+
+    // nothing to write
+    if (length == 0) {
+        return VOX__create_null__range();
+    }
+
+    // 16 byte aligned space in this frame's section
+    offset = ((*upload_ring).p_offset + 15) & ~(u64)15;
+    if (offset + length > (*upload_ring).p_section_length) {
+        (*upload_ring).p_full_count++;
+
+        return VOX__create_null__range();
+    }
+    (*upload_ring).p_offset = offset + length;
+
+    // setup output
+    output.p_start = ((*upload_ring).p_section * (*upload_ring).p_section_length) + offset;
+    output.p_length = length;
+
+    // write (the section's fence already passed so nothing on the gpu reads it)
+    if ((*upload_ring).p_persistent == VOX__bt__true) {
+        VOX__copy__bytes_to_bytes(data, length, (*upload_ring).p_mapping + output.p_start);
+    } else {
+        glBindBuffer(GL_COPY_READ_BUFFER, (*upload_ring).p_buffer_ID);
+        destination = (u8*)glMapBufferRange(GL_COPY_READ_BUFFER, output.p_start, length, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+        if (destination != 0) {
+            VOX__copy__bytes_to_bytes(data, length, destination);
+        }
+        glUnmapBuffer(GL_COPY_READ_BUFFER);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+        // mapping failed, write through the driver instead
+        if (destination == 0) {
+            glBindBuffer(GL_COPY_READ_BUFFER, (*upload_ring).p_buffer_ID);
+            glBufferSubData(GL_COPY_READ_BUFFER, output.p_start, length, data);
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        }
+    }
+
+    (*upload_ring).p_written_byte_count += length;
+
+    return output;
+}
+
+// queues a gpu side copy of a written ring range into another buffer
+void VOX__send__upload_ring_range_to_buffer(VOX__upload_ring* upload_ring, VOX__range ring_range, GLuint buffer_ID, u64 buffer_offset) {
+    glBindBuffer(GL_COPY_READ_BUFFER, (*upload_ring).p_buffer_ID);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer_ID);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, ring_range.p_start, buffer_offset, ring_range.p_length);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+    return;
+}
+
+// call once per frame after the frame's copies are queued
+void VOX__advance__upload_ring(VOX__upload_ring* upload_ring) {
+    GLsync* fence;
+    GLenum status;
+
+    // fence this frame's section
+    (*upload_ring).p_fences[(*upload_ring).p_section] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    // move to the oldest section
+    (*upload_ring).p_section = ((*upload_ring).p_section + 1) % VOX__dt__upload_ring_section_count;
+    (*upload_ring).p_offset = 0;
+
+    // wait for the gpu to finish copying out of it
+    fence = &(*upload_ring).p_fences[(*upload_ring).p_section];
+    if (*fence != 0) {
+        status = glClientWaitSync(*fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED) {
+            (*upload_ring).p_stall_count++;
+            do {
+                status = glClientWaitSync(*fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            } while (status == GL_TIMEOUT_EXPIRED);
+        }
+        glDeleteSync(*fence);
+        *fence = 0;
+    }
+
+    return;
+}
+
+void VOX__close__upload_ring(VOX__upload_ring upload_ring) {
+    // drop fences
+    for (u64 i = 0; i < VOX__dt__upload_ring_section_count; i++) {
+        if (upload_ring.p_fences[i] != 0) {
+            glDeleteSync(upload_ring.p_fences[i]);
+        }
+    }
+
+    // unmap & delete buffer
+    if (upload_ring.p_persistent == VOX__bt__true) {
+        glBindBuffer(GL_COPY_READ_BUFFER, upload_ring.p_buffer_ID);
+        glUnmapBuffer(GL_COPY_READ_BUFFER);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    }
+    glDeleteBuffers(1, &upload_ring.p_buffer_ID);
+
+    return;
+}
+
+/* GPU Arena - One Large VBO & EBO Sub Allocated Between Many Meshes */
+// layout glMultiDrawElementsIndirect reads
+typedef struct VOX__draw_elements_indirect_command {
+    GLuint p_count;
+    GLuint p_instance_count;
+    GLuint p_first_index;
+    GLint p_base_vertex;
+    GLuint p_base_instance;
+} VOX__draw_elements_indirect_command;
+
+typedef struct VOX__gpu_arena_allocation {
+    VOX__range p_vertices;
+    VOX__range p_elements;
+    u64 p_element_count; // drawn from the start of p_elements, patched meshes keep spare room past it
+} VOX__gpu_arena_allocation;
+
+VOX__gpu_arena_allocation VOX__create_null__gpu_arena_allocation() {
+    VOX__gpu_arena_allocation output;
+
+    // setup output
+    output.p_vertices = VOX__create_null__range();
+    output.p_elements = VOX__create_null__range();
+    output.p_element_count = 0;
+
+    return output;
+}
+
+VOX__bt VOX__check__gpu_arena_allocation_is_null(VOX__gpu_arena_allocation gpu_arena_allocation) {
+    return VOX__check__range_is_null(gpu_arena_allocation.p_elements);
+}
+
+typedef struct VOX__gpu_arena {
+    VOX__vft p_vertex_format;
+    VOX__range_allocator p_vertex_ranges;
+    VOX__range_allocator p_element_ranges;
+    VOX__opengl_object_handle p_handle;
+    VOX__buffer p_element_counts; // draw scratch, GLsizei per draw
+    VOX__buffer p_element_offsets; // draw scratch, byte offset per draw
+    VOX__buffer p_base_vertices; // draw scratch, GLint per draw
+
+    // indirect draws (one command per mesh, base instance picks the mesh's offset from the draw offsets buffer)
+    VOX__bt p_uses_indirect_draws;
+    GLuint p_indirect_buffer_ID;
+    GLuint p_draw_offsets_buffer_ID; // VOX__3D_position per draw, instanced attribute 3
+    VOX__buffer p_indirect_commands; // draw scratch, VOX__draw_elements_indirect_command per draw
+    VOX__buffer p_indirect_offsets; // draw scratch, VOX__3D_position per draw
+
+    // staging for uploads, sub data is used when there is no ring or it is full
+    VOX__bt p_uses_upload_ring;
+    VOX__upload_ring p_upload_ring;
+
+    // counters, reset by whoever reads them
+    u64 p_draw_call_count;
+    u64 p_drawn_vertex_count;
+    u64 p_uploaded_byte_count;
+} VOX__gpu_arena;
+
+// upload_ring_section_length of 0 uploads every mesh with sub data
+VOX__gpu_arena VOX__open__gpu_arena(u64 vertex_capacity, u64 element_capacity, VOX__vft vertex_format, u64 upload_ring_section_length) {
+    VOX__gpu_arena output;
+
+    // setup bookkeeping
+    output.p_vertex_format = vertex_format;
+    output.p_vertex_ranges = VOX__create__range_allocator(vertex_capacity);
+    output.p_element_ranges = VOX__create__range_allocator(element_capacity);
+    output.p_element_counts = VOX__create__buffer__add_address(0, 0);
+    output.p_element_offsets = VOX__create__buffer__add_address(0, 0);
+    output.p_base_vertices = VOX__create__buffer__add_address(0, 0);
+    output.p_indirect_commands = VOX__create__buffer__add_address(0, 0);
+    output.p_indirect_offsets = VOX__create__buffer__add_address(0, 0);
+    output.p_uses_indirect_draws = GLEW_ARB_multi_draw_indirect ? VOX__bt__true : VOX__bt__false;
+    output.p_draw_call_count = 0;
+    output.p_drawn_vertex_count = 0;
+    output.p_uploaded_byte_count = 0;
+
+    // setup staging
+    output.p_uses_upload_ring = (upload_ring_section_length > 0) ? VOX__bt__true : VOX__bt__false;
+    if (output.p_uses_upload_ring == VOX__bt__true) {
+        output.p_upload_ring = VOX__open__upload_ring(upload_ring_section_length, VOX__bt__true);
+    }
+
+    // setup one buffer pair
+    output.p_handle = VOX__open__opengl_object_handle(1);
+
+    // specify storage once, meshes are written into it with sub data
+    VOX__draw__bind__vao(output.p_handle);
+    VOX__draw__bind__vbo_and_ebo(output.p_handle, 0);
+    VOX__send__vbo_attributes__vertex_format(vertex_format);
+    glBufferData(GL_ARRAY_BUFFER, VOX__calculate__vbo_vertex_size(vertex_format) * vertex_capacity, NULL, GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(VOX__ebo_vertex) * element_capacity, NULL, GL_STATIC_DRAW);
+
+    // per draw offsets, one zero offset until the first draw writes more
+    glGenBuffers(1, &output.p_draw_offsets_buffer_ID);
+    glBindBuffer(GL_ARRAY_BUFFER, output.p_draw_offsets_buffer_ID);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(VOX__3D_position), &(VOX__3D_position){ 0.0f, 0.0f, 0.0f }, GL_STREAM_DRAW);
+    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(VOX__3D_position), (void*)0);
+    glVertexAttribDivisor(3, 1);
+    glEnableVertexAttribArray(3);
+    VOX__draw__unbind__vao(output.p_handle);
+    VOX__draw__unbind__vbo_and_ebo(output.p_handle, 0);
+
+    // commands are rewritten every draw
+    glGenBuffers(1, &output.p_indirect_buffer_ID);
+
+    return output;
+}
+
+// reserves space without writing anything (nothing is drawn until the element count is set)
+VOX__gpu_arena_allocation VOX__open__gpu_arena_allocation(VOX__gpu_arena* gpu_arena, u64 vertex_count, u64 element_count) {
+    VOX__gpu_arena_allocation output;
+
+    // setup output
+    output = VOX__create_null__gpu_arena_allocation();
+
+    // reserve space
+    output.p_vertices = VOX__create__range_allocation(&(*gpu_arena).p_vertex_ranges, vertex_count);
+    output.p_elements = VOX__create__range_allocation(&(*gpu_arena).p_element_ranges, element_count);
+
+    // arena full (or empty mesh), give back any half reservation
+    if (VOX__check__range_is_null(output.p_vertices) == VOX__bt__true || VOX__check__range_is_null(output.p_elements) == VOX__bt__true) {
+        VOX__destroy__range_allocation(&(*gpu_arena).p_vertex_ranges, output.p_vertices);
+        VOX__destroy__range_allocation(&(*gpu_arena).p_element_ranges, output.p_elements);
+
+        return VOX__create_null__gpu_arena_allocation();
+    }
+
+    return output;
+}
+
+VOX__gpu_arena_allocation VOX__send__object_datum_to_gpu_arena(VOX__gpu_arena* gpu_arena, VOX__object_datum object_datum) {
+    VOX__gpu_arena_allocation output;
+    VOX__range vertex_staging;
+    VOX__range element_staging;
+
+    // reserve space
+    output = VOX__open__gpu_arena_allocation(gpu_arena, object_datum.p_vertices.p_vertex_count, object_datum.p_elements.p_element_count);
+    if (VOX__check__gpu_arena_allocation_is_null(output) == VOX__bt__true) {
+        return output;
+    }
+    output.p_element_count = object_datum.p_elements.p_element_count;
+
+    // stage both buffers in the ring & let the gpu copy them into place
+    if ((*gpu_arena).p_uses_upload_ring == VOX__bt__true) {
+        vertex_staging = VOX__write__bytes_to_upload_ring(&(*gpu_arena).p_upload_ring, object_datum.p_vertices.p_vertices.p_data, object_datum.p_vertices.p_vertices.p_length);
+        element_staging = VOX__write__bytes_to_upload_ring(&(*gpu_arena).p_upload_ring, object_datum.p_elements.p_elements.p_data, object_datum.p_elements.p_elements.p_length);
+        if (VOX__check__range_is_null(vertex_staging) == VOX__bt__false && VOX__check__range_is_null(element_staging) == VOX__bt__false) {
+            VOX__send__upload_ring_range_to_buffer(&(*gpu_arena).p_upload_ring, vertex_staging, ((GLuint*)(*gpu_arena).p_handle.p_vbos.p_data)[0], VOX__calculate__vbo_vertex_size((*gpu_arena).p_vertex_format) * output.p_vertices.p_start);
+            VOX__send__upload_ring_range_to_buffer(&(*gpu_arena).p_upload_ring, element_staging, ((GLuint*)(*gpu_arena).p_handle.p_ebos.p_data)[0], sizeof(VOX__ebo_vertex) * output.p_elements.p_start);
+            (*gpu_arena).p_uploaded_byte_count += object_datum.p_vertices.p_vertices.p_length + object_datum.p_elements.p_elements.p_length;
+
+            return output;
+        }
+    }
+
+    // write into reserved space
+    VOX__draw__bind__vbo_and_ebo((*gpu_arena).p_handle, 0);
+    glBufferSubData(GL_ARRAY_BUFFER, VOX__calculate__vbo_vertex_size((*gpu_arena).p_vertex_format) * output.p_vertices.p_start, object_datum.p_vertices.p_vertices.p_length, object_datum.p_vertices.p_vertices.p_data);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(VOX__ebo_vertex) * output.p_elements.p_start, object_datum.p_elements.p_elements.p_length, object_datum.p_elements.p_elements.p_data);
+    VOX__draw__unbind__vbo_and_ebo((*gpu_arena).p_handle, 0);
+
+    (*gpu_arena).p_uploaded_byte_count += object_datum.p_vertices.p_vertices.p_length + object_datum.p_elements.p_elements.p_length;
+
+    return output;
+}
+
+void VOX__close__gpu_arena_allocation(VOX__gpu_arena* gpu_arena, VOX__gpu_arena_allocation gpu_arena_allocation) {
+    VOX__destroy__range_allocation(&(*gpu_arena).p_vertex_ranges, gpu_arena_allocation.p_vertices);
+    VOX__destroy__range_allocation(&(*gpu_arena).p_element_ranges, gpu_arena_allocation.p_elements);
+
+    return;
+}
+
+void VOX__draw__gpu_arena_allocation(VOX__gpu_arena* gpu_arena, VOX__gpu_arena_allocation gpu_arena_allocation, VOX__3D_position draw_offset) {
+    // nothing to draw
+    if (VOX__check__gpu_arena_allocation_is_null(gpu_arena_allocation) == VOX__bt__true) {
+        return;
+    }
+
+    // draw one mesh with its offset as a constant attribute
+    VOX__draw__bind__vao((*gpu_arena).p_handle);
+    glDisableVertexAttribArray(3);
+    glVertexAttrib3f(3, draw_offset.p_x, draw_offset.p_y, draw_offset.p_z);
+    glDrawElementsBaseVertex(GL_TRIANGLES, gpu_arena_allocation.p_element_count, GL_UNSIGNED_SHORT, (void*)(sizeof(VOX__ebo_vertex) * gpu_arena_allocation.p_elements.p_start), gpu_arena_allocation.p_vertices.p_start);
+    glEnableVertexAttribArray(3);
+    VOX__draw__unbind__vao((*gpu_arena).p_handle);
+
+    (*gpu_arena).p_draw_call_count++;
+    (*gpu_arena).p_drawn_vertex_count += gpu_arena_allocation.p_vertices.p_length;
+
+    return;
+}
+
+// draw_offsets holds one VOX__3D_position per allocation (added to vertex attribute 3), 0 draws every mesh without an offset
+void VOX__draw__gpu_arena_allocations(VOX__gpu_arena* gpu_arena, VOX__gpu_arena_allocation* gpu_arena_allocations, VOX__3D_position* draw_offsets, u64 gpu_arena_allocation_count) {
+    VOX__draw_elements_indirect_command* commands;
+    VOX__3D_position* offsets;
+    u64 draw_count;
+
+    // grow draw scratch
+    if (sizeof(GLint) * gpu_arena_allocation_count > (*gpu_arena).p_base_vertices.p_length) {
+        VOX__destroy__buffer((*gpu_arena).p_element_counts);
+        VOX__destroy__buffer((*gpu_arena).p_element_offsets);
+        VOX__destroy__buffer((*gpu_arena).p_base_vertices);
+        VOX__destroy__buffer((*gpu_arena).p_indirect_commands);
+        VOX__destroy__buffer((*gpu_arena).p_indirect_offsets);
+        (*gpu_arena).p_element_counts = VOX__create__buffer(sizeof(GLsizei) * gpu_arena_allocation_count);
+        (*gpu_arena).p_element_offsets = VOX__create__buffer(sizeof(void*) * gpu_arena_allocation_count);
+        (*gpu_arena).p_base_vertices = VOX__create__buffer(sizeof(GLint) * gpu_arena_allocation_count);
+        (*gpu_arena).p_indirect_commands = VOX__create__buffer(sizeof(VOX__draw_elements_indirect_command) * gpu_arena_allocation_count);
+        (*gpu_arena).p_indirect_offsets = VOX__create__buffer(sizeof(VOX__3D_position) * gpu_arena_allocation_count);
+    }
+
+    // setup draw ranges
+    commands = (VOX__draw_elements_indirect_command*)(*gpu_arena).p_indirect_commands.p_data;
+    offsets = (VOX__3D_position*)(*gpu_arena).p_indirect_offsets.p_data;
+    draw_count = 0;
+    for (u64 i = 0; i < gpu_arena_allocation_count; i++) {
+        if (VOX__check__gpu_arena_allocation_is_null(gpu_arena_allocations[i]) == VOX__bt__true) {
+            continue;
+        }
+
+        if ((*gpu_arena).p_uses_indirect_draws == VOX__bt__true) {
+            commands[draw_count].p_count = gpu_arena_allocations[i].p_element_count;
+            commands[draw_count].p_instance_count = 1;
+            commands[draw_count].p_first_index = gpu_arena_allocations[i].p_elements.p_start;
+            commands[draw_count].p_base_vertex = gpu_arena_allocations[i].p_vertices.p_start;
+            commands[draw_count].p_base_instance = draw_count;
+            offsets[draw_count] = (draw_offsets == 0) ? VOX__create__3D_position(0.0f, 0.0f, 0.0f) : draw_offsets[i];
+        } else if (draw_offsets != 0) {
+            // no base instance, each mesh is its own draw
+            VOX__draw__gpu_arena_allocation(gpu_arena, gpu_arena_allocations[i], draw_offsets[i]);
+
+            continue;
+        } else {
+            ((GLsizei*)(*gpu_arena).p_element_counts.p_data)[draw_count] = gpu_arena_allocations[i].p_element_count;
+            ((void**)(*gpu_arena).p_element_offsets.p_data)[draw_count] = (void*)(sizeof(VOX__ebo_vertex) * gpu_arena_allocations[i].p_elements.p_start);
+            ((GLint*)(*gpu_arena).p_base_vertices.p_data)[draw_count] = gpu_arena_allocations[i].p_vertices.p_start;
+        }
+        (*gpu_arena).p_drawn_vertex_count += gpu_arena_allocations[i].p_vertices.p_length;
+        draw_count++;
+    }
+
+    // nothing visible (or already drawn one by one)
+    if (draw_count == 0) {
+        return;
+    }
+
+    // draw every mesh in one call
+    VOX__draw__bind__vao((*gpu_arena).p_handle);
+    if ((*gpu_arena).p_uses_indirect_draws == VOX__bt__true) {
+        // replace last draw's commands & offsets
+        glBindBuffer(GL_ARRAY_BUFFER, (*gpu_arena).p_draw_offsets_buffer_ID);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(VOX__3D_position) * draw_count, offsets, GL_STREAM_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, (*gpu_arena).p_indirect_buffer_ID);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(VOX__draw_elements_indirect_command) * draw_count, commands, GL_STREAM_DRAW);
+
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, (void*)0, draw_count, 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    } else {
+        glMultiDrawElementsBaseVertex(GL_TRIANGLES, (const GLsizei*)(*gpu_arena).p_element_counts.p_data, GL_UNSIGNED_SHORT, (const void* const*)(*gpu_arena).p_element_offsets.p_data, draw_count, (const GLint*)(*gpu_arena).p_base_vertices.p_data);
+    }
+    VOX__draw__unbind__vao((*gpu_arena).p_handle);
+
+    (*gpu_arena).p_draw_call_count++;
+
+    return;
+}
+
+// call once per frame after the frame's uploads
+void VOX__advance__gpu_arena_uploads(VOX__gpu_arena* gpu_arena) {
+    if ((*gpu_arena).p_uses_upload_ring == VOX__bt__true) {
+        VOX__advance__upload_ring(&(*gpu_arena).p_upload_ring);
+    }
+
+    return;
+}
+
+void VOX__close__gpu_arena(VOX__gpu_arena gpu_arena) {
+    // deallocate opengl side
+    VOX__close__opengl_object_handle(gpu_arena.p_handle);
+    glDeleteBuffers(1, &gpu_arena.p_draw_offsets_buffer_ID);
+    glDeleteBuffers(1, &gpu_arena.p_indirect_buffer_ID);
+    if (gpu_arena.p_uses_upload_ring == VOX__bt__true) {
+        VOX__close__upload_ring(gpu_arena.p_upload_ring);
+    }
+
+    // deallocate cpu side
+    VOX__destroy__range_allocator(gpu_arena.p_vertex_ranges);
+    VOX__destroy__range_allocator(gpu_arena.p_element_ranges);
+    VOX__destroy__buffer(gpu_arena.p_element_counts);
+    VOX__destroy__buffer(gpu_arena.p_element_offsets);
+    VOX__destroy__buffer(gpu_arena.p_base_vertices);
+    VOX__destroy__buffer(gpu_arena.p_indirect_commands);
+    VOX__destroy__buffer(gpu_arena.p_indirect_offsets);
+
+    return;
+}
+
+/* Patchable Meshes - CPU Copies Of Quad Meshes, Updated In Place By Uploading Only The Quads That Changed */
+// quad state type (flags)
+typedef enum VOX__qst {
+    VOX__qst__free = 0,
+    VOX__qst__live = 1,
+    VOX__qst__changed = 2, // differs from what the gpu holds
+    VOX__qst__matched = 4 // patch scratch, an identical quad is in the new mesh
+} VOX__qst;
+
+// slots hold 4 vertices & 6 elements each, unchanged quads never move & freed slots draw as degenerate triangles until reused
+typedef struct VOX__patchable_mesh {
+    u64 p_vertex_size;
+    u64 p_quad_capacity;
+    u64 p_quad_count; // slots drawn, up to the last live one
+    u64 p_free_quad_count; // freed slots below the quad count
+    VOX__buffer p_vertices; // what the gpu holds (or will after the next upload), 4 per slot
+    VOX__buffer p_elements; // VOX__ebo_vertex, 6 per slot
+    VOX__buffer p_quad_states; // u8 VOX__qst flags per slot
+} VOX__patchable_mesh;
+
+// mesh must be made of quads written in order (4 vertices & 6 elements each, as chunk meshing does)
+VOX__patchable_mesh VOX__create__patchable_mesh(VOX__object_datum mesh, u64 vertex_size) {
+    VOX__patchable_mesh output;
+
+    // room to grow by half before the allocation has to move
+    output.p_vertex_size = vertex_size;
+    output.p_quad_count = mesh.p_vertices.p_vertex_count / 4;
+    output.p_quad_capacity = output.p_quad_count + (output.p_quad_count / 2) + VOX__dt__patchable_mesh_minimum_spare_quad_count;
+    output.p_free_quad_count = 0;
+
+    // copy quads, every one still has to be uploaded
+    output.p_vertices = VOX__create__buffer(output.p_quad_capacity * 4 * vertex_size);
+    output.p_elements = VOX__create__buffer(output.p_quad_capacity * 6 * sizeof(VOX__ebo_vertex));
+    output.p_quad_states = VOX__create__buffer(output.p_quad_capacity);
+    VOX__copy__bytes_to_bytes(mesh.p_vertices.p_vertices.p_data, output.p_quad_count * 4 * vertex_size, output.p_vertices.p_data);
+    VOX__copy__bytes_to_bytes(mesh.p_elements.p_elements.p_data, output.p_quad_count * 6 * sizeof(VOX__ebo_vertex), output.p_elements.p_data);
+    for (u64 i = 0; i < output.p_quad_capacity; i++) {
+        ((u8*)output.p_quad_states.p_data)[i] = (i < output.p_quad_count) ? (VOX__qst__live | VOX__qst__changed) : VOX__qst__free;
+    }
+
+    return output;
+}
+
+u64 VOX__calculate__patchable_mesh_quad_hash(u8* vertices, u64 vertex_size) {
+    return VOX__calculate__bytes_hash(0xCBF29CE484222325llu, VOX__create__buffer__add_address(vertices, 4 * vertex_size));
+}
+
+// same vertices & the same split (elements relative to each quad's first vertex)
+VOX__bt VOX__check__patchable_mesh_quads_are_equal(u8* a_vertices, VOX__ebo_vertex* a_elements, u64 a_first_vertex, u8* b_vertices, VOX__ebo_vertex* b_elements, u64 b_first_vertex, u64 vertex_size) {
+    // compare split
+    for (u64 i = 0; i < 6; i++) {
+        if (a_elements[i].p_index - a_first_vertex != b_elements[i].p_index - b_first_vertex) {
+            return VOX__bt__false;
+        }
+    }
+
+    return VOX__check__bytes_are_equal(a_vertices, b_vertices, 4 * vertex_size);
+}
+
+// returns false without changing anything when the new mesh does not fit or too many slots sit freed (recreate it then)
+VOX__bt VOX__patch__patchable_mesh(VOX__patchable_mesh* patchable_mesh, VOX__object_datum mesh) {
+    VOX__buffer table;
+    VOX__buffer new_slots;
+    u8* states;
+    u8* vertices;
+    VOX__ebo_vertex* elements;
+    u8* mesh_vertices;
+    VOX__ebo_vertex* mesh_elements;
+    u64 quad_vertex_length;
+    u64 new_quad_count;
+    u64 table_mask;
+    u64 index;
+    u64 slot;
+    u64 next_free;
+
+    // setup variables
+    states = (u8*)(*patchable_mesh).p_quad_states.p_data;
+    vertices = (u8*)(*patchable_mesh).p_vertices.p_data;
+    elements = (VOX__ebo_vertex*)(*patchable_mesh).p_elements.p_data;
+    mesh_vertices = (u8*)mesh.p_vertices.p_vertices.p_data;
+    mesh_elements = (VOX__ebo_vertex*)mesh.p_elements.p_elements.p_data;
+    quad_vertex_length = 4 * (*patchable_mesh).p_vertex_size;
+    new_quad_count = mesh.p_vertices.p_vertex_count / 4;
+
+    // too big, or half the drawn slots are holes
+    if (new_quad_count > (*patchable_mesh).p_quad_capacity || ((*patchable_mesh).p_free_quad_count > VOX__dt__patchable_mesh_minimum_spare_quad_count && (*patchable_mesh).p_free_quad_count * 2 > (*patchable_mesh).p_quad_count)) {
+        return VOX__bt__false;
+    }
+
+    // index live slots by their vertices (open addressing at or below half full, u32 slot + 1 per entry)
+    table_mask = VOX__dt__patchable_mesh_minimum_spare_quad_count;
+    while (table_mask < ((*patchable_mesh).p_quad_count - (*patchable_mesh).p_free_quad_count) * 2) {
+        table_mask *= 2;
+    }
+    table = VOX__create__buffer(sizeof(u32) * table_mask);
+    table_mask--;
+    VOX__fill__bytes(table.p_data, table.p_length, 0);
+    for (u64 i = 0; i < (*patchable_mesh).p_quad_count; i++) {
+        if ((states[i] & VOX__qst__live) != 0) {
+            index = VOX__calculate__patchable_mesh_quad_hash(vertices + (i * quad_vertex_length), (*patchable_mesh).p_vertex_size) & table_mask;
+            while (((u32*)table.p_data)[index] != 0) {
+                index = (index + 1) & table_mask;
+            }
+            ((u32*)table.p_data)[index] = (u32)i + 1;
+        }
+    }
+
+    // match new quads to identical live slots (u32 slot + 1 per new quad, 0 for new quads)
+    new_slots = VOX__create__buffer(sizeof(u32) * (new_quad_count + 1));
+    for (u64 i = 0; i < new_quad_count; i++) {
+        ((u32*)new_slots.p_data)[i] = 0;
+        index = VOX__calculate__patchable_mesh_quad_hash(mesh_vertices + (i * quad_vertex_length), (*patchable_mesh).p_vertex_size) & table_mask;
+        while (((u32*)table.p_data)[index] != 0) {
+            slot = ((u32*)table.p_data)[index] - 1;
+            if ((states[slot] & VOX__qst__matched) == 0 && VOX__check__patchable_mesh_quads_are_equal(vertices + (slot * quad_vertex_length), elements + (slot * 6), slot * 4, mesh_vertices + (i * quad_vertex_length), mesh_elements + (i * 6), i * 4, (*patchable_mesh).p_vertex_size) == VOX__bt__true) {
+                states[slot] |= VOX__qst__matched;
+                ((u32*)new_slots.p_data)[i] = (u32)slot + 1;
+
+                break;
+            }
+            index = (index + 1) & table_mask;
+        }
+    }
+
+    // free live slots the new mesh no longer has
+    for (u64 i = 0; i < (*patchable_mesh).p_quad_count; i++) {
+        if ((states[i] & VOX__qst__live) == 0) {
+            continue;
+        }
+
+        if ((states[i] & VOX__qst__matched) != 0) {
+            states[i] &= ~VOX__qst__matched;
+        } else {
+            states[i] = VOX__qst__free | VOX__qst__changed;
+            for (u64 j = 0; j < 6; j++) {
+                elements[(i * 6) + j] = VOX__create__ebo_vertex((VOX__ebo_index)(i * 4));
+            }
+            (*patchable_mesh).p_free_quad_count++;
+        }
+    }
+
+    // place new quads in freed slots first, then past the end
+    next_free = 0;
+    for (u64 i = 0; i < new_quad_count; i++) {
+        if (((u32*)new_slots.p_data)[i] != 0) {
+            continue;
+        }
+
+        while (next_free < (*patchable_mesh).p_quad_count && (states[next_free] & VOX__qst__live) != 0) {
+            next_free++;
+        }
+        if (next_free < (*patchable_mesh).p_quad_count) {
+            slot = next_free;
+            (*patchable_mesh).p_free_quad_count--;
+        } else {
+            slot = (*patchable_mesh).p_quad_count;
+            (*patchable_mesh).p_quad_count++;
+        }
+
+        VOX__copy__bytes_to_bytes(mesh_vertices + (i * quad_vertex_length), quad_vertex_length, vertices + (slot * quad_vertex_length));
+        for (u64 j = 0; j < 6; j++) {
+            elements[(slot * 6) + j] = VOX__create__ebo_vertex((VOX__ebo_index)(mesh_elements[(i * 6) + j].p_index - (i * 4) + (slot * 4)));
+        }
+        states[slot] = VOX__qst__live | VOX__qst__changed;
+    }
+
+    // freed slots at the end are simply no longer drawn
+    while ((*patchable_mesh).p_quad_count > 0 && (states[(*patchable_mesh).p_quad_count - 1] & VOX__qst__live) == 0) {
+        (*patchable_mesh).p_quad_count--;
+        (*patchable_mesh).p_free_quad_count--;
+        states[(*patchable_mesh).p_quad_count] = VOX__qst__free;
+    }
+
+    // clean up
+    VOX__destroy__buffer(table);
+    VOX__destroy__buffer(new_slots);
+
+    return VOX__bt__true;
+}
+
+// next run of changed slots from the cursor (runs a few unchanged slots apart are joined), clears their flags, false when none are left
+VOX__bt VOX__take__patchable_mesh_changed_run(VOX__patchable_mesh* patchable_mesh, u64* cursor, VOX__range* run) {
+    u8* states;
+    u64 end;
+
+    // find run start
+    states = (u8*)(*patchable_mesh).p_quad_states.p_data;
+    while (*cursor < (*patchable_mesh).p_quad_count && (states[*cursor] & VOX__qst__changed) == 0) {
+        (*cursor)++;
+    }
+    if (*cursor >= (*patchable_mesh).p_quad_count) {
+        return VOX__bt__false;
+    }
+
+    // extend past short gaps
+    (*run).p_start = *cursor;
+    end = *cursor + 1;
+    for (u64 i = end; i < (*patchable_mesh).p_quad_count && i <= end + VOX__dt__patchable_mesh_upload_gap_quad_count; i++) {
+        if ((states[i] & VOX__qst__changed) != 0) {
+            end = i + 1;
+        }
+    }
+    (*run).p_length = end - (*run).p_start;
+
+    // clear flags
+    for (u64 i = (*run).p_start; i < end; i++) {
+        states[i] &= ~VOX__qst__changed;
+    }
+    *cursor = end;
+
+    return VOX__bt__true;
+}
+
+// allocation must hold the mesh's full capacity (see VOX__open__gpu_arena_allocation__patchable_mesh)
+void VOX__send__patchable_mesh_to_gpu_arena(VOX__patchable_mesh* patchable_mesh, VOX__gpu_arena* gpu_arena, VOX__gpu_arena_allocation* gpu_arena_allocation) {
+    VOX__range run;
+    u64 cursor;
+
+    // write changed runs into place
+    cursor = 0;
+    VOX__draw__bind__vbo_and_ebo((*gpu_arena).p_handle, 0);
+    while (VOX__take__patchable_mesh_changed_run(patchable_mesh, &cursor, &run) == VOX__bt__true) {
+        glBufferSubData(GL_ARRAY_BUFFER, (*patchable_mesh).p_vertex_size * (((*gpu_arena_allocation).p_vertices.p_start) + (run.p_start * 4)), (*patchable_mesh).p_vertex_size * run.p_length * 4, (u8*)(*patchable_mesh).p_vertices.p_data + ((*patchable_mesh).p_vertex_size * run.p_start * 4));
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(VOX__ebo_vertex) * ((*gpu_arena_allocation).p_elements.p_start + (run.p_start * 6)), sizeof(VOX__ebo_vertex) * run.p_length * 6, (VOX__ebo_vertex*)(*patchable_mesh).p_elements.p_data + (run.p_start * 6));
+        (*gpu_arena).p_uploaded_byte_count += run.p_length * ((4 * (*patchable_mesh).p_vertex_size) + (6 * sizeof(VOX__ebo_vertex)));
+    }
+    VOX__draw__unbind__vbo_and_ebo((*gpu_arena).p_handle, 0);
+
+    // draw every slot in use
+    (*gpu_arena_allocation).p_element_count = (*patchable_mesh).p_quad_count * 6;
+
+    return;
+}
+
+VOX__gpu_arena_allocation VOX__open__gpu_arena_allocation__patchable_mesh(VOX__gpu_arena* gpu_arena, VOX__patchable_mesh* patchable_mesh) {
+    return VOX__open__gpu_arena_allocation(gpu_arena, (*patchable_mesh).p_quad_capacity * 4, (*patchable_mesh).p_quad_capacity * 6);
+}
+
+void VOX__destroy__patchable_mesh(VOX__patchable_mesh patchable_mesh) {
+    VOX__destroy__buffer(patchable_mesh.p_vertices);
+    VOX__destroy__buffer(patchable_mesh.p_elements);
+    VOX__destroy__buffer(patchable_mesh.p_quad_states);
+
+    return;
+}
+
+/* Time - Monotonic Clock */
+u64 VOX__calculate__nanoseconds() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return ((u64)time.tv_sec * 1000000000llu) + (u64)time.tv_nsec;
+}
+
+/* Loop Scheduler - Fixed Rate Simulation Ticks, Frame Caps & Sleep Then Spin Waits */
+// vsync mode type (values are what SDL_GL_SetSwapInterval takes)
+typedef enum VOX__vmt {
+    VOX__vmt__adaptive = -1, // waits for vblank unless the frame is already late, then tears instead of stalling a whole refresh
+    VOX__vmt__off = 0,
+    VOX__vmt__on = 1
+} VOX__vmt;
+
+// needs a current opengl context, returns the mode actually set (adaptive falls back to on, on falls back to off)
+VOX__vmt VOX__set__vsync_mode(VOX__vmt vsync_mode) {
+    if (vsync_mode == VOX__vmt__adaptive && SDL_GL_SetSwapInterval(VOX__vmt__adaptive) == 0) {
+        return VOX__vmt__adaptive;
+    }
+    if (vsync_mode != VOX__vmt__off && SDL_GL_SetSwapInterval(VOX__vmt__on) == 0) {
+        return VOX__vmt__on;
+    }
+    SDL_GL_SetSwapInterval(VOX__vmt__off);
+
+    return VOX__vmt__off;
+}
+
+// "off", "on" or "adaptive", anything else (or no name) gives default_vsync_mode
+VOX__vmt VOX__read__vsync_mode_from_name(char* name, VOX__vmt default_vsync_mode) {
+    if (name == 0) {
+        return default_vsync_mode;
+    }
+    if (VOX__check__c_strings_are_equal(name, "off") == VOX__bt__true) {
+        return VOX__vmt__off;
+    }
+    if (VOX__check__c_strings_are_equal(name, "on") == VOX__bt__true) {
+        return VOX__vmt__on;
+    }
+    if (VOX__check__c_strings_are_equal(name, "adaptive") == VOX__bt__true) {
+        return VOX__vmt__adaptive;
+    }
+
+    return default_vsync_mode;
+}
+
+char* VOX__read__vsync_mode_name(VOX__vmt vsync_mode) {
+    switch (vsync_mode) {
+    case VOX__vmt__adaptive:
+        return "adaptive";
+    case VOX__vmt__off:
+        return "off";
+    case VOX__vmt__on:
+        return "on";
+    }
+
+    return "unknown";
+}
+
+typedef struct VOX__loop_scheduler {
+    // simulation
+    u64 p_tick_length; // nanoseconds
+    u64 p_maximum_ticks_per_frame;
+    u64 p_accumulator; // nanoseconds not simulated yet, always under one tick after a frame starts
+    u64 p_last_time;
+
+    // pacing
+    u64 p_frame_length; // nanoseconds, 0 leaves frames uncapped
+    u64 p_frame_deadline; // when the current frame may end
+    u64 p_spin_length; // worst recent sleep overshoot, the last part of every wait spins instead of sleeping
+
+    // counters
+    u64 p_frame_count;
+    u64 p_tick_count;
+    u64 p_missed_tick_count; // dropped by the catch up bound
+    u64 p_late_frame_count; // capped frames that ended after their deadline
+    u64 p_frame_tick_count; // ran in the latest frame
+    u64 p_frame_missed_tick_count; // dropped in the latest frame
+    u64 p_sleep_time; // nanoseconds
+    u64 p_spin_time; // nanoseconds
+} VOX__loop_scheduler;
+
+// 0 gives the default rate, rates past one tick a nanosecond are clamped (both come straight from settings)
+u64 VOX__clamp__ticks_per_second(u64 ticks_per_second) {
+    if (ticks_per_second == 0) {
+        return VOX__dt__simulation_ticks_per_second;
+    }
+    if (ticks_per_second > VOX__dt__simulation_maximum_ticks_per_second) {
+        return VOX__dt__simulation_maximum_ticks_per_second;
+    }
+
+    return ticks_per_second;
+}
+
+// maximum_frames_per_second of 0 leaves frames uncapped (vsync or the work itself sets the rate)
+VOX__loop_scheduler VOX__create__loop_scheduler(u64 ticks_per_second, u64 maximum_frames_per_second, u64 maximum_ticks_per_frame) {
+    VOX__loop_scheduler output;
+
+    // setup simulation
+    output.p_tick_length = 1000000000llu / ticks_per_second;
+    output.p_maximum_ticks_per_frame = maximum_ticks_per_frame;
+    output.p_accumulator = 0;
+    output.p_last_time = VOX__calculate__nanoseconds();
+
+    // setup pacing (spins a whole millisecond until sleeps have been measured)
+    output.p_frame_length = (maximum_frames_per_second == 0) ? 0 : 1000000000llu / maximum_frames_per_second;
+    output.p_frame_deadline = output.p_last_time;
+    output.p_spin_length = 1000000;
+
+    // setup counters
+    output.p_frame_count = 0;
+    output.p_tick_count = 0;
+    output.p_missed_tick_count = 0;
+    output.p_late_frame_count = 0;
+    output.p_frame_tick_count = 0;
+    output.p_frame_missed_tick_count = 0;
+    output.p_sleep_time = 0;
+    output.p_spin_time = 0;
+
+    return output;
+}
+
+// adds elapsed nanoseconds & returns how many ticks to run before drawing (headless runs pass one tick length per frame to simulate as fast as possible)
+u64 VOX__advance__loop_scheduler(VOX__loop_scheduler* loop_scheduler, u64 elapsed) {
+    u64 output;
+
+    // take whole ticks out of the accumulator
+    (*loop_scheduler).p_accumulator += elapsed;
+    output = (*loop_scheduler).p_accumulator / (*loop_scheduler).p_tick_length;
+    (*loop_scheduler).p_accumulator -= output * (*loop_scheduler).p_tick_length;
+
+    // drop what is past the catch up bound, simulating it would make the next frame later still
+    (*loop_scheduler).p_frame_missed_tick_count = 0;
+    if (output > (*loop_scheduler).p_maximum_ticks_per_frame) {
+        (*loop_scheduler).p_frame_missed_tick_count = output - (*loop_scheduler).p_maximum_ticks_per_frame;
+        output = (*loop_scheduler).p_maximum_ticks_per_frame;
+    }
+
+    // count
+    (*loop_scheduler).p_frame_count++;
+    (*loop_scheduler).p_frame_tick_count = output;
+    (*loop_scheduler).p_tick_count += output;
+    (*loop_scheduler).p_missed_tick_count += (*loop_scheduler).p_frame_missed_tick_count;
+
+    return output;
+}
+
+// call once at the start of every frame
+u64 VOX__start__loop_scheduler_frame(VOX__loop_scheduler* loop_scheduler) {
+    u64 now;
+    u64 elapsed;
+
+    // time since the last frame started
+    now = VOX__calculate__nanoseconds();
+    elapsed = now - (*loop_scheduler).p_last_time;
+    (*loop_scheduler).p_last_time = now;
+
+    return VOX__advance__loop_scheduler(loop_scheduler, elapsed);
+}
+
+// how far drawing is between the last two ticks, in [0, 1)
+f32 VOX__calculate__loop_scheduler_alpha(VOX__loop_scheduler* loop_scheduler) {
+    return (f32)((f64)(*loop_scheduler).p_accumulator / (f64)(*loop_scheduler).p_tick_length);
+}
+
+void VOX__record__loop_scheduler_sleep_overshoot(VOX__loop_scheduler* loop_scheduler, u64 overshoot) {
+    // jump up to new worst cases, decay slowly back down so one quiet sleep does not undo them
+    if (overshoot > VOX__dt__loop_scheduler_maximum_spin_nanoseconds) {
+        return;
+    }
+    if (overshoot > (*loop_scheduler).p_spin_length) {
+        (*loop_scheduler).p_spin_length = overshoot;
+    } else {
+        (*loop_scheduler).p_spin_length -= ((*loop_scheduler).p_spin_length - overshoot) / 16;
+    }
+    if ((*loop_scheduler).p_spin_length < VOX__dt__loop_scheduler_minimum_spin_nanoseconds) {
+        (*loop_scheduler).p_spin_length = VOX__dt__loop_scheduler_minimum_spin_nanoseconds;
+    }
+
+    return;
+}
+
+// call once at the end of every frame, holds it until the frame cap allows the next one
+void VOX__wait__loop_scheduler_frame(VOX__loop_scheduler* loop_scheduler) {
+    u64 now;
+    u64 start;
+    u64 wake;
+    struct timespec wake_time;
+
+    // uncapped
+    if ((*loop_scheduler).p_frame_length == 0) {
+        return;
+    }
+
+    // deadlines stay on a fixed cadence so an early frame does not shift every later one
+    (*loop_scheduler).p_frame_deadline += (*loop_scheduler).p_frame_length;
+    now = VOX__calculate__nanoseconds();
+    start = now;
+
+    // late, start over from now after a long stall instead of rushing frames to catch up
+    if (now >= (*loop_scheduler).p_frame_deadline) {
+        (*loop_scheduler).p_late_frame_count++;
+        if (now - (*loop_scheduler).p_frame_deadline >= (*loop_scheduler).p_frame_length) {
+            (*loop_scheduler).p_frame_deadline = now;
+        }
+
+        return;
+    }
+
+    // sleep until just before the deadline (the scheduler wakes threads late by up to the spin length)
+    if ((*loop_scheduler).p_frame_deadline - now > (*loop_scheduler).p_spin_length) {
+        wake = (*loop_scheduler).p_frame_deadline - (*loop_scheduler).p_spin_length;
+        wake_time.tv_sec = (time_t)(wake / 1000000000llu);
+        wake_time.tv_nsec = (long)(wake % 1000000000llu);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake_time, 0) == EINTR) {}
+        now = VOX__calculate__nanoseconds();
+        VOX__record__loop_scheduler_sleep_overshoot(loop_scheduler, (now > wake) ? now - wake : 0);
+        (*loop_scheduler).p_sleep_time += now - start;
+        start = now;
+    }
+
+    // spin the rest
+    while (now < (*loop_scheduler).p_frame_deadline) {
+#if defined(__SSE2__)
+        _mm_pause();
+#endif
+        now = VOX__calculate__nanoseconds();
+    }
+    (*loop_scheduler).p_spin_time += now - start;
+    if (now - (*loop_scheduler).p_frame_deadline >= VOX__dt__loop_scheduler_minimum_spin_nanoseconds) {
+        (*loop_scheduler).p_late_frame_count++;
+    }
+
+    return;
+}
+
+void VOX__print__loop_scheduler(VOX__loop_scheduler* loop_scheduler) {
+    printf("Voxelize Loop (%lu frames, %lu ticks at %.1f ticks/s):\n", (*loop_scheduler).p_frame_count, (*loop_scheduler).p_tick_count, 1000000000.0 / (f64)(*loop_scheduler).p_tick_length);
+    printf("\tmissed ticks: %lu, late frames: %lu, slept %.3f s, spun %.3f s (spin length %.3f ms)\n", (*loop_scheduler).p_missed_tick_count, (*loop_scheduler).p_late_frame_count, (f64)(*loop_scheduler).p_sleep_time / 1000000000.0, (f64)(*loop_scheduler).p_spin_time / 1000000000.0, (f64)(*loop_scheduler).p_spin_length / 1000000.0);
+
+    return;
+}
+
+/* Profiler - Frame Scope Timings, GPU Timers & Draw Counters */
+// profiler scope type
+typedef enum VOX__pst {
+    VOX__pst__frame,
+    VOX__pst__input,
+    VOX__pst__simulate,
+    VOX__pst__camera,
+    VOX__pst__world,
+    VOX__pst__upload,
+    VOX__pst__draw,
+    VOX__pst__swap,
+    VOX__pst__wait,
+    VOX__pst__gpu
+} VOX__pst;
+
+char* VOX__read__profiler_scope_name(VOX__pst profiler_scope) {
+    switch (profiler_scope) {
+    case VOX__pst__frame:
+        return "frame";
+    case VOX__pst__input:
+        return "input";
+    case VOX__pst__simulate:
+        return "simulate";
+    case VOX__pst__camera:
+        return "camera";
+    case VOX__pst__world:
+        return "world";
+    case VOX__pst__upload:
+        return "upload";
+    case VOX__pst__draw:
+        return "draw";
+    case VOX__pst__swap:
+        return "swap";
+    case VOX__pst__wait:
+        return "wait";
+    case VOX__pst__gpu:
+        return "gpu";
+    }
+
+    return "unknown";
+}
+
+typedef struct VOX__profiler_frame {
+    u64 p_scope_starts[VOX__dt__profiler_scope_count]; // nanoseconds since profiler opened
+    u64 p_scope_times[VOX__dt__profiler_scope_count]; // nanoseconds, gpu is filled in a few frames late
+    u64 p_draw_call_count;
+    u64 p_drawn_vertex_count;
+    u64 p_uploaded_byte_count;
+    u64 p_tick_count;
+    u64 p_missed_tick_count;
+} VOX__profiler_frame;
+
+typedef struct VOX__profiler {
+    VOX__buffer p_frames; // ring of the most recent frames
+    u64 p_frame_count;
+    u64 p_open_time;
+    VOX__profiler_frame p_current;
+
+    // gpu timers (results are read back without stalling, so they lag behind)
+    VOX__bt p_gpu_timers_available;
+    GLuint p_gpu_queries[VOX__dt__profiler_gpu_query_count];
+    u64 p_gpu_query_frames[VOX__dt__profiler_gpu_query_count];
+    VOX__bt p_gpu_query_pending[VOX__dt__profiler_gpu_query_count];
+    VOX__bt p_gpu_query_running;
+} VOX__profiler;
+
+VOX__profiler_frame VOX__create_null__profiler_frame() {
+    VOX__profiler_frame output;
+
+    // setup output
+    for (u64 i = 0; i < VOX__dt__profiler_scope_count; i++) {
+        output.p_scope_starts[i] = 0;
+        output.p_scope_times[i] = 0;
+    }
+    output.p_draw_call_count = 0;
+    output.p_drawn_vertex_count = 0;
+    output.p_uploaded_byte_count = 0;
+    output.p_tick_count = 0;
+    output.p_missed_tick_count = 0;
+
+    return output;
+}
+
+// use_gpu_timers needs a current opengl context, pass false when headless
+VOX__profiler VOX__open__profiler(VOX__bt use_gpu_timers) {
+    VOX__profiler output;
+
+    // setup output
+    output.p_frames = VOX__create__buffer(sizeof(VOX__profiler_frame) * VOX__dt__profiler_frame_history);
+    output.p_frame_count = 0;
+    output.p_open_time = VOX__calculate__nanoseconds();
+    output.p_current = VOX__create_null__profiler_frame();
+
+    // setup gpu timers
+    output.p_gpu_timers_available = use_gpu_timers == VOX__bt__true && GLEW_ARB_timer_query;
+    output.p_gpu_query_running = VOX__bt__false;
+    for (u64 i = 0; i < VOX__dt__profiler_gpu_query_count; i++) {
+        output.p_gpu_queries[i] = 0;
+        output.p_gpu_query_frames[i] = 0;
+        output.p_gpu_query_pending[i] = VOX__bt__false;
+    }
+    if (output.p_gpu_timers_available == VOX__bt__true) {
+        glGenQueries(VOX__dt__profiler_gpu_query_count, output.p_gpu_queries);
+    }
+
+    return output;
+}
+
+VOX__profiler_frame* VOX__read__profiler_frame(VOX__profiler* profiler, u64 frame) {
+    return &((VOX__profiler_frame*)(*profiler).p_frames.p_data)[frame % VOX__dt__profiler_frame_history];
+}
+
+u64 VOX__calculate__profiler_recorded_frame_count(VOX__profiler* profiler) {
+    return ((*profiler).p_frame_count < VOX__dt__profiler_frame_history) ? (*profiler).p_frame_count : VOX__dt__profiler_frame_history;
+}
+
+void VOX__start__profiler_scope(VOX__profiler* profiler, VOX__pst profiler_scope) {
+    (*profiler).p_current.p_scope_starts[profiler_scope] = VOX__calculate__nanoseconds() - (*profiler).p_open_time;
+
+    return;
+}
+
+void VOX__stop__profiler_scope(VOX__profiler* profiler, VOX__pst profiler_scope) {
+    (*profiler).p_current.p_scope_times[profiler_scope] += (VOX__calculate__nanoseconds() - (*profiler).p_open_time) - (*profiler).p_current.p_scope_starts[profiler_scope];
+
+    return;
+}
+
+void VOX__start__profiler_frame(VOX__profiler* profiler) {
+    (*profiler).p_current = VOX__create_null__profiler_frame();
+    VOX__start__profiler_scope(profiler, VOX__pst__frame);
+
+    return;
+}
+
+void VOX__start__profiler_gpu_timer(VOX__profiler* profiler) {
+    u64 query;
+
+    // only one timer per frame, and only into a query that has been read back
+    query = (*profiler).p_frame_count % VOX__dt__profiler_gpu_query_count;
+    if ((*profiler).p_gpu_timers_available == VOX__bt__false || (*profiler).p_gpu_query_pending[query] == VOX__bt__true) {
+        return;
+    }
+
+    (*profiler).p_current.p_scope_starts[VOX__pst__gpu] = VOX__calculate__nanoseconds() - (*profiler).p_open_time;
+    glBeginQuery(GL_TIME_ELAPSED, (*profiler).p_gpu_queries[query]);
+    (*profiler).p_gpu_query_running = VOX__bt__true;
+
+    return;
+}
+
+void VOX__stop__profiler_gpu_timer(VOX__profiler* profiler) {
+    u64 query;
+
+    // no timer started this frame
+    if ((*profiler).p_gpu_query_running == VOX__bt__false) {
+        return;
+    }
+
+    query = (*profiler).p_frame_count % VOX__dt__profiler_gpu_query_count;
+    glEndQuery(GL_TIME_ELAPSED);
+    (*profiler).p_gpu_query_frames[query] = (*profiler).p_frame_count;
+    (*profiler).p_gpu_query_pending[query] = VOX__bt__true;
+    (*profiler).p_gpu_query_running = VOX__bt__false;
+
+    return;
+}
+
+void VOX__record__profiler_gpu_arena_counters(VOX__profiler* profiler, VOX__gpu_arena* gpu_arena) {
+    // take counters
+    (*profiler).p_current.p_draw_call_count += (*gpu_arena).p_draw_call_count;
+    (*profiler).p_current.p_drawn_vertex_count += (*gpu_arena).p_drawn_vertex_count;
+    (*profiler).p_current.p_uploaded_byte_count += (*gpu_arena).p_uploaded_byte_count;
+
+    // reset counters
+    (*gpu_arena).p_draw_call_count = 0;
+    (*gpu_arena).p_drawn_vertex_count = 0;
+    (*gpu_arena).p_uploaded_byte_count = 0;
+
+    return;
+}
+
+void VOX__record__profiler_loop_scheduler_counters(VOX__profiler* profiler, VOX__loop_scheduler* loop_scheduler) {
+    (*profiler).p_current.p_tick_count += (*loop_scheduler).p_frame_tick_count;
+    (*profiler).p_current.p_missed_tick_count += (*loop_scheduler).p_frame_missed_tick_count;
+
+    return;
+}
+
+void VOX__stop__profiler_frame(VOX__profiler* profiler) {
+    GLint available;
+    GLuint64 elapsed;
+
+    // finish frame
+    VOX__stop__profiler_scope(profiler, VOX__pst__frame);
+    *VOX__read__profiler_frame(profiler, (*profiler).p_frame_count) = (*profiler).p_current;
+    (*profiler).p_frame_count++;
+
+    // collect finished gpu timers into their frames (if still in history)
+    if ((*profiler).p_gpu_timers_available == VOX__bt__true) {
+        for (u64 i = 0; i < VOX__dt__profiler_gpu_query_count; i++) {
+            if ((*profiler).p_gpu_query_pending[i] == VOX__bt__false) {
+                continue;
+            }
+
+            glGetQueryObjectiv((*profiler).p_gpu_queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available == GL_FALSE) {
+                continue;
+            }
+
+            glGetQueryObjectui64v((*profiler).p_gpu_queries[i], GL_QUERY_RESULT, &elapsed);
+            if ((*profiler).p_frame_count - (*profiler).p_gpu_query_frames[i] <= VOX__dt__profiler_frame_history) {
+                (*VOX__read__profiler_frame(profiler, (*profiler).p_gpu_query_frames[i])).p_scope_times[VOX__pst__gpu] = elapsed;
+            }
+            (*profiler).p_gpu_query_pending[i] = VOX__bt__false;
+        }
+    }
+
+    return;
+}
+
+int VOX__compare__u64(const void* a, const void* b) {
+    return (*(u64*)a > *(u64*)b) - (*(u64*)a < *(u64*)b);
+}
+
+// percentile is in [0, 100], result is in nanoseconds
+u64 VOX__calculate__profiler_scope_percentile(VOX__profiler* profiler, VOX__pst profiler_scope, f64 percentile, VOX__allocator* scratch_allocator) {
+    u64 output;
+    VOX__buffer times;
+    u64 count;
+
+    // no frames yet
+    count = VOX__calculate__profiler_recorded_frame_count(profiler);
+    if (count == 0) {
+        return 0;
+    }
+
+    // sort recent times
+    times = VOX__create__buffer__allocator(scratch_allocator, sizeof(u64) * count);
+    for (u64 i = 0; i < count; i++) {
+        ((u64*)times.p_data)[i] = ((VOX__profiler_frame*)(*profiler).p_frames.p_data)[i].p_scope_times[profiler_scope];
+    }
+    qsort(times.p_data, count, sizeof(u64), VOX__compare__u64);
+
+    // nearest rank
+    output = ((u64*)times.p_data)[(u64)((percentile / 100.0) * (f64)(count - 1) + 0.5)];
+
+    VOX__destroy__buffer__allocator(scratch_allocator, times);
+
+    return output;
+}
+
+u64 VOX__calculate__profiler_missed_tick_count(VOX__profiler* profiler) {
+    u64 output;
+
+    // over the kept frames
+    output = 0;
+    for (u64 i = 0; i < VOX__calculate__profiler_recorded_frame_count(profiler); i++) {
+        output += ((VOX__profiler_frame*)(*profiler).p_frames.p_data)[i].p_missed_tick_count;
+    }
+
+    return output;
+}
+
+void VOX__print__profiler(VOX__profiler* profiler) {
+    VOX__profiler_frame* latest;
+
+    printf("Voxelize Profile (%lu frames, last %lu kept):\n", (*profiler).p_frame_count, VOX__calculate__profiler_recorded_frame_count(profiler));
+
+    // percentiles per scope
+    for (u64 i = 0; i < VOX__dt__profiler_scope_count; i++) {
+        if (i == VOX__pst__gpu && (*profiler).p_gpu_timers_available == VOX__bt__false) {
+            continue;
+        }
+
+        printf("\t%-8s p50 %8.3f ms  p95 %8.3f ms  p99 %8.3f ms\n", VOX__read__profiler_scope_name(i), (f64)VOX__calculate__profiler_scope_percentile(profiler, i, 50.0, &VOX__global__heap_allocator) / 1000000.0, (f64)VOX__calculate__profiler_scope_percentile(profiler, i, 95.0, &VOX__global__heap_allocator) / 1000000.0, (f64)VOX__calculate__profiler_scope_percentile(profiler, i, 99.0, &VOX__global__heap_allocator) / 1000000.0);
+    }
+
+    // latest counters
+    if ((*profiler).p_frame_count > 0) {
+        latest = VOX__read__profiler_frame(profiler, (*profiler).p_frame_count - 1);
+        printf("\tlast frame: %lu draw calls, %lu vertices, %lu bytes uploaded, %lu ticks\n", (*latest).p_draw_call_count, (*latest).p_drawn_vertex_count, (*latest).p_uploaded_byte_count, (*latest).p_tick_count);
+        printf("\tmissed ticks in kept frames: %lu\n", VOX__calculate__profiler_missed_tick_count(profiler));
+    }
+
+    return;
+}
+
+void VOX__send__profiler_summary_to_window_title(VOX__profiler* profiler, VOX__graphics graphics, VOX__allocator* scratch_allocator) {
+    char title[256];
+    VOX__profiler_frame* latest;
+
+    // nothing recorded
+    if ((*profiler).p_frame_count == 0) {
+        return;
+    }
+
+    // write summary
+    latest = VOX__read__profiler_frame(profiler, (*profiler).p_frame_count - 1);
+    snprintf(title, sizeof(title), "Voxelize! | p50 %.2f ms | p99 %.2f ms | gpu %.2f ms | %lu draws | %lu vertices | %lu missed ticks", (f64)VOX__calculate__profiler_scope_percentile(profiler, VOX__pst__frame, 50.0, scratch_allocator) / 1000000.0, (f64)VOX__calculate__profiler_scope_percentile(profiler, VOX__pst__frame, 99.0, scratch_allocator) / 1000000.0, (f64)VOX__calculate__profiler_scope_percentile(profiler, VOX__pst__gpu, 50.0, scratch_allocator) / 1000000.0, (*latest).p_draw_call_count, (*latest).p_drawn_vertex_count, VOX__calculate__profiler_missed_tick_count(profiler));
+    SDL_SetWindowTitle(graphics.p_window_context, title);
+
+    return;
+}
+
+void VOX__write__profiler_csv(VOX__error* error, VOX__profiler* profiler, char* file_path) {
+    FILE* file;
+    VOX__profiler_frame* frame;
+
+    // open file
+    file = fopen(file_path, "w");
+    if (file == 0) {
+        *error = VOX__create__error__file_open_failure();
+
+        return;
+    }
+
+    // header
+    fprintf(file, "frame");
+    for (u64 i = 0; i < VOX__dt__profiler_scope_count; i++) {
+        fprintf(file, ",%s_ns", VOX__read__profiler_scope_name(i));
+    }
+    fprintf(file, ",draw_calls,vertices,uploaded_bytes,ticks,missed_ticks\n");
+
+    // one row per kept frame, oldest first
+    for (u64 f = (*profiler).p_frame_count - VOX__calculate__profiler_recorded_frame_count(profiler); f < (*profiler).p_frame_count; f++) {
+        frame = VOX__read__profiler_frame(profiler, f);
+
+        fprintf(file, "%lu", f);
+        for (u64 i = 0; i < VOX__dt__profiler_scope_count; i++) {
+            fprintf(file, ",%lu", (*frame).p_scope_times[i]);
+        }
+        fprintf(file, ",%lu,%lu,%lu,%lu,%lu\n", (*frame).p_draw_call_count, (*frame).p_drawn_vertex_count, (*frame).p_uploaded_byte_count, (*frame).p_tick_count, (*frame).p_missed_tick_count);
+    }
+
+    fclose(file);
+
+    return;
+}
+
+void VOX__write__profiler_chrome_trace(VOX__error* error, VOX__profiler* profiler, char* file_path) {
+    FILE* file;
+    VOX__profiler_frame* frame;
+    VOX__bt first;
+
+    // open file
+    file = fopen(file_path, "w");
+    if (file == 0) {
+        *error = VOX__create__error__file_open_failure();
+
+        return;
+    }
+
+    // complete events in microseconds, cpu scopes on thread 0 and gpu time on thread 1
+    first = VOX__bt__true;
+    fprintf(file, "{\"traceEvents\":[\n");
+    for (u64 f = (*profiler).p_frame_count - VOX__calculate__profiler_recorded_frame_count(profiler); f < (*profiler).p_frame_count; f++) {
+        frame = VOX__read__profiler_frame(profiler, f);
+
+        for (u64 i = 0; i < VOX__dt__profiler_scope_count; i++) {
+            if ((*frame).p_scope_times[i] == 0) {
+                continue;
+            }
+
+            fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%lu}}", first == VOX__bt__true ? "" : ",\n", VOX__read__profiler_scope_name(i), i == VOX__pst__gpu ? 1 : 0, (f64)(*frame).p_scope_starts[i] / 1000.0, (f64)(*frame).p_scope_times[i] / 1000.0, f);
+            first = VOX__bt__false;
+        }
+    }
+    fprintf(file, "\n]}\n");
+
+    fclose(file);
+
+    return;
+}
+
+void VOX__close__profiler(VOX__profiler profiler) {
+    // deallocate opengl side
+    if (profiler.p_gpu_timers_available == VOX__bt__true) {
+        glDeleteQueries(VOX__dt__profiler_gpu_query_count, profiler.p_gpu_queries);
+    }
+
+    // deallocate cpu side
+    VOX__destroy__buffer(profiler.p_frames);
+
+    return;
+}
+
+/* 2D Texture Array */
+typedef struct VOX__2D_texture_array {
+    VOX__buffer p_textures;
+    u64 p_single_texture_width;
+    u64 p_single_texture_height;
+    u64 p_texel_byte_count;
+    u64 p_texture_count;
+    GLenum p_texture_type;
+} VOX__2D_texture_array;
+
+VOX__2D_texture_array VOX__create__2D_texture_array(u64 texture_count, u64 single_texture_width, u64 single_texture_height, u64 texel_byte_count, GLenum texture_type) {
+    VOX__2D_texture_array output;
+
+    // setup textures buffer
+    output.p_textures = VOX__create__buffer(texture_count * single_texture_width * single_texture_height * texel_byte_count);
+
+    // setup other data
+    output.p_single_texture_width = single_texture_width;
+    output.p_single_texture_height = single_texture_height;
+    output.p_texel_byte_count = texel_byte_count;
+    output.p_texture_count = texture_count;
+    output.p_texture_type = texture_type;
+
+    return output;
+}
+
+u64 VOX__calculate__2D_texture_offset_in_2D_texture_array(VOX__2D_texture_array texture_array, u64 index) {
+    return texture_array.p_single_texture_height * texture_array.p_single_texture_width * texture_array.p_texel_byte_count * index;
+}
+
+void VOX__write__2D_texture_data_to_2D_texture_array(VOX__2D_texture_array texture_array, VOX__buffer texture_data, u64 index) {
+    VOX__copy__bytes_to_bytes(texture_data.p_data, texture_data.p_length, texture_array.p_textures.p_data + VOX__calculate__2D_texture_offset_in_2D_texture_array(texture_array, index));
+
+    return;
 }
 
 void VOX__destroy__2D_texture_array(VOX__2D_texture_array texture_array) {
@@ -977,172 +3603,6038 @@ void VOX__destroy__2D_texture_array(VOX__2D_texture_array texture_array) {
     return;
 }
 
-/* Game Textures */
-// game textures type
-typedef enum VOX__gtt {
-    VOX__gtt__block_faces
-} VOX__gtt;
+/* Game Textures */
+// game textures type
+typedef enum VOX__gtt {
+    VOX__gtt__block_faces
+} VOX__gtt;
+
+typedef struct VOX__game_textures {
+    // texture data
+    VOX__2D_texture_array p_block_faces;
+
+    // texture handles
+    GLuint p_block_faces_handle;
+
+    // active textures
+    GLenum p_block_faces_texture_ID;
+} VOX__game_textures;
+
+VOX__game_textures VOX__open__game_textures(VOX__2D_texture_array block_faces) {
+    VOX__game_textures output;
+
+    // setup texture data
+    output.p_block_faces = block_faces;
+
+    // setup texture handles
+    glCreateTextures(block_faces.p_texture_type, 1, &(output.p_block_faces_handle));
+
+    // setup active textures
+    output.p_block_faces_texture_ID = GL_TEXTURE0 + 0;
+
+    return output;
+}
+
+void VOX__draw__bind__specific_game_textures_texture(VOX__game_textures game_textures, VOX__gtt game_textures_type) {
+    switch (game_textures_type) {
+    case VOX__gtt__block_faces:
+        glActiveTexture(game_textures.p_block_faces_texture_ID);
+        glBindTexture(game_textures.p_block_faces.p_texture_type, game_textures.p_block_faces_handle);
+        break;
+    }
+}
+
+void VOX__draw__unbind__specific_game_textures_texture(VOX__game_textures game_textures, VOX__gtt game_textures_type) {
+    switch (game_textures_type) {
+    case VOX__gtt__block_faces:
+        glBindTexture(game_textures.p_block_faces.p_texture_type, 0);
+        break;
+    }
+}
+
+void VOX__send__game_textures_to_opengl(VOX__game_textures game_textures) {
+    // send block textures
+    VOX__draw__bind__specific_game_textures_texture(game_textures, VOX__gtt__block_faces);
+    glTexParameteri(game_textures.p_block_faces.p_texture_type, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(game_textures.p_block_faces.p_texture_type, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(game_textures.p_block_faces.p_texture_type, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(game_textures.p_block_faces.p_texture_type, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage3D(game_textures.p_block_faces.p_texture_type, 0, GL_RGBA8, game_textures.p_block_faces.p_single_texture_width, game_textures.p_block_faces.p_single_texture_height, game_textures.p_block_faces.p_texture_count, 0, GL_RGBA, GL_UNSIGNED_BYTE, game_textures.p_block_faces.p_textures.p_data);
+    VOX__draw__unbind__specific_game_textures_texture(game_textures, VOX__gtt__block_faces);
+
+    return;
+}
+
+void VOX__close__game_textures(VOX__game_textures game_textures) {
+    // destroy data on cpu
+    VOX__destroy__2D_texture_array(game_textures.p_block_faces);
+
+    // destroy data on gpu
+    glDeleteTextures(1, &(game_textures.p_block_faces_handle));
+
+    return;
+}
+
+/* Blocks */
+typedef u16 VOX__block_ID;
+
+// block ID type
+typedef enum VOX__bit {
+    VOX__bit__air = 0,
+    VOX__bit__grass = 1,
+    VOX__bit__stone = 2,
+    VOX__bit__water = 3,
+    VOX__bit__sand = 4,
+    VOX__bit__snow = 5,
+    VOX__bit__lamp = 6
+} VOX__bit;
+
+typedef struct VOX__block {
+    VOX__block_ID p_ID;
+} VOX__block;
+
+// light a block gives off, 0 to 15
+u8 VOX__read__block_light_emission(VOX__block_ID block_ID) {
+    switch (block_ID) {
+    case VOX__bit__lamp:
+        return 14;
+    default:
+        return 0;
+    }
+}
+
+// light lost passing into a block on top of the one per step, 15 blocks light entirely
+u8 VOX__read__block_light_opacity(VOX__block_ID block_ID) {
+    switch (block_ID) {
+    case VOX__bit__air:
+        return 0;
+    case VOX__bit__water:
+        return 2;
+    default:
+        return 15;
+    }
+}
+
+// block face type (face / 2 = axis, face % 2 = faces positive direction)
+typedef enum VOX__bft {
+    VOX__bft__left,
+    VOX__bft__right,
+    VOX__bft__bottom,
+    VOX__bft__top,
+    VOX__bft__back,
+    VOX__bft__front
+} VOX__bft;
+
+typedef struct VOX__block_dictionary_entry {
+    GLenum p_top_texture_ID;
+    GLenum p_bottom_texture_ID;
+    GLenum p_left_texture_ID;
+    GLenum p_right_texture_ID;
+    GLenum p_front_texture_ID;
+    GLenum p_back_texture_ID;
+} VOX__block_dictionary_entry;
+
+VOX__block_dictionary_entry VOX__create__block_dictionary_entry(GLenum top_texture_ID, GLenum bottom_texture_ID, GLenum left_texture_ID, GLenum right_texture_ID, GLenum front_texture_ID, GLenum back_texture_ID) {
+    VOX__block_dictionary_entry output;
+
+    // setup output
+    output.p_top_texture_ID = top_texture_ID;
+    output.p_bottom_texture_ID = bottom_texture_ID;
+    output.p_left_texture_ID = left_texture_ID;
+    output.p_right_texture_ID = right_texture_ID;
+    output.p_front_texture_ID = front_texture_ID;
+    output.p_back_texture_ID = back_texture_ID;
+
+    return output;
+}
+
+GLenum VOX__read__texture_ID_from_block_dictionary_entry(VOX__block_dictionary_entry entry, VOX__bft block_face) {
+    switch (block_face) {
+    case VOX__bft__left:
+        return entry.p_left_texture_ID;
+    case VOX__bft__right:
+        return entry.p_right_texture_ID;
+    case VOX__bft__bottom:
+        return entry.p_bottom_texture_ID;
+    case VOX__bft__top:
+        return entry.p_top_texture_ID;
+    case VOX__bft__back:
+        return entry.p_back_texture_ID;
+    case VOX__bft__front:
+        return entry.p_front_texture_ID;
+    }
+
+    return 0;
+}
+
+typedef struct VOX__block_dictionary {
+    VOX__buffer p_dictionary;
+    u64 p_entry_count;
+} VOX__block_dictionary;
+
+VOX__block_dictionary VOX__create__block_dictionary(u64 entry_count) {
+    VOX__block_dictionary output;
+
+    // setup output
+    output.p_dictionary = VOX__create__buffer(sizeof(VOX__block_dictionary_entry) * entry_count);
+    output.p_entry_count = entry_count;
+
+    return output;
+}
+
+void VOX__write__entry_to_block_dictionary(VOX__block_dictionary block_dictionary, VOX__block_ID block_ID, VOX__block_dictionary_entry entry) {
+    ((VOX__block_dictionary_entry*)block_dictionary.p_dictionary.p_data)[block_ID] = entry;
+
+    return;
+}
+
+VOX__block_dictionary_entry VOX__read__entry_from_block_dictionary(VOX__block_dictionary block_dictionary, VOX__block_ID block_ID) {
+    return ((VOX__block_dictionary_entry*)block_dictionary.p_dictionary.p_data)[block_ID];
+}
+
+void VOX__destroy__block_dictionary(VOX__block_dictionary block_dictionary) {
+    VOX__destroy__buffer(block_dictionary.p_dictionary);
+
+    return;
+}
+
+/* Chunks - Palette Compressed Block Storage */
+// blocks store indices into a per chunk palette, packed at 0/1/2/4/8/16 bits per block (0 bits = whole chunk is one block)
+typedef struct VOX__chunk {
+    VOX__buffer p_palette; // VOX__block_ID per entry, capacity fits the current bits per block
+    u64 p_palette_count;
+    u64 p_bits_per_block;
+    VOX__buffer p_blocks; // packed palette indices, null when bits per block is 0
+} VOX__chunk;
+
+u64 VOX__calculate__chunk_bits_per_block(u64 palette_count) {
+    if (palette_count <= 1) {
+        return 0;
+    } else if (palette_count <= 2) {
+        return 1;
+    } else if (palette_count <= 4) {
+        return 2;
+    } else if (palette_count <= 16) {
+        return 4;
+    } else if (palette_count <= 256) {
+        return 8;
+    }
+
+    return 16;
+}
+
+u64 VOX__calculate__chunk_palette_capacity(u64 bits_per_block) {
+    if (bits_per_block == 0) {
+        return 1;
+    } else if (bits_per_block >= 16) {
+        return VOX__dt__chunk_block_count;
+    }
+
+    return (u64)1 << bits_per_block;
+}
+
+VOX__buffer VOX__create__chunk_blocks(u64 bits_per_block) {
+    VOX__buffer output;
+
+    // constant chunks need no per block data
+    if (bits_per_block == 0) {
+        return VOX__create__buffer__add_address(0, 0);
+    }
+
+    // setup output (all indices start at palette entry 0)
+    output = VOX__create__buffer__allocator(&VOX__global__pool_allocator, (VOX__dt__chunk_block_count * bits_per_block) / 8);
+    VOX__fill__bytes(output.p_data, output.p_length, 0);
+
+    return output;
+}
+
+VOX__chunk VOX__create_null__chunk() {
+    VOX__chunk output;
+
+    // setup output
+    output.p_palette = VOX__create__buffer__add_address(0, 0);
+    output.p_palette_count = 0;
+    output.p_bits_per_block = 0;
+    output.p_blocks = VOX__create__buffer__add_address(0, 0);
+
+    return output;
+}
+
+VOX__chunk VOX__create__chunk(VOX__block_ID fill_ID) {
+    VOX__chunk output;
+
+    // setup output as a constant chunk
+    output.p_palette = VOX__create__buffer__allocator(&VOX__global__pool_allocator, sizeof(VOX__block_ID) * VOX__calculate__chunk_palette_capacity(0));
+    output.p_palette_count = 1;
+    output.p_bits_per_block = 0;
+    output.p_blocks = VOX__create__chunk_blocks(0);
+
+    // write only entry
+    ((VOX__block_ID*)output.p_palette.p_data)[0] = fill_ID;
+
+    return output;
+}
+
+VOX__chunk VOX__create__chunk__copy(VOX__chunk chunk) {
+    VOX__chunk output;
+
+    // setup output
+    output = chunk;
+    output.p_palette = VOX__create__buffer__allocator(&VOX__global__pool_allocator, chunk.p_palette.p_length);
+    output.p_blocks = VOX__create__chunk_blocks(chunk.p_bits_per_block);
+
+    // copy data
+    VOX__copy__bytes_to_bytes(chunk.p_palette.p_data, chunk.p_palette.p_length, output.p_palette.p_data);
+    VOX__copy__bytes_to_bytes(chunk.p_blocks.p_data, chunk.p_blocks.p_length, output.p_blocks.p_data);
+
+    return output;
+}
+
+u64 VOX__calculate__chunk_block_index(u64 x, u64 y, u64 z) {
+    return x + (y * VOX__dt__chunk_side_length) + (z * VOX__dt__chunk_side_length * VOX__dt__chunk_side_length);
+}
+
+u64 VOX__calculate__chunk_memory_size(VOX__chunk chunk) {
+    return chunk.p_palette.p_length + chunk.p_blocks.p_length;
+}
+
+u64 VOX__read__palette_index_from_chunk_blocks(VOX__buffer blocks, u64 bits_per_block, u64 block_index) {
+    u64 bit;
+
+    switch (bits_per_block) {
+    case 0:
+        return 0;
+    case 16:
+        return ((u16*)blocks.p_data)[block_index];
+    default:
+        // indices never straddle a byte below 16 bits
+        bit = block_index * bits_per_block;
+
+        return (((u8*)blocks.p_data)[bit >> 3] >> (bit & 7)) & ((1 << bits_per_block) - 1);
+    }
+}
+
+void VOX__write__palette_index_to_chunk_blocks(VOX__buffer blocks, u64 bits_per_block, u64 block_index, u64 palette_index) {
+    u64 bit;
+    u8 mask;
+
+    switch (bits_per_block) {
+    case 0:
+        break;
+    case 16:
+        ((u16*)blocks.p_data)[block_index] = (u16)palette_index;
+        break;
+    default:
+        bit = block_index * bits_per_block;
+        mask = (u8)(((1 << bits_per_block) - 1) << (bit & 7));
+        ((u8*)blocks.p_data)[bit >> 3] = (((u8*)blocks.p_data)[bit >> 3] & ~mask) | ((u8)(palette_index << (bit & 7)) & mask);
+        break;
+    }
+
+    return;
+}
+
+void VOX__resize__chunk_bits_per_block(VOX__chunk* chunk, u64 bits_per_block) {
+    VOX__buffer palette;
+    VOX__buffer blocks;
+
+    // setup new storage
+    palette = VOX__create__buffer__allocator(&VOX__global__pool_allocator, sizeof(VOX__block_ID) * VOX__calculate__chunk_palette_capacity(bits_per_block));
+    blocks = VOX__create__chunk_blocks(bits_per_block);
+
+    // repack
+    VOX__copy__bytes_to_bytes((*chunk).p_palette.p_data, sizeof(VOX__block_ID) * (*chunk).p_palette_count, palette.p_data);
+    for (u64 i = 0; i < VOX__dt__chunk_block_count; i++) {
+        VOX__write__palette_index_to_chunk_blocks(blocks, bits_per_block, i, VOX__read__palette_index_from_chunk_blocks((*chunk).p_blocks, (*chunk).p_bits_per_block, i));
+    }
+
+    // swap storage
+    VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, (*chunk).p_palette);
+    VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, (*chunk).p_blocks);
+    (*chunk).p_palette = palette;
+    (*chunk).p_blocks = blocks;
+    (*chunk).p_bits_per_block = bits_per_block;
+
+    return;
+}
+
+VOX__chunk VOX__create__chunk__from_block_IDs(VOX__block_ID* block_IDs) {
+    VOX__chunk output;
+    VOX__block_ID palette[VOX__dt__chunk_block_count];
+    u16 palette_indices[VOX__dt__chunk_block_count];
+    u64 palette_count;
+    u64 palette_index;
+
+    // build palette in first seen order (runs of one block reuse the last match without searching)
+    palette_count = 0;
+    palette_index = 0;
+    for (u64 i = 0; i < VOX__dt__chunk_block_count; i++) {
+        if (palette_count == 0 || palette[palette_index] != block_IDs[i]) {
+            palette_index = 0;
+            while (palette_index < palette_count && palette[palette_index] != block_IDs[i]) {
+                palette_index++;
+            }
+            if (palette_index == palette_count) {
+                palette[palette_count] = block_IDs[i];
+                palette_count++;
+            }
+        }
+
+        palette_indices[i] = (u16)palette_index;
+    }
+
+    // setup output at the narrowest width
+    output.p_bits_per_block = VOX__calculate__chunk_bits_per_block(palette_count);
+    output.p_palette = VOX__create__buffer__allocator(&VOX__global__pool_allocator, sizeof(VOX__block_ID) * VOX__calculate__chunk_palette_capacity(output.p_bits_per_block));
+    output.p_palette_count = palette_count;
+    output.p_blocks = VOX__create__chunk_blocks(output.p_bits_per_block);
+    VOX__copy__bytes_to_bytes(palette, sizeof(VOX__block_ID) * palette_count, output.p_palette.p_data);
+
+    // pack indices (zero is already written)
+    for (u64 i = 0; i < VOX__dt__chunk_block_count && output.p_bits_per_block != 0; i++) {
+        if (palette_indices[i] != 0) {
+            VOX__write__palette_index_to_chunk_blocks(output.p_blocks, output.p_bits_per_block, i, palette_indices[i]);
+        }
+    }
+
+    return output;
+}
+
+VOX__block_ID VOX__read__block_ID_from_chunk(VOX__chunk chunk, u64 x, u64 y, u64 z) {
+    return ((VOX__block_ID*)chunk.p_palette.p_data)[VOX__read__palette_index_from_chunk_blocks(chunk.p_blocks, chunk.p_bits_per_block, VOX__calculate__chunk_block_index(x, y, z))];
+}
+
+void VOX__read__block_IDs_from_chunk(VOX__chunk chunk, VOX__block_ID* block_IDs) {
+    VOX__block_ID* palette;
+
+    // setup palette
+    palette = (VOX__block_ID*)chunk.p_palette.p_data;
+
+    // unpack whole chunk
+    if (chunk.p_bits_per_block == 0) {
+        for (u64 i = 0; i < VOX__dt__chunk_block_count; i++) {
+            block_IDs[i] = palette[0];
+        }
+    } else if (chunk.p_bits_per_block == 16) {
+        for (u64 i = 0; i < VOX__dt__chunk_block_count; i++) {
+            block_IDs[i] = palette[((u16*)chunk.p_blocks.p_data)[i]];
+        }
+    } else {
+        for (u64 i = 0; i < VOX__dt__chunk_block_count; i++) {
+            block_IDs[i] = palette[VOX__read__palette_index_from_chunk_blocks(chunk.p_blocks, chunk.p_bits_per_block, i)];
+        }
+    }
+
+    return;
+}
+
+void VOX__compact__chunk(VOX__chunk* chunk) {
+    u16 remap[VOX__dt__chunk_block_count];
+    u64 used_count;
+    u64 bits_per_block;
+    VOX__buffer palette;
+    VOX__buffer blocks;
+
+    // mark used palette entries
+    for (u64 i = 0; i < (*chunk).p_palette_count; i++) {
+        remap[i] = 0;
+    }
+    for (u64 i = 0; i < VOX__dt__chunk_block_count; i++) {
+        remap[VOX__read__palette_index_from_chunk_blocks((*chunk).p_blocks, (*chunk).p_bits_per_block, i)] = 1;
+    }
+
+    // number used entries in order
+    used_count = 0;
+    for (u64 i = 0; i < (*chunk).p_palette_count; i++) {
+        if (remap[i] != 0) {
+            remap[i] = used_count;
+            used_count++;
+        } else {
+            remap[i] = VOX__dt__chunk_block_count;
+        }
+    }
+
+    // already minimal
+    if (used_count == (*chunk).p_palette_count) {
+        return;
+    }
+
+    // rebuild at the narrowest width
+    bits_per_block = VOX__calculate__chunk_bits_per_block(used_count);
+    palette = VOX__create__buffer__allocator(&VOX__global__pool_allocator, sizeof(VOX__block_ID) * VOX__calculate__chunk_palette_capacity(bits_per_block));
+    blocks = VOX__create__chunk_blocks(bits_per_block);
+    for (u64 i = 0; i < (*chunk).p_palette_count; i++) {
+        if (remap[i] != VOX__dt__chunk_block_count) {
+            ((VOX__block_ID*)palette.p_data)[remap[i]] = ((VOX__block_ID*)(*chunk).p_palette.p_data)[i];
+        }
+    }
+    for (u64 i = 0; i < VOX__dt__chunk_block_count; i++) {
+        VOX__write__palette_index_to_chunk_blocks(blocks, bits_per_block, i, remap[VOX__read__palette_index_from_chunk_blocks((*chunk).p_blocks, (*chunk).p_bits_per_block, i)]);
+    }
+
+    // swap storage
+    VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, (*chunk).p_palette);
+    VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, (*chunk).p_blocks);
+    (*chunk).p_palette = palette;
+    (*chunk).p_palette_count = used_count;
+    (*chunk).p_blocks = blocks;
+    (*chunk).p_bits_per_block = bits_per_block;
+
+    return;
+}
+
+void VOX__write__block_ID_to_chunk(VOX__chunk* chunk, u64 x, u64 y, u64 z, VOX__block_ID block_ID) {
+    u64 palette_index;
+
+    // find block in palette
+    palette_index = 0;
+    while (palette_index < (*chunk).p_palette_count && ((VOX__block_ID*)(*chunk).p_palette.p_data)[palette_index] != block_ID) {
+        palette_index++;
+    }
+
+    // add new block to palette, reclaiming unused entries before widening
+    if (palette_index == (*chunk).p_palette_count) {
+        if ((*chunk).p_palette_count == VOX__calculate__chunk_palette_capacity((*chunk).p_bits_per_block)) {
+            VOX__compact__chunk(chunk);
+        }
+
+        // every entry still used at 16 bits means every block is different, so the overwritten block's entry is its alone to replace
+        if ((*chunk).p_palette_count == VOX__dt__chunk_block_count) {
+            palette_index = VOX__read__palette_index_from_chunk_blocks((*chunk).p_blocks, (*chunk).p_bits_per_block, VOX__calculate__chunk_block_index(x, y, z));
+            ((VOX__block_ID*)(*chunk).p_palette.p_data)[palette_index] = block_ID;
+
+            return;
+        }
+
+        if ((*chunk).p_palette_count == VOX__calculate__chunk_palette_capacity((*chunk).p_bits_per_block)) {
+            VOX__resize__chunk_bits_per_block(chunk, VOX__calculate__chunk_bits_per_block((*chunk).p_palette_count + 1));
+        }
+
+        palette_index = (*chunk).p_palette_count;
+        ((VOX__block_ID*)(*chunk).p_palette.p_data)[palette_index] = block_ID;
+        (*chunk).p_palette_count++;
+    }
+
+    // write index
+    VOX__write__palette_index_to_chunk_blocks((*chunk).p_blocks, (*chunk).p_bits_per_block, VOX__calculate__chunk_block_index(x, y, z), palette_index);
+
+    return;
+}
+
+void VOX__destroy__chunk(VOX__chunk chunk) {
+    VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, chunk.p_palette);
+    VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, chunk.p_blocks);
+
+    return;
+}
+
+/* Chunk Neighborhood - A Chunk's Blocks & Light With A One Block Border Taken From Its Neighbors */
+// light is sky light << 4 | block light, what meshing needs to shade faces on the chunk border the same as inside it
+typedef struct VOX__chunk_neighborhood {
+    VOX__block_ID p_block_IDs[VOX__dt__chunk_neighborhood_block_count];
+    u8 p_light[VOX__dt__chunk_neighborhood_block_count];
+} VOX__chunk_neighborhood;
+
+// x, y & z run from -1 to the chunk side length
+u64 VOX__calculate__chunk_neighborhood_index(s64 x, s64 y, s64 z) {
+    return (u64)(x + 1) + ((u64)(y + 1) * VOX__dt__chunk_neighborhood_side_length) + ((u64)(z + 1) * VOX__dt__chunk_neighborhood_side_length * VOX__dt__chunk_neighborhood_side_length);
+}
+
+// for chunks meshed without a world, the border is air & everything not opaque sits under open sky
+void VOX__write__chunk_to_chunk_neighborhood__unlit(VOX__chunk chunk, VOX__chunk_neighborhood* neighborhood) {
+    VOX__block_ID block_IDs[VOX__dt__chunk_block_count];
+    u64 index;
+
+    // open border
+    for (u64 i = 0; i < VOX__dt__chunk_neighborhood_block_count; i++) {
+        (*neighborhood).p_block_IDs[i] = VOX__bit__air;
+        (*neighborhood).p_light[i] = VOX__dt__light_maximum << 4;
+    }
+
+    // chunk blocks
+    VOX__read__block_IDs_from_chunk(chunk, block_IDs);
+    for (u64 z = 0; z < VOX__dt__chunk_side_length; z++) {
+        for (u64 y = 0; y < VOX__dt__chunk_side_length; y++) {
+            for (u64 x = 0; x < VOX__dt__chunk_side_length; x++) {
+                index = VOX__calculate__chunk_neighborhood_index(x, y, z);
+                (*neighborhood).p_block_IDs[index] = block_IDs[VOX__calculate__chunk_block_index(x, y, z)];
+                if (VOX__read__block_light_opacity((*neighborhood).p_block_IDs[index]) >= VOX__dt__light_maximum) {
+                    (*neighborhood).p_light[index] = VOX__read__block_light_emission((*neighborhood).p_block_IDs[index]);
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+/* Chunk Meshing - Greedy Merging Of Visible Block Faces Into Quads */
+// corner lighting holds 10 bits per quad corner (counter clockwise from the quad origin), ambient occlusion in the low 2 then light
+typedef struct VOX__chunk_mesh_quad {
+    VOX__bft p_block_face;
+    u8 p_slice;
+    u8 p_u;
+    u8 p_v;
+    u8 p_width;
+    u8 p_height;
+    GLenum p_texture_ID;
+    u64 p_corner_lighting;
+} VOX__chunk_mesh_quad;
+
+VOX__chunk_mesh_quad VOX__create__chunk_mesh_quad(VOX__bft block_face, u8 slice, u8 u, u8 v, u8 width, u8 height, GLenum texture_ID, u64 corner_lighting) {
+    VOX__chunk_mesh_quad output;
+
+    // setup output
+    output.p_block_face = block_face;
+    output.p_slice = slice;
+    output.p_u = u;
+    output.p_v = v;
+    output.p_width = width;
+    output.p_height = height;
+    output.p_texture_ID = texture_ID;
+    output.p_corner_lighting = corner_lighting;
+
+    return output;
+}
+
+VOX__vertex_lighting VOX__read__chunk_mesh_quad_corner_lighting(VOX__chunk_mesh_quad quad, u64 corner) {
+    return VOX__create__vertex_lighting((quad.p_corner_lighting >> (corner * 10)) & 3, (quad.p_corner_lighting >> ((corner * 10) + 2)) & 255);
+}
+
+// ambient occlusion counts the solid blocks touching the corner in front of the face, light averages the see through ones
+// (u_step & v_step are -1 or 1 & point from the block's face center toward the corner)
+u64 VOX__calculate__chunk_mesh_corner_lighting(VOX__chunk_neighborhood* neighborhood, s64 x, s64 y, s64 z, VOX__bft block_face, s64 u_step, s64 v_step) {
+    s64 front[3];
+    s64 sample[3];
+    u64 axis;
+    u64 u_axis;
+    u64 v_axis;
+    u64 indices[3];
+    VOX__bt solid[3];
+    u64 index;
+    u64 sky_light;
+    u64 block_light;
+    u64 count;
+    u64 ambient_occlusion;
+
+    // setup axes
+    axis = block_face / 2;
+    u_axis = (axis + 1) % 3;
+    v_axis = (axis + 2) % 3;
+
+    // block in front of the face
+    front[0] = x;
+    front[1] = y;
+    front[2] = z;
+    front[axis] += ((s64)(block_face % 2) * 2) - 1;
+
+    // the two side blocks & the diagonal one around the corner
+    for (u64 i = 0; i < 3; i++) {
+        sample[0] = front[0];
+        sample[1] = front[1];
+        sample[2] = front[2];
+        sample[u_axis] += (i != 1) ? u_step : 0;
+        sample[v_axis] += (i != 0) ? v_step : 0;
+        indices[i] = VOX__calculate__chunk_neighborhood_index(sample[0], sample[1], sample[2]);
+        solid[i] = (*neighborhood).p_block_IDs[indices[i]] != VOX__bit__air;
+    }
+
+    // two solid sides close the corner whatever the diagonal holds
+    if (solid[0] == VOX__bt__true && solid[1] == VOX__bt__true) {
+        ambient_occlusion = 0;
+    } else {
+        ambient_occlusion = 3 - (solid[0] + solid[1] + solid[2]);
+    }
+
+    // average light of the block in front & every see through block around the corner (the diagonal only when light can reach it)
+    index = VOX__calculate__chunk_neighborhood_index(front[0], front[1], front[2]);
+    sky_light = (*neighborhood).p_light[index] >> 4;
+    block_light = (*neighborhood).p_light[index] & 15;
+    count = 1;
+    for (u64 i = 0; i < 3; i++) {
+        if (VOX__read__block_light_opacity((*neighborhood).p_block_IDs[indices[i]]) >= VOX__dt__light_maximum || (i == 2 && ambient_occlusion == 0)) {
+            continue;
+        }
+
+        sky_light += (*neighborhood).p_light[indices[i]] >> 4;
+        block_light += (*neighborhood).p_light[indices[i]] & 15;
+        count++;
+    }
+    sky_light = (sky_light + (count / 2)) / count;
+    block_light = (block_light + (count / 2)) / count;
+
+    return ambient_occlusion | (((sky_light << 4) | block_light) << 2);
+}
+
+u64 VOX__calculate__block_grid_index(u64 x, u64 y, u64 z, u64 side_length) {
+    return x + (y * side_length) + (z * side_length * side_length);
+}
+
+// block_IDs is a cube of side_length cells (a whole chunk, or a chunk downsampled for a level of detail)
+VOX__bt VOX__check__block_grid_face_is_visible(VOX__block_ID* block_IDs, u64 side_length, s64 x, s64 y, s64 z, VOX__bft block_face) {
+    s64 neighbor[3];
+
+    // setup neighbor position
+    neighbor[0] = x;
+    neighbor[1] = y;
+    neighbor[2] = z;
+    neighbor[block_face / 2] += ((s64)(block_face % 2) * 2) - 1;
+
+    // faces on the chunk border are always visible
+    if (neighbor[block_face / 2] < 0 || neighbor[block_face / 2] >= (s64)side_length) {
+        return VOX__bt__true;
+    }
+
+    // faces are hidden by any solid neighbor
+    return block_IDs[VOX__calculate__block_grid_index(neighbor[0], neighbor[1], neighbor[2], side_length)] == VOX__bit__air;
+}
+
+// cells are solid when at least half their blocks are, and take the highest solid block so surfaces keep their top blocks
+void VOX__calculate__chunk_lod_block_IDs(VOX__block_ID* block_IDs, u64 lod_level, VOX__block_ID* lod_block_IDs) {
+    u64 cell_length;
+    u64 lod_side_length;
+    u64 solid_count;
+    VOX__block_ID top_ID;
+    VOX__block_ID block_ID;
+
+    // setup sizes
+    cell_length = (u64)1 << lod_level;
+    lod_side_length = VOX__dt__chunk_side_length >> lod_level;
+
+    // sample each cell
+    for (u64 cell_z = 0; cell_z < lod_side_length; cell_z++) {
+        for (u64 cell_y = 0; cell_y < lod_side_length; cell_y++) {
+            for (u64 cell_x = 0; cell_x < lod_side_length; cell_x++) {
+                solid_count = 0;
+                top_ID = VOX__bit__air;
+
+                // bottom to top, so the last solid block seen is the highest
+                for (u64 y = 0; y < cell_length; y++) {
+                    for (u64 z = 0; z < cell_length; z++) {
+                        for (u64 x = 0; x < cell_length; x++) {
+                            block_ID = block_IDs[VOX__calculate__chunk_block_index((cell_x * cell_length) + x, (cell_y * cell_length) + y, (cell_z * cell_length) + z)];
+
+                            if (block_ID != VOX__bit__air) {
+                                solid_count++;
+                                top_ID = block_ID;
+                            }
+                        }
+                    }
+                }
+
+                lod_block_IDs[VOX__calculate__block_grid_index(cell_x, cell_y, cell_z, lod_side_length)] = (solid_count * 2 >= cell_length * cell_length * cell_length) ? top_ID : VOX__bit__air;
+            }
+        }
+    }
+
+    return;
+}
+
+// lod_level 0 meshes every block, higher levels mesh the downsampled cells and scale the quads back to block units
+// (neighborhood may be 0, the chunk is then lit as if alone under open sky, full detail faces get per corner ambient occlusion & smooth light, coarser cells take the light in front of them)
+u64 VOX__calculate__chunk_mesh_quads(VOX__chunk chunk, VOX__chunk_neighborhood* neighborhood, u64 lod_level, VOX__block_dictionary block_dictionary, VOX__chunk_mesh_quad* quads) {
+    u64 output;
+    VOX__block_ID block_IDs[VOX__dt__chunk_block_count];
+    VOX__block_ID lod_block_IDs[VOX__dt__chunk_block_count];
+    VOX__chunk_neighborhood unlit_neighborhood;
+    VOX__block_ID* grid;
+    u64 side_length;
+    u64 cell_length;
+    u64 mask[VOX__dt__chunk_side_length * VOX__dt__chunk_side_length]; // 0 = no face, otherwise texture ID + 1 | corner lighting << 16
+    u64 position[3];
+    s64 front[3];
+    u64 axis;
+    u64 u_axis;
+    u64 v_axis;
+    VOX__block_ID block_ID;
+    u64 corner_lighting;
+    u64 width;
+    u64 height;
+    VOX__bt row_matches;
+
+    // setup output
+    output = 0;
+
+    // all air chunks have nothing to mesh
+    if (chunk.p_bits_per_block == 0 && ((VOX__block_ID*)chunk.p_palette.p_data)[0] == VOX__bit__air) {
+        return output;
+    }
+
+    // unpack blocks once so the mesher reads a flat array
+    VOX__read__block_IDs_from_chunk(chunk, block_IDs);
+
+    // setup lighting
+    if (neighborhood == 0) {
+        VOX__write__chunk_to_chunk_neighborhood__unlit(chunk, &unlit_neighborhood);
+        neighborhood = &unlit_neighborhood;
+    }
+
+    // setup grid to mesh
+    cell_length = (u64)1 << lod_level;
+    side_length = VOX__dt__chunk_side_length >> lod_level;
+    if (lod_level == 0) {
+        grid = block_IDs;
+    } else {
+        VOX__calculate__chunk_lod_block_IDs(block_IDs, lod_level, lod_block_IDs);
+        grid = lod_block_IDs;
+    }
+
+    // mesh each face direction
+    for (u64 block_face = VOX__bft__left; block_face <= VOX__bft__front; block_face++) {
+        // setup axes (u & v span the slice plane)
+        axis = block_face / 2;
+        u_axis = (axis + 1) % 3;
+        v_axis = (axis + 2) % 3;
+
+        // mesh each slice along the face axis
+        for (u64 slice = 0; slice < side_length; slice++) {
+            // build visible face mask (faces only merge when their corners are lit alike too)
+            position[axis] = slice;
+            for (u64 v = 0; v < side_length; v++) {
+                for (u64 u = 0; u < side_length; u++) {
+                    position[u_axis] = u;
+                    position[v_axis] = v;
+                    block_ID = grid[VOX__calculate__block_grid_index(position[0], position[1], position[2], side_length)];
+
+                    if (block_ID != VOX__bit__air && VOX__check__block_grid_face_is_visible(grid, side_length, position[0], position[1], position[2], block_face) == VOX__bt__true) {
+                        if (lod_level == 0) {
+                            corner_lighting = 0;
+                            for (u64 corner = 0; corner < 4; corner++) {
+                                corner_lighting |= VOX__calculate__chunk_mesh_corner_lighting(neighborhood, position[0], position[1], position[2], block_face, (corner == 1 || corner == 2) ? 1 : -1, (corner >= 2) ? 1 : -1) << (corner * 10);
+                            }
+                        } else {
+                            // block just past the cell's face at the cell's origin
+                            front[0] = position[0] * cell_length;
+                            front[1] = position[1] * cell_length;
+                            front[2] = position[2] * cell_length;
+                            front[axis] = (block_face % 2 == 1) ? (s64)((position[axis] + 1) * cell_length) : (s64)(position[axis] * cell_length) - 1;
+                            corner_lighting = 3 | ((u64)(*neighborhood).p_light[VOX__calculate__chunk_neighborhood_index(front[0], front[1], front[2])] << 2);
+                            corner_lighting |= (corner_lighting << 10) | (corner_lighting << 20) | (corner_lighting << 30);
+                        }
+
+                        mask[u + (v * side_length)] = (VOX__read__texture_ID_from_block_dictionary_entry(VOX__read__entry_from_block_dictionary(block_dictionary, block_ID), block_face) + 1) | (corner_lighting << 16);
+                    } else {
+                        mask[u + (v * side_length)] = 0;
+                    }
+                }
+            }
+
+            // greedily merge mask into quads
+            for (u64 v = 0; v < side_length; v++) {
+                for (u64 u = 0; u < side_length; u += width) {
+                    width = 1;
+
+                    // skip empty cells
+                    if (mask[u + (v * side_length)] == 0) {
+                        continue;
+                    }
+
+                    // grow along u
+                    while (u + width < side_length && mask[u + width + (v * side_length)] == mask[u + (v * side_length)]) {
+                        width++;
+                    }
+
+                    // grow along v while the whole row matches
+                    for (height = 1; v + height < side_length; height++) {
+                        row_matches = VOX__bt__true;
+
+                        for (u64 k = 0; k < width; k++) {
+                            if (mask[u + k + ((v + height) * side_length)] != mask[u + (v * side_length)]) {
+                                row_matches = VOX__bt__false;
+
+                                break;
+                            }
+                        }
+
+                        if (row_matches == VOX__bt__false) {
+                            break;
+                        }
+                    }
+
+                    // write quad in block units (positive faces sit on the far side of their cell)
+                    quads[output] = VOX__create__chunk_mesh_quad(block_face, (slice * cell_length) + ((block_face % 2) * (cell_length - 1)), u * cell_length, v * cell_length, width * cell_length, height * cell_length, (mask[u + (v * side_length)] & 0xFFFF) - 1, mask[u + (v * side_length)] >> 16);
+                    output++;
+
+                    // clear merged cells
+                    for (u64 y = 0; y < height; y++) {
+                        for (u64 x = 0; x < width; x++) {
+                            mask[u + x + ((v + y) * side_length)] = 0;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return output;
+}
+
+void VOX__write__chunk_mesh_quad_to_object_datum(VOX__object_datum object_datum, u64 quad_index, VOX__chunk_mesh_quad quad, VOX__3D_position chunk_offset, VOX__vft vertex_format) {
+    u64 axis;
+    u64 u_axis;
+    u64 v_axis;
+    f32 position[3];
+    f32 corner_u[4];
+    f32 corner_v[4];
+    f32 texture_u;
+    f32 texture_v;
+    VOX__ebo_index base;
+    u64 first_corner;
+    u64 corner_pattern[2][6] = { { 0, 2, 1, 0, 3, 2 }, { 0, 1, 2, 0, 2, 3 } };
+
+    // setup axes
+    axis = quad.p_block_face / 2;
+    u_axis = (axis + 1) % 3;
+    v_axis = (axis + 2) % 3;
+
+    // setup corners counter clockwise around the face axis
+    corner_u[0] = 0.0f;
+    corner_v[0] = 0.0f;
+    corner_u[1] = (f32)quad.p_width;
+    corner_v[1] = 0.0f;
+    corner_u[2] = (f32)quad.p_width;
+    corner_v[2] = (f32)quad.p_height;
+    corner_u[3] = 0.0f;
+    corner_v[3] = (f32)quad.p_height;
+
+    // write vertices
+    for (u64 i = 0; i < 4; i++) {
+        position[axis] = (f32)(quad.p_slice + (quad.p_block_face % 2));
+        position[u_axis] = (f32)quad.p_u + corner_u[i];
+        position[v_axis] = (f32)quad.p_v + corner_v[i];
+
+        // keep texture v pointing up on x facing sides (where u runs along y)
+        if (axis == 0) {
+            texture_u = corner_v[i];
+            texture_v = corner_u[i];
+        } else {
+            texture_u = corner_u[i];
+            texture_v = corner_v[i];
+        }
+
+        // packed vertices stay chunk local, the chunk offset is applied by the shader
+        if (vertex_format == VOX__vft__packed) {
+            VOX__write__packed_vbo_vertex_to_vbo_vertices(object_datum.p_vertices, (quad_index * 4) + i, VOX__create__packed_vbo_vertex((u8)position[0], (u8)position[1], (u8)position[2], (u8)quad.p_block_face, (u8)texture_u, (u8)texture_v, (u8)quad.p_texture_ID, VOX__read__chunk_mesh_quad_corner_lighting(quad, i)));
+        } else {
+            VOX__write__vbo_vertex_to_vbo_vertices(object_datum.p_vertices, (quad_index * 4) + i, VOX__create__vbo_vertex__lit(VOX__create__3D_position(chunk_offset.p_x + position[0], chunk_offset.p_y + position[1], chunk_offset.p_z + position[2]), VOX__create__2D_position(texture_u, texture_v), (VOX__texture_number_type)quad.p_texture_ID, VOX__read__chunk_mesh_quad_corner_lighting(quad, i)));
+        }
+    }
+
+    // split along the diagonal whose corners are less occluded, so occlusion fades evenly across the quad
+    first_corner = 0;
+    if ((quad.p_corner_lighting & 3) + ((quad.p_corner_lighting >> 20) & 3) < ((quad.p_corner_lighting >> 10) & 3) + ((quad.p_corner_lighting >> 30) & 3)) {
+        first_corner = 1;
+    }
+
+    // write elements (negative faces are wound in reverse)
+    base = quad_index * 4;
+    for (u64 i = 0; i < 6; i++) {
+        VOX__write__ebo_vertex_to_ebo_vertices(object_datum.p_elements, (quad_index * 6) + i, VOX__create__ebo_vertex(base + ((first_corner + corner_pattern[quad.p_block_face % 2][i]) % 4)));
+    }
+
+    return;
+}
+
+// neighborhood may be 0 (see VOX__calculate__chunk_mesh_quads)
+VOX__object_datum VOX__create__object_datum__greedy_mesh_from_chunk__lit(VOX__chunk chunk, VOX__chunk_neighborhood* neighborhood, VOX__block_dictionary block_dictionary, VOX__3D_position chunk_offset, VOX__vft vertex_format, u64 lod_level, VOX__allocator* scratch_allocator) {
+    VOX__object_datum output;
+    VOX__buffer quads;
+    u64 quad_count;
+
+    // setup output
+    output = VOX__create_null__object_datum();
+
+    // collect merged quads
+    quads = VOX__create__buffer__allocator(scratch_allocator, sizeof(VOX__chunk_mesh_quad) * VOX__dt__chunk_mesh_maximum_quad_count);
+    quad_count = VOX__calculate__chunk_mesh_quads(chunk, neighborhood, lod_level, block_dictionary, (VOX__chunk_mesh_quad*)quads.p_data);
+
+    // setup vertex & element buffers
+    if (vertex_format == VOX__vft__packed) {
+        output.p_vertices = VOX__create__vbo_vertices__packed(quad_count * 4);
+    } else {
+        output.p_vertices = VOX__create__vbo_vertices(quad_count * 4);
+    }
+    output.p_elements = VOX__create__ebo_vertices(quad_count * 6);
+
+    // fill buffers
+    for (u64 i = 0; i < quad_count; i++) {
+        VOX__write__chunk_mesh_quad_to_object_datum(output, i, ((VOX__chunk_mesh_quad*)quads.p_data)[i], chunk_offset, vertex_format);
+    }
+
+    // clean up quads
+    VOX__destroy__buffer__allocator(scratch_allocator, quads);
+
+    return output;
+}
+
+VOX__object_datum VOX__create__object_datum__greedy_mesh_from_chunk__lod(VOX__chunk chunk, VOX__block_dictionary block_dictionary, VOX__3D_position chunk_offset, VOX__vft vertex_format, u64 lod_level, VOX__allocator* scratch_allocator) {
+    return VOX__create__object_datum__greedy_mesh_from_chunk__lit(chunk, 0, block_dictionary, chunk_offset, vertex_format, lod_level, scratch_allocator);
+}
+
+VOX__object_datum VOX__create__object_datum__greedy_mesh_from_chunk__vertex_format(VOX__chunk chunk, VOX__block_dictionary block_dictionary, VOX__3D_position chunk_offset, VOX__vft vertex_format, VOX__allocator* scratch_allocator) {
+    return VOX__create__object_datum__greedy_mesh_from_chunk__lod(chunk, block_dictionary, chunk_offset, vertex_format, 0, scratch_allocator);
+}
+
+VOX__object_datum VOX__create__object_datum__greedy_mesh_from_chunk(VOX__chunk chunk, VOX__block_dictionary block_dictionary, VOX__3D_position chunk_offset) {
+    return VOX__create__object_datum__greedy_mesh_from_chunk__vertex_format(chunk, block_dictionary, chunk_offset, VOX__vft__float, &VOX__global__heap_allocator);
+}
+
+VOX__object_datum VOX__create__object_datum__greedy_mesh_from_chunk__packed(VOX__chunk chunk, VOX__block_dictionary block_dictionary) {
+    return VOX__create__object_datum__greedy_mesh_from_chunk__vertex_format(chunk, block_dictionary, VOX__create__3D_position(0.0f, 0.0f, 0.0f), VOX__vft__packed, &VOX__global__heap_allocator);
+}
+
+/* Camera */
+typedef struct VOX__camera {
+    f32 p_yaw;
+    f32 p_pitch;
+    vec3 p_position;
+    versor p_angle;
+    mat4 p_matrix_identity;
+    mat4 p_model;
+    mat4 p_view;
+    mat4 p_projection;
+    mat4 p_change;
+} VOX__camera;
+
+VOX__camera VOX__create__camera() {
+    VOX__camera output;
+
+    // camera starting position
+    output.p_yaw = 0.0f;
+    output.p_pitch = 0.0f;
+    glm_vec3_zero(output.p_position);
+    glm_quat_identity(output.p_angle);
+    glm_mat4_identity(output.p_matrix_identity);
+    glm_mat4_identity(output.p_model);
+    glm_mat4_identity(output.p_view);
+    glm_mat4_identity(output.p_projection);
+    glm_mat4_identity(output.p_change);
+
+    return output;
+}
+
+VOX__camera VOX__move__camera(VOX__camera camera, VOX__3D_position camera_position_change, VOX__3D_position camera_rotation_change) {
+    vec3 direction;
+    vec3 front;
+
+    // adjust camera data
+    camera.p_position[0] += camera_position_change.p_x;
+    camera.p_position[1] += camera_position_change.p_y;
+    camera.p_position[2] += camera_position_change.p_z;
+    camera.p_yaw = camera_rotation_change.p_x;
+    camera.p_pitch = camera_rotation_change.p_y;
+
+    // calculate direction
+    direction[0] = cosf(glm_rad(camera.p_yaw)) * cosf(glm_rad(camera.p_pitch));
+    direction[1] = sinf(glm_rad(camera.p_pitch));
+    direction[2] = sinf(glm_rad(camera.p_yaw)) * cosf(glm_rad(camera.p_pitch));
+
+    // normalize direction
+    glm_vec3_norm(direction);
+
+    // calculate camera matrices
+    if (camera_rotation_change.p_x != 0) {
+        glm_quatv(camera.p_angle, glm_rad(camera.p_yaw), (vec3){ 1.0f, 0.0f, 0.0f });
+        glm_quat_rotate(camera.p_model, camera.p_angle, camera.p_model);
+    }
+    if (camera_rotation_change.p_y != 0) {
+        glm_quatv(camera.p_angle, glm_rad(camera.p_pitch), (vec3){ 0.0f, 1.0f, 0.0f });
+        glm_quat_rotate(camera.p_model, camera.p_angle, camera.p_model);
+    }
+    glm_vec3_add(camera.p_position, (vec3){ 0.0f, 0.0f, -1.0f }, front);
+    glm_lookat(camera.p_position, front, (vec3){ 0.0f, 1.0f, 0.0f }, camera.p_view);
+    glm_perspective(glm_rad(45.0f), 720.0 / 480.0, 0.1f, 100.0f, camera.p_projection);
+    
+    // prepare matrices for gpu
+    glm_mat4_mul(camera.p_projection, camera.p_view, camera.p_change);
+    glm_mat4_mul(camera.p_change, camera.p_model, camera.p_change);
+
+    // return changed camera
+    return camera;
+}
+
+/* Frame Uniforms - Camera & Time In One std140 Uniform Buffer Shared By Every Program */
+// matches the VOX_frame block in std140 layout
+typedef struct VOX__frame_uniforms {
+    mat4 p_camera;
+    vec4 p_camera_position; // w is unused
+    vec4 p_time; // x is seconds since start, yzw are unused
+} VOX__frame_uniforms;
+
+typedef struct VOX__frame_uniform_buffer {
+    GLuint p_buffer_ID;
+} VOX__frame_uniform_buffer;
+
+VOX__frame_uniform_buffer VOX__open__frame_uniform_buffer() {
+    VOX__frame_uniform_buffer output;
+
+    // setup buffer & attach it to the binding point every program's block uses
+    glGenBuffers(1, &output.p_buffer_ID);
+    glBindBuffer(GL_UNIFORM_BUFFER, output.p_buffer_ID);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(VOX__frame_uniforms), NULL, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, VOX__dt__frame_uniform_block_binding, output.p_buffer_ID);
+
+    return output;
+}
+
+// once per frame, every program sees the update
+void VOX__send__frame_uniforms(VOX__frame_uniform_buffer frame_uniform_buffer, VOX__camera camera, f32 seconds) {
+    VOX__frame_uniforms frame_uniforms;
+
+    // setup data
+    glm_mat4_copy(camera.p_change, frame_uniforms.p_camera);
+    glm_vec4(camera.p_position, 1.0f, frame_uniforms.p_camera_position);
+    frame_uniforms.p_time[0] = seconds;
+    frame_uniforms.p_time[1] = 0.0f;
+    frame_uniforms.p_time[2] = 0.0f;
+    frame_uniforms.p_time[3] = 0.0f;
+
+    // send
+    glBindBuffer(GL_UNIFORM_BUFFER, frame_uniform_buffer.p_buffer_ID);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(VOX__frame_uniforms), &frame_uniforms);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    return;
+}
+
+void VOX__close__frame_uniform_buffer(VOX__frame_uniform_buffer frame_uniform_buffer) {
+    glDeleteBuffers(1, &frame_uniform_buffer.p_buffer_ID);
+
+    return;
+}
+
+/* Frustum - Camera View Volume For Culling Boxes */
+typedef struct VOX__frustum {
+    vec4 p_planes[6]; // a * x + b * y + c * z + d >= 0 inside, normalized
+} VOX__frustum;
+
+VOX__frustum VOX__create__frustum__from_camera(VOX__camera camera) {
+    VOX__frustum output;
+    f32 length;
+
+    // planes are row 3 plus or minus rows 0, 1 & 2 of the clip matrix (cglm is column major)
+    for (u64 i = 0; i < 3; i++) {
+        for (u64 j = 0; j < 4; j++) {
+            output.p_planes[(i * 2) + 0][j] = camera.p_change[j][3] + camera.p_change[j][i];
+            output.p_planes[(i * 2) + 1][j] = camera.p_change[j][3] - camera.p_change[j][i];
+        }
+    }
+
+    // normalize so distances are in world units
+    for (u64 i = 0; i < 6; i++) {
+        length = sqrtf((output.p_planes[i][0] * output.p_planes[i][0]) + (output.p_planes[i][1] * output.p_planes[i][1]) + (output.p_planes[i][2] * output.p_planes[i][2]));
+        if (length > 0.0f) {
+            for (u64 j = 0; j < 4; j++) {
+                output.p_planes[i][j] /= length;
+            }
+        }
+    }
+
+    return output;
+}
+
+// boxes are given as center & half size (cubes), visible boxes may still be partly outside
+VOX__bt VOX__check__box_is_in_frustum(VOX__frustum* frustum, f32 center_x, f32 center_y, f32 center_z, f32 half_size) {
+    for (u64 i = 0; i < 6; i++) {
+        // box is fully behind one plane (same operation order as the sse path)
+        if ((((*frustum).p_planes[i][0] * center_x) + ((*frustum).p_planes[i][1] * center_y)) + (((*frustum).p_planes[i][2] * center_z) + ((*frustum).p_planes[i][3] + (half_size * (fabsf((*frustum).p_planes[i][0]) + fabsf((*frustum).p_planes[i][1]) + fabsf((*frustum).p_planes[i][2]))))) < 0.0f) {
+            return VOX__bt__false;
+        }
+    }
+
+    return VOX__bt__true;
+}
+
+// writes 1 (visible) or 0 per box, four boxes at a time with sse when available
+void VOX__calculate__boxes_in_frustum(VOX__frustum* frustum, f32* centers_x, f32* centers_y, f32* centers_z, f32 half_size, u64 box_count, u8* visible) {
+    u64 i;
+
+    i = 0;
+#if defined(__SSE2__)
+    __m128 plane_a[6];
+    __m128 plane_b[6];
+    __m128 plane_c[6];
+    __m128 plane_d[6];
+    __m128 inside;
+    __m128 distance;
+    s32 mask;
+
+    // splat planes, folding the box radius into d
+    for (u64 p = 0; p < 6; p++) {
+        plane_a[p] = _mm_set1_ps((*frustum).p_planes[p][0]);
+        plane_b[p] = _mm_set1_ps((*frustum).p_planes[p][1]);
+        plane_c[p] = _mm_set1_ps((*frustum).p_planes[p][2]);
+        plane_d[p] = _mm_set1_ps((*frustum).p_planes[p][3] + (half_size * (fabsf((*frustum).p_planes[p][0]) + fabsf((*frustum).p_planes[p][1]) + fabsf((*frustum).p_planes[p][2]))));
+    }
+
+    // test four boxes per step
+    for (; i + 4 <= box_count; i += 4) {
+        inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (u64 p = 0; p < 6; p++) {
+            distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(plane_a[p], _mm_loadu_ps(centers_x + i)), _mm_mul_ps(plane_b[p], _mm_loadu_ps(centers_y + i))), _mm_add_ps(_mm_mul_ps(plane_c[p], _mm_loadu_ps(centers_z + i)), plane_d[p]));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+        }
+
+        mask = _mm_movemask_ps(inside);
+        visible[i + 0] = (mask >> 0) & 1;
+        visible[i + 1] = (mask >> 1) & 1;
+        visible[i + 2] = (mask >> 2) & 1;
+        visible[i + 3] = (mask >> 3) & 1;
+    }
+#endif
+
+    // scalar remainder (or everything without sse)
+    for (; i < box_count; i++) {
+        visible[i] = VOX__check__box_is_in_frustum(frustum, centers_x[i], centers_y[i], centers_z[i], half_size);
+    }
+
+    return;
+}
+
+/* Chunk Positions - Integer Chunk Coordinates In The World */
+typedef struct VOX__chunk_position {
+    s32 p_x;
+    s32 p_y;
+    s32 p_z;
+} VOX__chunk_position;
+
+VOX__chunk_position VOX__create__chunk_position(s32 x, s32 y, s32 z) {
+    VOX__chunk_position output;
+
+    // setup output
+    output.p_x = x;
+    output.p_y = y;
+    output.p_z = z;
+
+    return output;
+}
+
+VOX__chunk_position VOX__calculate__chunk_position_from_world_position(f32 x, f32 y, f32 z) {
+    return VOX__create__chunk_position((s32)floorf(x / VOX__dt__chunk_side_length), (s32)floorf(y / VOX__dt__chunk_side_length), (s32)floorf(z / VOX__dt__chunk_side_length));
+}
+
+VOX__3D_position VOX__calculate__world_position_from_chunk_position(VOX__chunk_position chunk_position) {
+    return VOX__create__3D_position((f32)(chunk_position.p_x * VOX__dt__chunk_side_length), (f32)(chunk_position.p_y * VOX__dt__chunk_side_length), (f32)(chunk_position.p_z * VOX__dt__chunk_side_length));
+}
+
+VOX__bt VOX__check__chunk_positions_are_equal(VOX__chunk_position a, VOX__chunk_position b) {
+    return a.p_x == b.p_x && a.p_y == b.p_y && a.p_z == b.p_z;
+}
+
+VOX__bt VOX__check__chunk_position_is_within_radius(VOX__chunk_position center, VOX__chunk_position chunk_position, s32 radius, s32 height_radius) {
+    return abs(chunk_position.p_x - center.p_x) <= radius && abs(chunk_position.p_z - center.p_z) <= radius && abs(chunk_position.p_y - center.p_y) <= height_radius;
+}
+
+// the level rises each time the distance (in chunks, largest axis) passes lod_distance, 3 lod_distance, 7 lod_distance..., 0 keeps full detail
+u64 VOX__calculate__chunk_lod_level(VOX__chunk_position center, VOX__chunk_position chunk_position, s32 lod_distance) {
+    u64 output;
+    s32 distance;
+
+    // setup output
+    output = 0;
+
+    // full detail everywhere
+    if (lod_distance <= 0) {
+        return output;
+    }
+
+    // setup distance
+    distance = abs(chunk_position.p_x - center.p_x);
+    if (abs(chunk_position.p_y - center.p_y) > distance) {
+        distance = abs(chunk_position.p_y - center.p_y);
+    }
+    if (abs(chunk_position.p_z - center.p_z) > distance) {
+        distance = abs(chunk_position.p_z - center.p_z);
+    }
+
+    // each level covers twice the distance of the one before, keeping the on screen cell size about even
+    while (output + 1 < VOX__dt__chunk_lod_count && distance >= lod_distance * ((2 << output) - 1)) {
+        output++;
+    }
+
+    return output;
+}
+
+u64 VOX__calculate__chunk_position_hash(VOX__chunk_position chunk_position) {
+    u64 output;
+
+    // mix each axis with a different odd constant
+    output = ((u64)(u32)chunk_position.p_x * 0x9E3779B97F4A7C15llu) ^ ((u64)(u32)chunk_position.p_y * 0xC2B2AE3D27D4EB4Fllu) ^ ((u64)(u32)chunk_position.p_z * 0x165667B19E3779F9llu);
+
+    // fold high bits down for masking
+    output ^= output >> 29;
+    output *= 0xBF58476D1CE4E5B9llu;
+    output ^= output >> 32;
+
+    return output;
+}
+
+/* Terrain Noise - Seeded Gradient Noise In Fractal Octaves, 8 Or 4 Samples At Once With A Bit Identical Scalar Path */
+// noise kernel type
+typedef enum VOX__nkt {
+    VOX__nkt__unknown, // not detected yet
+    VOX__nkt__scalar,
+    VOX__nkt__sse2,
+    VOX__nkt__avx2
+} VOX__nkt;
+
+_Atomic u32 VOX__global__noise_kernel; // VOX__nkt, detected on first use
+
+// widest kernel this processor runs
+VOX__nkt VOX__calculate__noise_kernel() {
+#if defined(__SSE2__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return VOX__nkt__avx2;
+    }
+
+    return VOX__nkt__sse2;
+#else
+    return VOX__nkt__scalar;
+#endif
+}
+
+VOX__nkt VOX__read__noise_kernel() {
+    VOX__nkt output;
+
+    // detect once (racing threads detect the same answer)
+    output = (VOX__nkt)atomic_load_explicit(&VOX__global__noise_kernel, memory_order_relaxed);
+    if (output == VOX__nkt__unknown) {
+        output = VOX__calculate__noise_kernel();
+        atomic_store_explicit(&VOX__global__noise_kernel, output, memory_order_relaxed);
+    }
+
+    return output;
+}
+
+// every kernel does the same float operations in the same order, so multiplies & adds must stay separate (a fused multiply add rounds once instead of twice)
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+// one at a time style mixing, multiply free so sse2 can run it too
+u32 VOX__calculate__noise_hash(u32 x, u32 y, u32 z, u32 seed) {
+    u32 output;
+
+    // setup output
+    output = seed;
+
+    // mix in each coordinate
+    output += x;
+    output += output << 10;
+    output ^= output >> 6;
+    output += y;
+    output += output << 10;
+    output ^= output >> 6;
+    output += z;
+    output += output << 10;
+    output ^= output >> 6;
+
+    // final avalanche
+    output += output << 3;
+    output ^= output >> 11;
+    output += output << 15;
+
+    return output;
+}
+
+// octaves get unrelated lattices so their features do not line up at the origin
+u32 VOX__calculate__noise_octave_seed(u32 seed, u64 octave) {
+    return seed + ((u32)octave * 0x9E3779B9u);
+}
+
+f32 VOX__calculate__noise_fade(f32 t) {
+    return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+}
+
+s32 VOX__calculate__noise_floor(f32 x) {
+    s32 output;
+
+    // truncate, then step down for negative fractions
+    output = (s32)x;
+    output -= (f32)output > x;
+
+    return output;
+}
+
+// hash bits are random, so the scalar path picks & negates with bit masks instead of branches that would mispredict half the time
+f32 VOX__select__noise_value(u32 mask, f32 a, f32 b) {
+    u32 a_bits;
+    u32 b_bits;
+
+    __builtin_memcpy(&a_bits, &a, sizeof(u32));
+    __builtin_memcpy(&b_bits, &b, sizeof(u32));
+    a_bits = (a_bits & mask) | (b_bits & ~mask);
+    __builtin_memcpy(&a, &a_bits, sizeof(u32));
+
+    return a;
+}
+
+f32 VOX__flip__noise_value(f32 value, u32 sign) {
+    u32 bits;
+
+    __builtin_memcpy(&bits, &value, sizeof(u32));
+    bits ^= sign & 0x80000000u;
+    __builtin_memcpy(&value, &bits, sizeof(u32));
+
+    return value;
+}
+
+// gradients (+-1, +-2) & (+-2, +-1) picked by the low hash bits
+f32 VOX__calculate__noise_gradient_2D(u32 hash, f32 x, f32 y) {
+    f32 a;
+    f32 b;
+
+    a = VOX__select__noise_value(0u - ((hash >> 2) & 1), x, y);
+    b = VOX__select__noise_value(0u - ((hash >> 2) & 1), y, x);
+    a = VOX__flip__noise_value(a, hash << 31);
+    b = VOX__flip__noise_value(b + b, hash << 30);
+
+    return a + b;
+}
+
+// the 12 cube edge gradients (with 4 repeated) picked by the low hash bits
+f32 VOX__calculate__noise_gradient_3D(u32 hash, f32 x, f32 y, f32 z) {
+    f32 u;
+    f32 v;
+
+    hash &= 15;
+    u = VOX__select__noise_value(0u - (u32)(hash < 8), x, y);
+    v = VOX__select__noise_value(0u - (u32)(hash < 4), y, VOX__select__noise_value(0u - (u32)((hash & 13) == 12), x, z));
+    u = VOX__flip__noise_value(u, hash << 31);
+    v = VOX__flip__noise_value(v, hash << 30);
+
+    return u + v;
+}
+
+// roughly in [-1, 1]
+f32 VOX__calculate__gradient_noise_2D(f32 x, f32 y, u32 seed) {
+    s32 ix;
+    s32 iy;
+    f32 fx;
+    f32 fy;
+    f32 u;
+    f32 v;
+    f32 n00;
+    f32 n10;
+    f32 n01;
+    f32 n11;
+    f32 n0;
+    f32 n1;
+
+    // setup cell & position inside it
+    ix = VOX__calculate__noise_floor(x);
+    iy = VOX__calculate__noise_floor(y);
+    fx = x - (f32)ix;
+    fy = y - (f32)iy;
+    u = VOX__calculate__noise_fade(fx);
+    v = VOX__calculate__noise_fade(fy);
+
+    // corner contributions
+    n00 = VOX__calculate__noise_gradient_2D(VOX__calculate__noise_hash((u32)ix, (u32)iy, 0, seed), fx, fy);
+    n10 = VOX__calculate__noise_gradient_2D(VOX__calculate__noise_hash((u32)ix + 1, (u32)iy, 0, seed), fx - 1.0f, fy);
+    n01 = VOX__calculate__noise_gradient_2D(VOX__calculate__noise_hash((u32)ix, (u32)iy + 1, 0, seed), fx, fy - 1.0f);
+    n11 = VOX__calculate__noise_gradient_2D(VOX__calculate__noise_hash((u32)ix + 1, (u32)iy + 1, 0, seed), fx - 1.0f, fy - 1.0f);
+
+    // blend
+    n0 = n00 + u * (n10 - n00);
+    n1 = n01 + u * (n11 - n01);
+
+    return (n0 + v * (n1 - n0)) * 0.5f;
+}
+
+// roughly in [-1, 1]
+f32 VOX__calculate__gradient_noise_3D(f32 x, f32 y, f32 z, u32 seed) {
+    s32 ix;
+    s32 iy;
+    s32 iz;
+    f32 fx;
+    f32 fy;
+    f32 fz;
+    f32 u;
+    f32 v;
+    f32 w;
+    f32 n[8];
+    f32 n00;
+    f32 n10;
+    f32 n01;
+    f32 n11;
+    f32 n0;
+    f32 n1;
+
+    // setup cell & position inside it
+    ix = VOX__calculate__noise_floor(x);
+    iy = VOX__calculate__noise_floor(y);
+    iz = VOX__calculate__noise_floor(z);
+    fx = x - (f32)ix;
+    fy = y - (f32)iy;
+    fz = z - (f32)iz;
+    u = VOX__calculate__noise_fade(fx);
+    v = VOX__calculate__noise_fade(fy);
+    w = VOX__calculate__noise_fade(fz);
+
+    // corner contributions (corner i is x + 1 on bit 0, y + 1 on bit 1, z + 1 on bit 2)
+    for (u32 i = 0; i < 8; i++) {
+        n[i] = VOX__calculate__noise_gradient_3D(VOX__calculate__noise_hash((u32)ix + (i & 1), (u32)iy + ((i >> 1) & 1), (u32)iz + (i >> 2), seed), (i & 1) ? fx - 1.0f : fx, (i & 2) ? fy - 1.0f : fy, (i & 4) ? fz - 1.0f : fz);
+    }
+
+    // blend along x, then y, then z
+    n00 = n[0] + u * (n[1] - n[0]);
+    n10 = n[2] + u * (n[3] - n[2]);
+    n01 = n[4] + u * (n[5] - n[4]);
+    n11 = n[6] + u * (n[7] - n[6]);
+    n0 = n00 + v * (n10 - n00);
+    n1 = n01 + v * (n11 - n01);
+
+    return n0 + w * (n1 - n0);
+}
+
+// octave o adds noise at frequency * 2^o weighted by 0.5^o
+void VOX__calculate__fractal_noise_2D__scalar(f32* xs, f32* ys, u64 count, f32 frequency, u64 octave_count, u32 seed, f32* output) {
+    f32 octave_frequency;
+    f32 amplitude;
+
+    for (u64 i = 0; i < count; i++) {
+        output[i] = 0.0f;
+        octave_frequency = frequency;
+        amplitude = 1.0f;
+
+        for (u64 octave = 0; octave < octave_count; octave++) {
+            output[i] = output[i] + amplitude * VOX__calculate__gradient_noise_2D(xs[i] * octave_frequency, ys[i] * octave_frequency, VOX__calculate__noise_octave_seed(seed, octave));
+            octave_frequency *= 2.0f;
+            amplitude *= 0.5f;
+        }
+    }
+
+    return;
+}
+
+void VOX__calculate__fractal_noise_3D__scalar(f32* xs, f32* ys, f32* zs, u64 count, f32 frequency, u64 octave_count, u32 seed, f32* output) {
+    f32 octave_frequency;
+    f32 amplitude;
+
+    for (u64 i = 0; i < count; i++) {
+        output[i] = 0.0f;
+        octave_frequency = frequency;
+        amplitude = 1.0f;
+
+        for (u64 octave = 0; octave < octave_count; octave++) {
+            output[i] = output[i] + amplitude * VOX__calculate__gradient_noise_3D(xs[i] * octave_frequency, ys[i] * octave_frequency, zs[i] * octave_frequency, VOX__calculate__noise_octave_seed(seed, octave));
+            octave_frequency *= 2.0f;
+            amplitude *= 0.5f;
+        }
+    }
+
+    return;
+}
+
+#if defined(__SSE2__)
+// the vector kernels mirror the scalar functions above line for line, 4 lanes at a time
+__m128i VOX__calculate__noise_hash__sse2(__m128i x, __m128i y, __m128i z, __m128i seed) {
+    __m128i output;
+
+    output = seed;
+    output = _mm_add_epi32(output, x);
+    output = _mm_add_epi32(output, _mm_slli_epi32(output, 10));
+    output = _mm_xor_si128(output, _mm_srli_epi32(output, 6));
+    output = _mm_add_epi32(output, y);
+    output = _mm_add_epi32(output, _mm_slli_epi32(output, 10));
+    output = _mm_xor_si128(output, _mm_srli_epi32(output, 6));
+    output = _mm_add_epi32(output, z);
+    output = _mm_add_epi32(output, _mm_slli_epi32(output, 10));
+    output = _mm_xor_si128(output, _mm_srli_epi32(output, 6));
+    output = _mm_add_epi32(output, _mm_slli_epi32(output, 3));
+    output = _mm_xor_si128(output, _mm_srli_epi32(output, 11));
+    output = _mm_add_epi32(output, _mm_slli_epi32(output, 15));
+
+    return output;
+}
+
+__m128 VOX__calculate__noise_fade__sse2(__m128 t) {
+    return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f)));
+}
+
+__m128i VOX__calculate__noise_floor__sse2(__m128 x) {
+    __m128i output;
+
+    // truncate, then add -1 where that went up
+    output = _mm_cvttps_epi32(x);
+
+    return _mm_add_epi32(output, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(output), x)));
+}
+
+__m128 VOX__select__noise_lanes__sse2(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+__m128 VOX__calculate__noise_gradient_2D__sse2(__m128i hash, __m128 x, __m128 y) {
+    __m128 swap;
+    __m128 a;
+    __m128 b;
+
+    swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(hash, _mm_set1_epi32(4)), _mm_set1_epi32(4)));
+    a = VOX__select__noise_lanes__sse2(swap, x, y);
+    b = VOX__select__noise_lanes__sse2(swap, y, x);
+    a = _mm_xor_ps(a, _mm_castsi128_ps(_mm_slli_epi32(hash, 31)));
+    b = _mm_xor_ps(_mm_add_ps(b, b), _mm_castsi128_ps(_mm_and_si128(_mm_slli_epi32(hash, 30), _mm_set1_epi32((s32)0x80000000))));
+
+    return _mm_add_ps(a, b);
+}
+
+__m128 VOX__calculate__noise_gradient_3D__sse2(__m128i hash, __m128 x, __m128 y, __m128 z) {
+    __m128 u;
+    __m128 v;
+
+    hash = _mm_and_si128(hash, _mm_set1_epi32(15));
+    u = VOX__select__noise_lanes__sse2(_mm_castsi128_ps(_mm_cmplt_epi32(hash, _mm_set1_epi32(8))), x, y);
+    v = VOX__select__noise_lanes__sse2(_mm_castsi128_ps(_mm_cmplt_epi32(hash, _mm_set1_epi32(4))), y, VOX__select__noise_lanes__sse2(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(hash, _mm_set1_epi32(13)), _mm_set1_epi32(12))), x, z));
+    u = _mm_xor_ps(u, _mm_castsi128_ps(_mm_slli_epi32(hash, 31)));
+    v = _mm_xor_ps(v, _mm_castsi128_ps(_mm_and_si128(_mm_slli_epi32(hash, 30), _mm_set1_epi32((s32)0x80000000))));
+
+    return _mm_add_ps(u, v);
+}
+
+__m128 VOX__calculate__gradient_noise_2D__sse2(__m128 x, __m128 y, __m128i seed) {
+    __m128i ix;
+    __m128i iy;
+    __m128i ix1;
+    __m128i iy1;
+    __m128 fx;
+    __m128 fy;
+    __m128 fx1;
+    __m128 fy1;
+    __m128 u;
+    __m128 v;
+    __m128 n00;
+    __m128 n10;
+    __m128 n01;
+    __m128 n11;
+    __m128 n0;
+    __m128 n1;
+
+    // setup cell & position inside it
+    ix = VOX__calculate__noise_floor__sse2(x);
+    iy = VOX__calculate__noise_floor__sse2(y);
+    ix1 = _mm_add_epi32(ix, _mm_set1_epi32(1));
+    iy1 = _mm_add_epi32(iy, _mm_set1_epi32(1));
+    fx = _mm_sub_ps(x, _mm_cvtepi32_ps(ix));
+    fy = _mm_sub_ps(y, _mm_cvtepi32_ps(iy));
+    fx1 = _mm_sub_ps(fx, _mm_set1_ps(1.0f));
+    fy1 = _mm_sub_ps(fy, _mm_set1_ps(1.0f));
+    u = VOX__calculate__noise_fade__sse2(fx);
+    v = VOX__calculate__noise_fade__sse2(fy);
+
+    // corner contributions
+    n00 = VOX__calculate__noise_gradient_2D__sse2(VOX__calculate__noise_hash__sse2(ix, iy, _mm_setzero_si128(), seed), fx, fy);
+    n10 = VOX__calculate__noise_gradient_2D__sse2(VOX__calculate__noise_hash__sse2(ix1, iy, _mm_setzero_si128(), seed), fx1, fy);
+    n01 = VOX__calculate__noise_gradient_2D__sse2(VOX__calculate__noise_hash__sse2(ix, iy1, _mm_setzero_si128(), seed), fx, fy1);
+    n11 = VOX__calculate__noise_gradient_2D__sse2(VOX__calculate__noise_hash__sse2(ix1, iy1, _mm_setzero_si128(), seed), fx1, fy1);
+
+    // blend
+    n0 = _mm_add_ps(n00, _mm_mul_ps(u, _mm_sub_ps(n10, n00)));
+    n1 = _mm_add_ps(n01, _mm_mul_ps(u, _mm_sub_ps(n11, n01)));
+
+    return _mm_mul_ps(_mm_add_ps(n0, _mm_mul_ps(v, _mm_sub_ps(n1, n0))), _mm_set1_ps(0.5f));
+}
+
+__m128 VOX__calculate__gradient_noise_3D__sse2(__m128 x, __m128 y, __m128 z, __m128i seed) {
+    __m128i ix[2];
+    __m128i iy[2];
+    __m128i iz[2];
+    __m128 fx[2];
+    __m128 fy[2];
+    __m128 fz[2];
+    __m128 u;
+    __m128 v;
+    __m128 w;
+    __m128 n[8];
+    __m128 n00;
+    __m128 n10;
+    __m128 n01;
+    __m128 n11;
+    __m128 n0;
+    __m128 n1;
+
+    // setup cell & position inside it (index 1 is the far corner)
+    ix[0] = VOX__calculate__noise_floor__sse2(x);
+    iy[0] = VOX__calculate__noise_floor__sse2(y);
+    iz[0] = VOX__calculate__noise_floor__sse2(z);
+    ix[1] = _mm_add_epi32(ix[0], _mm_set1_epi32(1));
+    iy[1] = _mm_add_epi32(iy[0], _mm_set1_epi32(1));
+    iz[1] = _mm_add_epi32(iz[0], _mm_set1_epi32(1));
+    fx[0] = _mm_sub_ps(x, _mm_cvtepi32_ps(ix[0]));
+    fy[0] = _mm_sub_ps(y, _mm_cvtepi32_ps(iy[0]));
+    fz[0] = _mm_sub_ps(z, _mm_cvtepi32_ps(iz[0]));
+    fx[1] = _mm_sub_ps(fx[0], _mm_set1_ps(1.0f));
+    fy[1] = _mm_sub_ps(fy[0], _mm_set1_ps(1.0f));
+    fz[1] = _mm_sub_ps(fz[0], _mm_set1_ps(1.0f));
+    u = VOX__calculate__noise_fade__sse2(fx[0]);
+    v = VOX__calculate__noise_fade__sse2(fy[0]);
+    w = VOX__calculate__noise_fade__sse2(fz[0]);
+
+    // corner contributions
+    for (u32 i = 0; i < 8; i++) {
+        n[i] = VOX__calculate__noise_gradient_3D__sse2(VOX__calculate__noise_hash__sse2(ix[i & 1], iy[(i >> 1) & 1], iz[i >> 2], seed), fx[i & 1], fy[(i >> 1) & 1], fz[i >> 2]);
+    }
+
+    // blend along x, then y, then z
+    n00 = _mm_add_ps(n[0], _mm_mul_ps(u, _mm_sub_ps(n[1], n[0])));
+    n10 = _mm_add_ps(n[2], _mm_mul_ps(u, _mm_sub_ps(n[3], n[2])));
+    n01 = _mm_add_ps(n[4], _mm_mul_ps(u, _mm_sub_ps(n[5], n[4])));
+    n11 = _mm_add_ps(n[6], _mm_mul_ps(u, _mm_sub_ps(n[7], n[6])));
+    n0 = _mm_add_ps(n00, _mm_mul_ps(v, _mm_sub_ps(n10, n00)));
+    n1 = _mm_add_ps(n01, _mm_mul_ps(v, _mm_sub_ps(n11, n01)));
+
+    return _mm_add_ps(n0, _mm_mul_ps(w, _mm_sub_ps(n1, n0)));
+}
+
+void VOX__calculate__fractal_noise_2D__sse2(f32* xs, f32* ys, u64 count, f32 frequency, u64 octave_count, u32 seed, f32* output) {
+    __m128 x;
+    __m128 y;
+    __m128 sum;
+    __m128 octave_frequency;
+    __m128 amplitude;
+    u64 i;
+
+    // four samples per step
+    for (i = 0; i + 4 <= count; i += 4) {
+        x = _mm_loadu_ps(xs + i);
+        y = _mm_loadu_ps(ys + i);
+        sum = _mm_setzero_ps();
+        octave_frequency = _mm_set1_ps(frequency);
+        amplitude = _mm_set1_ps(1.0f);
+
+        for (u64 octave = 0; octave < octave_count; octave++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(amplitude, VOX__calculate__gradient_noise_2D__sse2(_mm_mul_ps(x, octave_frequency), _mm_mul_ps(y, octave_frequency), _mm_set1_epi32((s32)VOX__calculate__noise_octave_seed(seed, octave)))));
+            octave_frequency = _mm_mul_ps(octave_frequency, _mm_set1_ps(2.0f));
+            amplitude = _mm_mul_ps(amplitude, _mm_set1_ps(0.5f));
+        }
+
+        _mm_storeu_ps(output + i, sum);
+    }
+
+    // remainder
+    VOX__calculate__fractal_noise_2D__scalar(xs + i, ys + i, count - i, frequency, octave_count, seed, output + i);
+
+    return;
+}
+
+void VOX__calculate__fractal_noise_3D__sse2(f32* xs, f32* ys, f32* zs, u64 count, f32 frequency, u64 octave_count, u32 seed, f32* output) {
+    __m128 x;
+    __m128 y;
+    __m128 z;
+    __m128 sum;
+    __m128 octave_frequency;
+    __m128 amplitude;
+    u64 i;
+
+    // four samples per step
+    for (i = 0; i + 4 <= count; i += 4) {
+        x = _mm_loadu_ps(xs + i);
+        y = _mm_loadu_ps(ys + i);
+        z = _mm_loadu_ps(zs + i);
+        sum = _mm_setzero_ps();
+        octave_frequency = _mm_set1_ps(frequency);
+        amplitude = _mm_set1_ps(1.0f);
+
+        for (u64 octave = 0; octave < octave_count; octave++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(amplitude, VOX__calculate__gradient_noise_3D__sse2(_mm_mul_ps(x, octave_frequency), _mm_mul_ps(y, octave_frequency), _mm_mul_ps(z, octave_frequency), _mm_set1_epi32((s32)VOX__calculate__noise_octave_seed(seed, octave)))));
+            octave_frequency = _mm_mul_ps(octave_frequency, _mm_set1_ps(2.0f));
+            amplitude = _mm_mul_ps(amplitude, _mm_set1_ps(0.5f));
+        }
+
+        _mm_storeu_ps(output + i, sum);
+    }
+
+    // remainder
+    VOX__calculate__fractal_noise_3D__scalar(xs + i, ys + i, zs + i, count - i, frequency, octave_count, seed, output + i);
+
+    return;
+}
+
+// 8 lanes at a time
+__attribute__((target("avx2"))) __m256i VOX__calculate__noise_hash__avx2(__m256i x, __m256i y, __m256i z, __m256i seed) {
+    __m256i output;
+
+    output = seed;
+    output = _mm256_add_epi32(output, x);
+    output = _mm256_add_epi32(output, _mm256_slli_epi32(output, 10));
+    output = _mm256_xor_si256(output, _mm256_srli_epi32(output, 6));
+    output = _mm256_add_epi32(output, y);
+    output = _mm256_add_epi32(output, _mm256_slli_epi32(output, 10));
+    output = _mm256_xor_si256(output, _mm256_srli_epi32(output, 6));
+    output = _mm256_add_epi32(output, z);
+    output = _mm256_add_epi32(output, _mm256_slli_epi32(output, 10));
+    output = _mm256_xor_si256(output, _mm256_srli_epi32(output, 6));
+    output = _mm256_add_epi32(output, _mm256_slli_epi32(output, 3));
+    output = _mm256_xor_si256(output, _mm256_srli_epi32(output, 11));
+    output = _mm256_add_epi32(output, _mm256_slli_epi32(output, 15));
+
+    return output;
+}
+
+__attribute__((target("avx2"))) __m256 VOX__calculate__noise_fade__avx2(__m256 t) {
+    return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), _mm256_add_ps(_mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f))), _mm256_set1_ps(10.0f)));
+}
+
+__attribute__((target("avx2"))) __m256i VOX__calculate__noise_floor__avx2(__m256 x) {
+    __m256i output;
+
+    // truncate, then add -1 where that went up
+    output = _mm256_cvttps_epi32(x);
+
+    return _mm256_add_epi32(output, _mm256_castps_si256(_mm256_cmp_ps(_mm256_cvtepi32_ps(output), x, _CMP_GT_OQ)));
+}
+
+__attribute__((target("avx2"))) __m256 VOX__calculate__noise_gradient_2D__avx2(__m256i hash, __m256 x, __m256 y) {
+    __m256 swap;
+    __m256 a;
+    __m256 b;
+
+    swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(hash, _mm256_set1_epi32(4)), _mm256_set1_epi32(4)));
+    a = _mm256_blendv_ps(y, x, swap);
+    b = _mm256_blendv_ps(x, y, swap);
+    a = _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_slli_epi32(hash, 31)));
+    b = _mm256_xor_ps(_mm256_add_ps(b, b), _mm256_castsi256_ps(_mm256_and_si256(_mm256_slli_epi32(hash, 30), _mm256_set1_epi32((s32)0x80000000))));
+
+    return _mm256_add_ps(a, b);
+}
+
+__attribute__((target("avx2"))) __m256 VOX__calculate__noise_gradient_3D__avx2(__m256i hash, __m256 x, __m256 y, __m256 z) {
+    __m256 u;
+    __m256 v;
+
+    hash = _mm256_and_si256(hash, _mm256_set1_epi32(15));
+    u = _mm256_blendv_ps(y, x, _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(8), hash)));
+    v = _mm256_blendv_ps(_mm256_blendv_ps(z, x, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(hash, _mm256_set1_epi32(13)), _mm256_set1_epi32(12)))), y, _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), hash)));
+    u = _mm256_xor_ps(u, _mm256_castsi256_ps(_mm256_slli_epi32(hash, 31)));
+    v = _mm256_xor_ps(v, _mm256_castsi256_ps(_mm256_and_si256(_mm256_slli_epi32(hash, 30), _mm256_set1_epi32((s32)0x80000000))));
+
+    return _mm256_add_ps(u, v);
+}
+
+__attribute__((target("avx2"))) __m256 VOX__calculate__gradient_noise_2D__avx2(__m256 x, __m256 y, __m256i seed) {
+    __m256i ix;
+    __m256i iy;
+    __m256i ix1;
+    __m256i iy1;
+    __m256 fx;
+    __m256 fy;
+    __m256 fx1;
+    __m256 fy1;
+    __m256 u;
+    __m256 v;
+    __m256 n00;
+    __m256 n10;
+    __m256 n01;
+    __m256 n11;
+    __m256 n0;
+    __m256 n1;
+
+    // setup cell & position inside it
+    ix = VOX__calculate__noise_floor__avx2(x);
+    iy = VOX__calculate__noise_floor__avx2(y);
+    ix1 = _mm256_add_epi32(ix, _mm256_set1_epi32(1));
+    iy1 = _mm256_add_epi32(iy, _mm256_set1_epi32(1));
+    fx = _mm256_sub_ps(x, _mm256_cvtepi32_ps(ix));
+    fy = _mm256_sub_ps(y, _mm256_cvtepi32_ps(iy));
+    fx1 = _mm256_sub_ps(fx, _mm256_set1_ps(1.0f));
+    fy1 = _mm256_sub_ps(fy, _mm256_set1_ps(1.0f));
+    u = VOX__calculate__noise_fade__avx2(fx);
+    v = VOX__calculate__noise_fade__avx2(fy);
+
+    // corner contributions
+    n00 = VOX__calculate__noise_gradient_2D__avx2(VOX__calculate__noise_hash__avx2(ix, iy, _mm256_setzero_si256(), seed), fx, fy);
+    n10 = VOX__calculate__noise_gradient_2D__avx2(VOX__calculate__noise_hash__avx2(ix1, iy, _mm256_setzero_si256(), seed), fx1, fy);
+    n01 = VOX__calculate__noise_gradient_2D__avx2(VOX__calculate__noise_hash__avx2(ix, iy1, _mm256_setzero_si256(), seed), fx, fy1);
+    n11 = VOX__calculate__noise_gradient_2D__avx2(VOX__calculate__noise_hash__avx2(ix1, iy1, _mm256_setzero_si256(), seed), fx1, fy1);
+
+    // blend
+    n0 = _mm256_add_ps(n00, _mm256_mul_ps(u, _mm256_sub_ps(n10, n00)));
+    n1 = _mm256_add_ps(n01, _mm256_mul_ps(u, _mm256_sub_ps(n11, n01)));
+
+    return _mm256_mul_ps(_mm256_add_ps(n0, _mm256_mul_ps(v, _mm256_sub_ps(n1, n0))), _mm256_set1_ps(0.5f));
+}
+
+__attribute__((target("avx2"))) __m256 VOX__calculate__gradient_noise_3D__avx2(__m256 x, __m256 y, __m256 z, __m256i seed) {
+    __m256i ix[2];
+    __m256i iy[2];
+    __m256i iz[2];
+    __m256 fx[2];
+    __m256 fy[2];
+    __m256 fz[2];
+    __m256 u;
+    __m256 v;
+    __m256 w;
+    __m256 n[8];
+    __m256 n00;
+    __m256 n10;
+    __m256 n01;
+    __m256 n11;
+    __m256 n0;
+    __m256 n1;
+
+    // setup cell & position inside it (index 1 is the far corner)
+    ix[0] = VOX__calculate__noise_floor__avx2(x);
+    iy[0] = VOX__calculate__noise_floor__avx2(y);
+    iz[0] = VOX__calculate__noise_floor__avx2(z);
+    ix[1] = _mm256_add_epi32(ix[0], _mm256_set1_epi32(1));
+    iy[1] = _mm256_add_epi32(iy[0], _mm256_set1_epi32(1));
+    iz[1] = _mm256_add_epi32(iz[0], _mm256_set1_epi32(1));
+    fx[0] = _mm256_sub_ps(x, _mm256_cvtepi32_ps(ix[0]));
+    fy[0] = _mm256_sub_ps(y, _mm256_cvtepi32_ps(iy[0]));
+    fz[0] = _mm256_sub_ps(z, _mm256_cvtepi32_ps(iz[0]));
+    fx[1] = _mm256_sub_ps(fx[0], _mm256_set1_ps(1.0f));
+    fy[1] = _mm256_sub_ps(fy[0], _mm256_set1_ps(1.0f));
+    fz[1] = _mm256_sub_ps(fz[0], _mm256_set1_ps(1.0f));
+    u = VOX__calculate__noise_fade__avx2(fx[0]);
+    v = VOX__calculate__noise_fade__avx2(fy[0]);
+    w = VOX__calculate__noise_fade__avx2(fz[0]);
+
+    // corner contributions
+    for (u32 i = 0; i < 8; i++) {
+        n[i] = VOX__calculate__noise_gradient_3D__avx2(VOX__calculate__noise_hash__avx2(ix[i & 1], iy[(i >> 1) & 1], iz[i >> 2], seed), fx[i & 1], fy[(i >> 1) & 1], fz[i >> 2]);
+    }
+
+    // blend along x, then y, then z
+    n00 = _mm256_add_ps(n[0], _mm256_mul_ps(u, _mm256_sub_ps(n[1], n[0])));
+    n10 = _mm256_add_ps(n[2], _mm256_mul_ps(u, _mm256_sub_ps(n[3], n[2])));
+    n01 = _mm256_add_ps(n[4], _mm256_mul_ps(u, _mm256_sub_ps(n[5], n[4])));
+    n11 = _mm256_add_ps(n[6], _mm256_mul_ps(u, _mm256_sub_ps(n[7], n[6])));
+    n0 = _mm256_add_ps(n00, _mm256_mul_ps(v, _mm256_sub_ps(n10, n00)));
+    n1 = _mm256_add_ps(n01, _mm256_mul_ps(v, _mm256_sub_ps(n11, n01)));
+
+    return _mm256_add_ps(n0, _mm256_mul_ps(w, _mm256_sub_ps(n1, n0)));
+}
+
+__attribute__((target("avx2"))) void VOX__calculate__fractal_noise_2D__avx2(f32* xs, f32* ys, u64 count, f32 frequency, u64 octave_count, u32 seed, f32* output) {
+    __m256 x;
+    __m256 y;
+    __m256 sum;
+    __m256 octave_frequency;
+    __m256 amplitude;
+    u64 i;
+
+    // eight samples per step
+    for (i = 0; i + 8 <= count; i += 8) {
+        x = _mm256_loadu_ps(xs + i);
+        y = _mm256_loadu_ps(ys + i);
+        sum = _mm256_setzero_ps();
+        octave_frequency = _mm256_set1_ps(frequency);
+        amplitude = _mm256_set1_ps(1.0f);
+
+        for (u64 octave = 0; octave < octave_count; octave++) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(amplitude, VOX__calculate__gradient_noise_2D__avx2(_mm256_mul_ps(x, octave_frequency), _mm256_mul_ps(y, octave_frequency), _mm256_set1_epi32((s32)VOX__calculate__noise_octave_seed(seed, octave)))));
+            octave_frequency = _mm256_mul_ps(octave_frequency, _mm256_set1_ps(2.0f));
+            amplitude = _mm256_mul_ps(amplitude, _mm256_set1_ps(0.5f));
+        }
+
+        _mm256_storeu_ps(output + i, sum);
+    }
+
+    // remainder
+    VOX__calculate__fractal_noise_2D__sse2(xs + i, ys + i, count - i, frequency, octave_count, seed, output + i);
+
+    return;
+}
+
+__attribute__((target("avx2"))) void VOX__calculate__fractal_noise_3D__avx2(f32* xs, f32* ys, f32* zs, u64 count, f32 frequency, u64 octave_count, u32 seed, f32* output) {
+    __m256 x;
+    __m256 y;
+    __m256 z;
+    __m256 sum;
+    __m256 octave_frequency;
+    __m256 amplitude;
+    u64 i;
+
+    // eight samples per step
+    for (i = 0; i + 8 <= count; i += 8) {
+        x = _mm256_loadu_ps(xs + i);
+        y = _mm256_loadu_ps(ys + i);
+        z = _mm256_loadu_ps(zs + i);
+        sum = _mm256_setzero_ps();
+        octave_frequency = _mm256_set1_ps(frequency);
+        amplitude = _mm256_set1_ps(1.0f);
+
+        for (u64 octave = 0; octave < octave_count; octave++) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(amplitude, VOX__calculate__gradient_noise_3D__avx2(_mm256_mul_ps(x, octave_frequency), _mm256_mul_ps(y, octave_frequency), _mm256_mul_ps(z, octave_frequency), _mm256_set1_epi32((s32)VOX__calculate__noise_octave_seed(seed, octave)))));
+            octave_frequency = _mm256_mul_ps(octave_frequency, _mm256_set1_ps(2.0f));
+            amplitude = _mm256_mul_ps(amplitude, _mm256_set1_ps(0.5f));
+        }
+
+        _mm256_storeu_ps(output + i, sum);
+    }
+
+    // remainder
+    VOX__calculate__fractal_noise_3D__sse2(xs + i, ys + i, zs + i, count - i, frequency, octave_count, seed, output + i);
+
+    return;
+}
+#endif
+
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT DEFAULT
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+// widest kernel this processor runs, detected once
+void VOX__calculate__fractal_noise_2D(f32* xs, f32* ys, u64 count, f32 frequency, u64 octave_count, u32 seed, f32* output) {
+    switch (VOX__read__noise_kernel()) {
+#if defined(__SSE2__)
+    case VOX__nkt__avx2:
+        VOX__calculate__fractal_noise_2D__avx2(xs, ys, count, frequency, octave_count, seed, output);
+        break;
+    case VOX__nkt__sse2:
+        VOX__calculate__fractal_noise_2D__sse2(xs, ys, count, frequency, octave_count, seed, output);
+        break;
+#endif
+    default:
+        VOX__calculate__fractal_noise_2D__scalar(xs, ys, count, frequency, octave_count, seed, output);
+        break;
+    }
+
+    return;
+}
+
+void VOX__calculate__fractal_noise_3D(f32* xs, f32* ys, f32* zs, u64 count, f32 frequency, u64 octave_count, u32 seed, f32* output) {
+    switch (VOX__read__noise_kernel()) {
+#if defined(__SSE2__)
+    case VOX__nkt__avx2:
+        VOX__calculate__fractal_noise_3D__avx2(xs, ys, zs, count, frequency, octave_count, seed, output);
+        break;
+    case VOX__nkt__sse2:
+        VOX__calculate__fractal_noise_3D__sse2(xs, ys, zs, count, frequency, octave_count, seed, output);
+        break;
+#endif
+    default:
+        VOX__calculate__fractal_noise_3D__scalar(xs, ys, zs, count, frequency, octave_count, seed, output);
+        break;
+    }
+
+    return;
+}
+
+/* World Generation - Filling Chunks For New Chunk Positions */
+// column heights are fractal noise shaped by a slow biome noise, caves are carved below the surface crust where 3d noise runs high
+VOX__chunk VOX__create__chunk__generated(VOX__chunk_position chunk_position, u64 seed) {
+    VOX__block_ID block_IDs[VOX__dt__chunk_block_count];
+    f32 column_xs[VOX__dt__chunk_side_length * VOX__dt__chunk_side_length];
+    f32 column_zs[VOX__dt__chunk_side_length * VOX__dt__chunk_side_length];
+    f32 height_noise[VOX__dt__chunk_side_length * VOX__dt__chunk_side_length];
+    f32 biome_noise[VOX__dt__chunk_side_length * VOX__dt__chunk_side_length];
+    s64 heights[VOX__dt__chunk_side_length * VOX__dt__chunk_side_length];
+    VOX__block_ID top_IDs[VOX__dt__chunk_side_length * VOX__dt__chunk_side_length];
+    VOX__block_ID filler_IDs[VOX__dt__chunk_side_length * VOX__dt__chunk_side_length];
+    f32 block_xs[VOX__dt__chunk_block_count];
+    f32 block_ys[VOX__dt__chunk_block_count];
+    f32 block_zs[VOX__dt__chunk_block_count];
+    f32 cave_noise[VOX__dt__chunk_block_count];
+    VOX__3D_position chunk_offset;
+    u32 noise_seed;
+    u64 column;
+    f32 mountain;
+    s64 highest;
+    s64 world_y;
+    VOX__bt has_caves;
+
+    // setup variables
+    chunk_offset = VOX__calculate__world_position_from_chunk_position(chunk_position);
+    noise_seed = (u32)seed ^ (u32)(seed >> 32);
+
+    // sample every column at once
+    for (u64 z = 0; z < VOX__dt__chunk_side_length; z++) {
+        for (u64 x = 0; x < VOX__dt__chunk_side_length; x++) {
+            column_xs[x + (z * VOX__dt__chunk_side_length)] = chunk_offset.p_x + (f32)x;
+            column_zs[x + (z * VOX__dt__chunk_side_length)] = chunk_offset.p_z + (f32)z;
+        }
+    }
+    VOX__calculate__fractal_noise_2D(column_xs, column_zs, VOX__dt__chunk_side_length * VOX__dt__chunk_side_length, 1.0f / 256.0f, 2, noise_seed ^ 0x6A09E667u, biome_noise);
+    VOX__calculate__fractal_noise_2D(column_xs, column_zs, VOX__dt__chunk_side_length * VOX__dt__chunk_side_length, 1.0f / 96.0f, 5, noise_seed, height_noise);
+
+    // shape columns (mountains rise & roughen smoothly with the biome noise, so biome borders have no cliffs)
+    highest = VOX__dt__terrain_sea_level;
+    for (u64 i = 0; i < VOX__dt__chunk_side_length * VOX__dt__chunk_side_length; i++) {
+        mountain = (biome_noise[i] - 0.1f) * 4.0f;
+        mountain = (mountain < 0.0f) ? 0.0f : ((mountain > 1.0f) ? 1.0f : mountain);
+        heights[i] = (s64)floorf(-4.0f + (16.0f * mountain) + (height_noise[i] * (10.0f + (24.0f * mountain))));
+        if (heights[i] > highest) {
+            highest = heights[i];
+        }
+
+        // pick surface blocks
+        if (heights[i] < VOX__dt__terrain_sea_level || biome_noise[i] < -0.2f) {
+            top_IDs[i] = VOX__bit__sand;
+            filler_IDs[i] = VOX__bit__sand;
+        } else if (mountain > 0.5f) {
+            top_IDs[i] = (heights[i] > VOX__dt__terrain_snow_level) ? VOX__bit__snow : VOX__bit__stone;
+            filler_IDs[i] = VOX__bit__stone;
+        } else {
+            top_IDs[i] = VOX__bit__grass;
+            filler_IDs[i] = VOX__bit__stone;
+        }
+    }
+
+    // sky chunks are all air
+    if ((s64)chunk_offset.p_y > highest) {
+        return VOX__create__chunk(VOX__bit__air);
+    }
+
+    // sample caves for every block, unless the whole chunk sits inside the crust
+    has_caves = (s64)chunk_offset.p_y < highest - VOX__dt__terrain_cave_crust_depth;
+    if (has_caves == VOX__bt__true) {
+        for (u64 z = 0; z < VOX__dt__chunk_side_length; z++) {
+            for (u64 y = 0; y < VOX__dt__chunk_side_length; y++) {
+                for (u64 x = 0; x < VOX__dt__chunk_side_length; x++) {
+                    block_xs[VOX__calculate__chunk_block_index(x, y, z)] = chunk_offset.p_x + (f32)x;
+                    block_ys[VOX__calculate__chunk_block_index(x, y, z)] = chunk_offset.p_y + (f32)y;
+                    block_zs[VOX__calculate__chunk_block_index(x, y, z)] = chunk_offset.p_z + (f32)z;
+                }
+            }
+        }
+        VOX__calculate__fractal_noise_3D(block_xs, block_ys, block_zs, VOX__dt__chunk_block_count, 1.0f / 24.0f, 2, noise_seed ^ 0xBB67AE85u, cave_noise);
+    }
+
+    // fill blocks
+    for (u64 z = 0; z < VOX__dt__chunk_side_length; z++) {
+        for (u64 y = 0; y < VOX__dt__chunk_side_length; y++) {
+            for (u64 x = 0; x < VOX__dt__chunk_side_length; x++) {
+                column = x + (z * VOX__dt__chunk_side_length);
+                world_y = (s64)chunk_offset.p_y + (s64)y;
+
+                if (world_y > heights[column]) {
+                    block_IDs[VOX__calculate__chunk_block_index(x, y, z)] = (world_y <= VOX__dt__terrain_sea_level) ? VOX__bit__water : VOX__bit__air;
+                } else if (has_caves == VOX__bt__true && world_y < heights[column] - VOX__dt__terrain_cave_crust_depth && cave_noise[VOX__calculate__chunk_block_index(x, y, z)] > 0.3f) {
+                    block_IDs[VOX__calculate__chunk_block_index(x, y, z)] = VOX__bit__air;
+                } else if (world_y == heights[column]) {
+                    block_IDs[VOX__calculate__chunk_block_index(x, y, z)] = top_IDs[column];
+                } else if (world_y > heights[column] - VOX__dt__terrain_filler_depth) {
+                    block_IDs[VOX__calculate__chunk_block_index(x, y, z)] = filler_IDs[column];
+                } else {
+                    block_IDs[VOX__calculate__chunk_block_index(x, y, z)] = VOX__bit__stone;
+                }
+            }
+        }
+    }
+
+    return VOX__create__chunk__from_block_IDs(block_IDs);
+}
+
+/* Region Files - Chunks Grouped Into Memory Mapped Files Behind An Offset Table */
+// a file is the header (with one table entry per chunk of the region) followed by chunk payloads in any order
+// payloads are rewritten in place while they fit & appended otherwise, the dead space left behind is compacted away once it outweighs live data
+typedef struct VOX__region_file_entry {
+    u64 p_offset; // 0 when the chunk was never saved
+    u32 p_length;
+    u32 p_capacity; // bytes reserved at offset
+} VOX__region_file_entry;
+
+typedef struct VOX__region_file_header {
+    u32 p_magic;
+    u32 p_version;
+    u32 p_side_length;
+    u32 p_chunk_block_count;
+    VOX__region_file_entry p_entries[VOX__dt__region_chunk_count];
+} VOX__region_file_header;
+
+typedef struct VOX__region {
+    VOX__chunk_position p_position; // in regions, not chunks
+    char p_path[VOX__dt__region_path_length];
+    int p_file_descriptor;
+    u8* p_mapping; // read only & shared, so writes through the file descriptor show up without remapping
+    u64 p_mapped_length;
+    u64 p_file_length;
+    u64 p_live_length; // payload bytes reserved by table entries
+} VOX__region;
+
+s32 VOX__calculate__floor_division(s32 numerator, s32 denominator) {
+    return (numerator >= 0) ? numerator / denominator : -((-numerator + denominator - 1) / denominator);
+}
+
+VOX__chunk_position VOX__calculate__region_position_from_chunk_position(VOX__chunk_position chunk_position) {
+    return VOX__create__chunk_position(VOX__calculate__floor_division(chunk_position.p_x, VOX__dt__region_side_length), VOX__calculate__floor_division(chunk_position.p_y, VOX__dt__region_side_length), VOX__calculate__floor_division(chunk_position.p_z, VOX__dt__region_side_length));
+}
+
+u64 VOX__calculate__region_entry_index(VOX__chunk_position chunk_position) {
+    VOX__chunk_position region_position;
+    u64 x;
+    u64 y;
+    u64 z;
+
+    // position inside region
+    region_position = VOX__calculate__region_position_from_chunk_position(chunk_position);
+    x = chunk_position.p_x - (region_position.p_x * VOX__dt__region_side_length);
+    y = chunk_position.p_y - (region_position.p_y * VOX__dt__region_side_length);
+    z = chunk_position.p_z - (region_position.p_z * VOX__dt__region_side_length);
+
+    return x + (y * VOX__dt__region_side_length) + (z * VOX__dt__region_side_length * VOX__dt__region_side_length);
+}
+
+// writes the payload of one chunk, returns its length (at most VOX__dt__region_chunk_payload_maximum_length)
+// layout: u8 bits per block, u8 zero, u16 palette count, u16 per palette entry, then (u8 run length - 1, u8 or u16 palette index) runs over the blocks, all little endian
+u64 VOX__write__chunk_to_region_payload(VOX__chunk chunk, u8* payload) {
+    u64 output;
+    u64 run_index;
+    u64 run_length;
+    u64 palette_index;
+
+    // header
+    payload[0] = (u8)chunk.p_bits_per_block;
+    payload[1] = 0;
+    payload[2] = (u8)chunk.p_palette_count;
+    payload[3] = (u8)(chunk.p_palette_count >> 8);
+    output = 4;
+
+    // palette
+    for (u64 i = 0; i < chunk.p_palette_count; i++) {
+        payload[output] = (u8)((VOX__block_ID*)chunk.p_palette.p_data)[i];
+        payload[output + 1] = (u8)(((VOX__block_ID*)chunk.p_palette.p_data)[i] >> 8);
+        output += 2;
+    }
+
+    // constant chunks need no runs
+    if (chunk.p_bits_per_block == 0) {
+        return output;
+    }
+
+    // runs of equal palette indices in block order
+    run_index = VOX__read__palette_index_from_chunk_blocks(chunk.p_blocks, chunk.p_bits_per_block, 0);
+    run_length = 1;
+    for (u64 i = 1; i <= VOX__dt__chunk_block_count; i++) {
+        palette_index = (i < VOX__dt__chunk_block_count) ? VOX__read__palette_index_from_chunk_blocks(chunk.p_blocks, chunk.p_bits_per_block, i) : VOX__dt__chunk_block_count;
+
+        if (palette_index == run_index && run_length < 256) {
+            run_length++;
+
+            continue;
+        }
+
+        // flush run
+        payload[output] = (u8)(run_length - 1);
+        payload[output + 1] = (u8)run_index;
+        output += 2;
+        if (chunk.p_bits_per_block == 16) {
+            payload[output] = (u8)(run_index >> 8);
+            output++;
+        }
+
+        run_index = palette_index;
+        run_length = 1;
+    }
+
+    return output;
+}
+
+// rebuilds a chunk from a payload, false (with nothing allocated) when the payload is damaged
+VOX__bt VOX__read__chunk_from_region_payload(VOX__buffer payload, VOX__chunk* chunk) {
+    VOX__chunk output;
+    u8* bytes;
+    u64 cursor;
+    u64 block_index;
+    u64 run_length;
+    u64 palette_index;
+
+    // check header
+    bytes = (u8*)payload.p_data;
+    if (payload.p_length < 4) {
+        return VOX__bt__false;
+    }
+    output = VOX__create_null__chunk();
+    output.p_bits_per_block = bytes[0];
+    output.p_palette_count = (u64)bytes[2] | ((u64)bytes[3] << 8);
+    if (output.p_bits_per_block != VOX__calculate__chunk_bits_per_block(VOX__calculate__chunk_palette_capacity(output.p_bits_per_block)) || output.p_palette_count == 0 || output.p_palette_count > VOX__calculate__chunk_palette_capacity(output.p_bits_per_block) || payload.p_length < 4 + (2 * output.p_palette_count)) {
+        return VOX__bt__false;
+    }
+
+    // palette
+    output.p_palette = VOX__create__buffer__allocator(&VOX__global__pool_allocator, sizeof(VOX__block_ID) * VOX__calculate__chunk_palette_capacity(output.p_bits_per_block));
+    for (u64 i = 0; i < output.p_palette_count; i++) {
+        ((VOX__block_ID*)output.p_palette.p_data)[i] = (VOX__block_ID)((u64)bytes[4 + (2 * i)] | ((u64)bytes[5 + (2 * i)] << 8));
+    }
+    cursor = 4 + (2 * output.p_palette_count);
+
+    // runs
+    output.p_blocks = VOX__create__chunk_blocks(output.p_bits_per_block);
+    block_index = 0;
+    while (output.p_bits_per_block != 0 && block_index < VOX__dt__chunk_block_count) {
+        if (cursor + ((output.p_bits_per_block == 16) ? 3 : 2) > payload.p_length) {
+            VOX__destroy__chunk(output);
+
+            return VOX__bt__false;
+        }
+
+        run_length = (u64)bytes[cursor] + 1;
+        palette_index = bytes[cursor + 1];
+        cursor += 2;
+        if (output.p_bits_per_block == 16) {
+            palette_index |= (u64)bytes[cursor] << 8;
+            cursor++;
+        }
+
+        if (palette_index >= output.p_palette_count || block_index + run_length > VOX__dt__chunk_block_count) {
+            VOX__destroy__chunk(output);
+
+            return VOX__bt__false;
+        }
+
+        // zero is already written
+        if (palette_index != 0) {
+            for (u64 i = 0; i < run_length; i++) {
+                VOX__write__palette_index_to_chunk_blocks(output.p_blocks, output.p_bits_per_block, block_index + i, palette_index);
+            }
+        }
+        block_index += run_length;
+    }
+
+    *chunk = output;
+
+    return VOX__bt__true;
+}
+
+VOX__region VOX__create_null__region() {
+    VOX__region output;
+
+    // setup output
+    output.p_position = VOX__create__chunk_position(0, 0, 0);
+    output.p_path[0] = 0;
+    output.p_file_descriptor = -1;
+    output.p_mapping = 0;
+    output.p_mapped_length = 0;
+    output.p_file_length = 0;
+    output.p_live_length = 0;
+
+    return output;
+}
+
+// pwrite until done, false on any failure
+VOX__bt VOX__write__bytes_to_file_descriptor(int file_descriptor, void* data, u64 length, u64 offset) {
+    ssize_t written;
+
+    while (length > 0) {
+        written = pwrite(file_descriptor, data, length, (off_t)offset);
+        if (written <= 0) {
+            return VOX__bt__false;
+        }
+
+        data = (u8*)data + written;
+        length -= written;
+        offset += written;
+    }
+
+    return VOX__bt__true;
+}
+
+// maps the whole file, replacing an older smaller mapping
+void VOX__map__region(VOX__error* error, VOX__region* region) {
+    void* mapping;
+
+    // drop old mapping
+    if ((*region).p_mapping != 0) {
+        munmap((*region).p_mapping, (*region).p_mapped_length);
+        (*region).p_mapping = 0;
+        (*region).p_mapped_length = 0;
+    }
+
+    // map file
+    mapping = mmap(0, (*region).p_file_length, PROT_READ, MAP_SHARED, (*region).p_file_descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        *error = VOX__create__error__file_map_failure();
+
+        return;
+    }
+    (*region).p_mapping = (u8*)mapping;
+    (*region).p_mapped_length = (*region).p_file_length;
+
+    return;
+}
+
+VOX__region_file_entry VOX__read__region_file_entry(VOX__region* region, u64 entry_index) {
+    return (*(VOX__region_file_header*)(*region).p_mapping).p_entries[entry_index];
+}
+
+// creates the file when it does not exist yet
+VOX__region VOX__open__region(VOX__error* error, char* directory, VOX__chunk_position region_position) {
+    VOX__region output;
+    VOX__region_file_header* header;
+    struct stat file_status;
+
+    // setup output
+    output = VOX__create_null__region();
+    output.p_position = region_position;
+    snprintf(output.p_path, sizeof(output.p_path), "%s/r.%d.%d.%d.vxr", directory, region_position.p_x, region_position.p_y, region_position.p_z);
+
+    // open file
+    output.p_file_descriptor = open(output.p_path, O_RDWR | O_CREAT, 0644);
+    if (output.p_file_descriptor < 0 || fstat(output.p_file_descriptor, &file_status) != 0) {
+        *error = VOX__create__error__file_open_failure();
+
+        return output;
+    }
+    output.p_file_length = file_status.st_size;
+
+    // new file starts with an empty table
+    if (output.p_file_length == 0) {
+        header = (VOX__region_file_header*)VOX__create__allocation(sizeof(VOX__region_file_header));
+        VOX__fill__bytes(header, sizeof(VOX__region_file_header), 0);
+        (*header).p_magic = VOX__dt__region_file_magic;
+        (*header).p_version = VOX__dt__region_file_version;
+        (*header).p_side_length = VOX__dt__region_side_length;
+        (*header).p_chunk_block_count = VOX__dt__chunk_block_count;
+
+        if (VOX__write__bytes_to_file_descriptor(output.p_file_descriptor, header, sizeof(VOX__region_file_header), 0) == VOX__bt__false) {
+            *error = VOX__create__error__file_write_failure();
+        }
+        VOX__destroy__allocation(header, sizeof(VOX__region_file_header));
+        if (VOX__check__error__has_error_occured(error) == VOX__bt__true) {
+            return output;
+        }
+
+        output.p_file_length = sizeof(VOX__region_file_header);
+    }
+
+    // check file is a region of this build's shape
+    if (output.p_file_length < sizeof(VOX__region_file_header)) {
+        *error = VOX__create__error__file_open_failure();
+
+        return output;
+    }
+    VOX__map__region(error, &output);
+    if (VOX__check__error__has_error_occured(error) == VOX__bt__true) {
+        return output;
+    }
+    header = (VOX__region_file_header*)output.p_mapping;
+    if ((*header).p_magic != VOX__dt__region_file_magic || (*header).p_version != VOX__dt__region_file_version || (*header).p_side_length != VOX__dt__region_side_length || (*header).p_chunk_block_count != VOX__dt__chunk_block_count) {
+        *error = VOX__create__error__file_open_failure();
+
+        return output;
+    }
+
+    // count live bytes
+    for (u64 i = 0; i < VOX__dt__region_chunk_count; i++) {
+        if ((*header).p_entries[i].p_offset != 0) {
+            output.p_live_length += (*header).p_entries[i].p_capacity;
+        }
+    }
+
+    return output;
+}
+
+// loads a chunk straight out of the mapping, false when it was never saved or is damaged
+VOX__bt VOX__read__chunk_from_region(VOX__region* region, VOX__chunk_position chunk_position, VOX__chunk* chunk) {
+    VOX__region_file_entry entry;
+    VOX__error map_error;
+
+    // find payload
+    entry = VOX__read__region_file_entry(region, VOX__calculate__region_entry_index(chunk_position));
+    if (entry.p_offset == 0 || entry.p_offset + entry.p_length > (*region).p_file_length) {
+        return VOX__bt__false;
+    }
+
+    // payload appended since mapping
+    if (entry.p_offset + entry.p_length > (*region).p_mapped_length) {
+        map_error = VOX__create__error__no_error();
+        VOX__map__region(&map_error, region);
+        if (VOX__check__error__has_error_occured(&map_error) == VOX__bt__true) {
+            return VOX__bt__false;
+        }
+    }
+
+    return VOX__read__chunk_from_region_payload(VOX__create__buffer__add_address((*region).p_mapping + entry.p_offset, entry.p_length), chunk);
+}
+
+// rewrites the file with only live payloads packed after the table, then swaps it into place
+void VOX__compact__region(VOX__error* error, VOX__region* region) {
+    char temporary_path[VOX__dt__region_path_length + 8];
+    int file_descriptor;
+    VOX__region_file_header* header;
+    u64 cursor;
+    VOX__bt written;
+
+    // every payload must be readable through the mapping
+    if ((*region).p_mapped_length < (*region).p_file_length) {
+        VOX__map__region(error, region);
+        if (VOX__check__error__has_error_occured(error) == VOX__bt__true) {
+            return;
+        }
+    }
+
+    // open new file
+    snprintf(temporary_path, sizeof(temporary_path), "%s.tmp", (*region).p_path);
+    file_descriptor = open(temporary_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file_descriptor < 0) {
+        *error = VOX__create__error__file_open_failure();
+
+        return;
+    }
+
+    // copy live payloads, dropping entries that point outside the file like the read path would
+    header = (VOX__region_file_header*)VOX__create__allocation(sizeof(VOX__region_file_header));
+    VOX__copy__bytes_to_bytes((*region).p_mapping, sizeof(VOX__region_file_header), header);
+    cursor = sizeof(VOX__region_file_header);
+    written = VOX__bt__true;
+    for (u64 i = 0; i < VOX__dt__region_chunk_count && written == VOX__bt__true; i++) {
+        if ((*header).p_entries[i].p_offset == 0) {
+            continue;
+        }
+        if ((*header).p_entries[i].p_offset < sizeof(VOX__region_file_header) || (*header).p_entries[i].p_offset > (*region).p_mapped_length || (*header).p_entries[i].p_length > (*region).p_mapped_length - (*header).p_entries[i].p_offset || (*header).p_entries[i].p_length > VOX__dt__region_chunk_payload_maximum_length) {
+            VOX__fill__bytes(&(*header).p_entries[i], sizeof(VOX__region_file_entry), 0);
+
+            continue;
+        }
+
+        written = VOX__write__bytes_to_file_descriptor(file_descriptor, (*region).p_mapping + (*header).p_entries[i].p_offset, (*header).p_entries[i].p_length, cursor);
+        (*header).p_entries[i].p_offset = cursor;
+        (*header).p_entries[i].p_capacity = (*header).p_entries[i].p_length;
+        cursor += (*header).p_entries[i].p_length;
+    }
+
+    // table last, & on disk before the rename makes it the region
+    if (written == VOX__bt__true) {
+        written = VOX__write__bytes_to_file_descriptor(file_descriptor, header, sizeof(VOX__region_file_header), 0);
+    }
+    if (written == VOX__bt__true) {
+        written = fsync(file_descriptor) == 0 && rename(temporary_path, (*region).p_path) == 0;
+    }
+    VOX__destroy__allocation(header, sizeof(VOX__region_file_header));
+    if (written == VOX__bt__false) {
+        close(file_descriptor);
+        remove(temporary_path);
+        *error = VOX__create__error__file_write_failure();
+
+        return;
+    }
+
+    // swap to new file
+    close((*region).p_file_descriptor);
+    (*region).p_file_descriptor = file_descriptor;
+    (*region).p_file_length = cursor;
+    (*region).p_live_length = cursor - sizeof(VOX__region_file_header);
+    VOX__map__region(error, region);
+
+    return;
+}
+
+// picks where a payload goes, rewriting in place when it still fits & appending otherwise (the old bytes are left dead)
+VOX__region_file_entry VOX__reserve__region_file_entry(VOX__region* region, u64 entry_index, u64 payload_length) {
+    VOX__region_file_entry output;
+
+    // setup output
+    output = VOX__read__region_file_entry(region, entry_index);
+
+    // append
+    if (output.p_offset == 0 || payload_length > output.p_capacity) {
+        if (output.p_offset != 0) {
+            (*region).p_live_length -= output.p_capacity;
+        }
+        output.p_offset = (*region).p_file_length;
+        output.p_capacity = payload_length;
+        (*region).p_file_length += payload_length;
+        (*region).p_live_length += payload_length;
+    }
+    output.p_length = payload_length;
+
+    return output;
+}
+
+// undoes a reservation whose payload or table entry never made it to disk, appended bytes are left dead
+void VOX__cancel__region_file_entry_reservation(VOX__region* region, VOX__region_file_entry old_entry, VOX__region_file_entry reserved_entry) {
+    // rewrites in place kept the same space
+    if (reserved_entry.p_offset == old_entry.p_offset) {
+        return;
+    }
+
+    (*region).p_live_length -= reserved_entry.p_capacity;
+    if (old_entry.p_offset != 0) {
+        (*region).p_live_length += old_entry.p_capacity;
+    }
+
+    return;
+}
+
+u64 VOX__calculate__region_file_entry_offset(u64 entry_index) {
+    return offsetof(VOX__region_file_header, p_entries) + (sizeof(VOX__region_file_entry) * entry_index);
+}
+
+// compact once more than half the payload space is dead
+void VOX__check__region_compaction(VOX__error* error, VOX__region* region) {
+    u64 dead_length;
+
+    dead_length = (*region).p_file_length - sizeof(VOX__region_file_header) - (*region).p_live_length;
+    if (dead_length >= VOX__dt__region_compaction_minimum_dead_length && dead_length > (*region).p_live_length) {
+        VOX__compact__region(error, region);
+    }
+
+    return;
+}
+
+void VOX__write__chunk_to_region(VOX__error* error, VOX__region* region, VOX__chunk_position chunk_position, VOX__chunk chunk) {
+    u8 payload[VOX__dt__region_chunk_payload_maximum_length];
+    u64 payload_length;
+    u64 entry_index;
+    VOX__region_file_entry old_entry;
+    VOX__region_file_entry entry;
+
+    // encode
+    payload_length = VOX__write__chunk_to_region_payload(chunk, payload);
+    entry_index = VOX__calculate__region_entry_index(chunk_position);
+    old_entry = VOX__read__region_file_entry(region, entry_index);
+    entry = VOX__reserve__region_file_entry(region, entry_index, payload_length);
+
+    // payload before table, so the table never points at bytes that are not there
+    if (VOX__write__bytes_to_file_descriptor((*region).p_file_descriptor, payload, payload_length, entry.p_offset) == VOX__bt__false || VOX__write__bytes_to_file_descriptor((*region).p_file_descriptor, &entry, sizeof(entry), VOX__calculate__region_file_entry_offset(entry_index)) == VOX__bt__false) {
+        VOX__cancel__region_file_entry_reservation(region, old_entry, entry);
+        *error = VOX__create__error__file_write_failure();
+
+        return;
+    }
+
+    VOX__check__region_compaction(error, region);
+
+    return;
+}
+
+void VOX__close__region(VOX__region region) {
+    if (region.p_mapping != 0) {
+        munmap(region.p_mapping, region.p_mapped_length);
+    }
+    if (region.p_file_descriptor >= 0) {
+        close(region.p_file_descriptor);
+    }
+
+    return;
+}
+
+/* IO Ring - Batched File Reads & Writes, io_uring When The Kernel Allows It & Plain pread/pwrite Otherwise */
+// io operation type
+typedef enum VOX__iot {
+    VOX__iot__read,
+    VOX__iot__write
+} VOX__iot;
+
+typedef struct VOX__io_operation {
+    VOX__iot p_type;
+    int p_file_descriptor;
+    void* p_data;
+    u64 p_length;
+    u64 p_offset;
+    VOX__bt p_succeeded;
+} VOX__io_operation;
+
+typedef struct VOX__io_ring {
+    int p_file_descriptor; // -1 when io_uring is unavailable & operations run one system call each
+    u32 p_entry_count;
+
+    // submission queue (the kernel maps it with the completion queue when it can)
+    void* p_submission_mapping;
+    u64 p_submission_mapping_length;
+    _Atomic u32* p_submission_tail;
+    u32* p_submission_mask;
+    u32* p_submission_array;
+    struct io_uring_sqe* p_submission_entries;
+    u64 p_submission_entries_length;
+
+    // completion queue
+    void* p_completion_mapping;
+    u64 p_completion_mapping_length;
+    _Atomic u32* p_completion_head;
+    _Atomic u32* p_completion_tail;
+    u32* p_completion_mask;
+    struct io_uring_cqe* p_completion_entries;
+} VOX__io_ring;
+
+VOX__io_operation VOX__create__io_operation(VOX__iot type, int file_descriptor, void* data, u64 length, u64 offset) {
+    VOX__io_operation output;
+
+    // setup output
+    output.p_type = type;
+    output.p_file_descriptor = file_descriptor;
+    output.p_data = data;
+    output.p_length = length;
+    output.p_offset = offset;
+    output.p_succeeded = VOX__bt__false;
+
+    return output;
+}
+
+// pread until done, false on any failure or end of file
+VOX__bt VOX__read__bytes_from_file_descriptor(int file_descriptor, void* data, u64 length, u64 offset) {
+    ssize_t read_length;
+
+    while (length > 0) {
+        read_length = pread(file_descriptor, data, length, (off_t)offset);
+        if (read_length <= 0) {
+            return VOX__bt__false;
+        }
+
+        data = (u8*)data + read_length;
+        length -= read_length;
+        offset += read_length;
+    }
+
+    return VOX__bt__true;
+}
+
+VOX__io_ring VOX__create_null__io_ring() {
+    VOX__io_ring output;
+
+    // setup output
+    output.p_file_descriptor = -1;
+    output.p_entry_count = 0;
+    output.p_submission_mapping = 0;
+    output.p_submission_mapping_length = 0;
+    output.p_submission_entries = 0;
+    output.p_submission_entries_length = 0;
+    output.p_completion_mapping = 0;
+    output.p_completion_mapping_length = 0;
+
+    return output;
+}
+
+// falls back to a null ring (plain system calls) when io_uring is missing or blocked
+VOX__io_ring VOX__open__io_ring(u32 entry_count) {
+    VOX__io_ring output;
+#if defined(__linux__)
+    struct io_uring_params parameters;
+    u8* submission_mapping;
+    u8* completion_mapping;
+#endif
+
+    // setup output
+    output = VOX__create_null__io_ring();
+
+#if defined(__linux__)
+    // create ring
+    VOX__fill__bytes(&parameters, sizeof(parameters), 0);
+    output.p_file_descriptor = (int)syscall(__NR_io_uring_setup, entry_count, &parameters);
+    if (output.p_file_descriptor < 0) {
+        output.p_file_descriptor = -1;
+
+        return output;
+    }
+    output.p_entry_count = parameters.sq_entries;
+
+    // map queues
+    output.p_submission_mapping_length = parameters.sq_off.array + (parameters.sq_entries * sizeof(u32));
+    output.p_completion_mapping_length = parameters.cq_off.cqes + (parameters.cq_entries * sizeof(struct io_uring_cqe));
+    if (parameters.features & IORING_FEAT_SINGLE_MMAP) {
+        if (output.p_completion_mapping_length > output.p_submission_mapping_length) {
+            output.p_submission_mapping_length = output.p_completion_mapping_length;
+        }
+        output.p_completion_mapping_length = 0;
+    }
+    output.p_submission_mapping = mmap(0, output.p_submission_mapping_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, output.p_file_descriptor, IORING_OFF_SQ_RING);
+    if (output.p_submission_mapping == MAP_FAILED) {
+        close(output.p_file_descriptor);
+
+        return VOX__create_null__io_ring();
+    }
+    if (output.p_completion_mapping_length == 0) {
+        output.p_completion_mapping = output.p_submission_mapping;
+    } else {
+        output.p_completion_mapping = mmap(0, output.p_completion_mapping_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, output.p_file_descriptor, IORING_OFF_CQ_RING);
+        if (output.p_completion_mapping == MAP_FAILED) {
+            munmap(output.p_submission_mapping, output.p_submission_mapping_length);
+            close(output.p_file_descriptor);
+
+            return VOX__create_null__io_ring();
+        }
+    }
+    output.p_submission_entries_length = parameters.sq_entries * sizeof(struct io_uring_sqe);
+    output.p_submission_entries = (struct io_uring_sqe*)mmap(0, output.p_submission_entries_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, output.p_file_descriptor, IORING_OFF_SQES);
+    if ((void*)output.p_submission_entries == MAP_FAILED) {
+        if (output.p_completion_mapping_length != 0) {
+            munmap(output.p_completion_mapping, output.p_completion_mapping_length);
+        }
+        munmap(output.p_submission_mapping, output.p_submission_mapping_length);
+        close(output.p_file_descriptor);
+
+        return VOX__create_null__io_ring();
+    }
+
+    // find ring fields
+    submission_mapping = (u8*)output.p_submission_mapping;
+    completion_mapping = (u8*)output.p_completion_mapping;
+    output.p_submission_tail = (_Atomic u32*)(submission_mapping + parameters.sq_off.tail);
+    output.p_submission_mask = (u32*)(submission_mapping + parameters.sq_off.ring_mask);
+    output.p_submission_array = (u32*)(submission_mapping + parameters.sq_off.array);
+    output.p_completion_head = (_Atomic u32*)(completion_mapping + parameters.cq_off.head);
+    output.p_completion_tail = (_Atomic u32*)(completion_mapping + parameters.cq_off.tail);
+    output.p_completion_mask = (u32*)(completion_mapping + parameters.cq_off.ring_mask);
+    output.p_completion_entries = (struct io_uring_cqe*)(completion_mapping + parameters.cq_off.cqes);
+#endif
+
+    return output;
+}
+
+// submits up to one ring of operations with one system call & waits for all of them, false when the ring itself failed
+VOX__bt VOX__run__io_ring_operations(VOX__io_ring* io_ring, VOX__io_operation* operations, u64 operation_count) {
+#if defined(__linux__)
+    struct io_uring_sqe* entry;
+    struct io_uring_cqe* completion;
+    u32 tail;
+    u32 head;
+    u64 submitted_count;
+    u64 completed_count;
+    long entered;
+
+    // queue entries
+    tail = atomic_load_explicit((*io_ring).p_submission_tail, memory_order_relaxed);
+    for (u64 i = 0; i < operation_count; i++) {
+        entry = &(*io_ring).p_submission_entries[(tail + i) & *(*io_ring).p_submission_mask];
+        VOX__fill__bytes(entry, sizeof(struct io_uring_sqe), 0);
+        (*entry).opcode = (operations[i].p_type == VOX__iot__read) ? IORING_OP_READ : IORING_OP_WRITE;
+        (*entry).fd = operations[i].p_file_descriptor;
+        (*entry).addr = (u64)operations[i].p_data;
+        (*entry).len = (u32)operations[i].p_length;
+        (*entry).off = operations[i].p_offset;
+        (*entry).user_data = i;
+        (*io_ring).p_submission_array[(tail + i) & *(*io_ring).p_submission_mask] = (tail + i) & *(*io_ring).p_submission_mask;
+    }
+    atomic_store_explicit((*io_ring).p_submission_tail, tail + (u32)operation_count, memory_order_release);
+
+    // submit (normally all at once) & wait for everything
+    submitted_count = 0;
+    while (submitted_count < operation_count) {
+        entered = syscall(__NR_io_uring_enter, (*io_ring).p_file_descriptor, (u32)(operation_count - submitted_count), (u32)(operation_count - submitted_count), IORING_ENTER_GETEVENTS, NULL, 0);
+        if (entered < 0 && errno != EINTR && errno != EAGAIN) {
+            return VOX__bt__false;
+        }
+        if (entered > 0) {
+            submitted_count += entered;
+        }
+    }
+
+    // reap completions, a short transfer counts as failed & is redone by the caller
+    completed_count = 0;
+    while (completed_count < operation_count) {
+        head = atomic_load_explicit((*io_ring).p_completion_head, memory_order_relaxed);
+        if (head == atomic_load_explicit((*io_ring).p_completion_tail, memory_order_acquire)) {
+            entered = syscall(__NR_io_uring_enter, (*io_ring).p_file_descriptor, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+            if (entered < 0 && errno != EINTR && errno != EAGAIN) {
+                return VOX__bt__false;
+            }
+
+            continue;
+        }
+
+        completion = &(*io_ring).p_completion_entries[head & *(*io_ring).p_completion_mask];
+        operations[(*completion).user_data].p_succeeded = ((*completion).res >= 0 && (u64)(*completion).res == operations[(*completion).user_data].p_length) ? VOX__bt__true : VOX__bt__false;
+        atomic_store_explicit((*io_ring).p_completion_head, head + 1, memory_order_release);
+        completed_count++;
+    }
+#endif
+
+    return VOX__bt__true;
+}
+
+void VOX__close__io_ring(VOX__io_ring io_ring) {
+    if (io_ring.p_file_descriptor < 0) {
+        return;
+    }
+
+    // unmap queues
+    munmap(io_ring.p_submission_entries, io_ring.p_submission_entries_length);
+    if (io_ring.p_completion_mapping_length != 0) {
+        munmap(io_ring.p_completion_mapping, io_ring.p_completion_mapping_length);
+    }
+    munmap(io_ring.p_submission_mapping, io_ring.p_submission_mapping_length);
+    close(io_ring.p_file_descriptor);
+
+    return;
+}
+
+// runs every operation, through the ring in batches when there is one, redoing anything the ring could not finish with plain system calls
+void VOX__run__io_operations(VOX__io_ring* io_ring, VOX__io_operation* operations, u64 operation_count) {
+    u64 batch_count;
+
+    // batches through the ring, dropping to system calls for good if the ring breaks
+    for (u64 i = 0; i < operation_count && (*io_ring).p_file_descriptor >= 0; i += batch_count) {
+        batch_count = ((operation_count - i) < (*io_ring).p_entry_count) ? (operation_count - i) : (*io_ring).p_entry_count;
+        if (VOX__run__io_ring_operations(io_ring, operations + i, batch_count) == VOX__bt__false) {
+            VOX__close__io_ring(*io_ring);
+            *io_ring = VOX__create_null__io_ring();
+        }
+    }
+
+    // one at a time
+    for (u64 i = 0; i < operation_count; i++) {
+        if (operations[i].p_succeeded == VOX__bt__true) {
+            continue;
+        }
+
+        if (operations[i].p_type == VOX__iot__read) {
+            operations[i].p_succeeded = VOX__read__bytes_from_file_descriptor(operations[i].p_file_descriptor, operations[i].p_data, operations[i].p_length, operations[i].p_offset);
+        } else {
+            operations[i].p_succeeded = VOX__write__bytes_to_file_descriptor(operations[i].p_file_descriptor, operations[i].p_data, operations[i].p_length, operations[i].p_offset);
+        }
+    }
+
+    return;
+}
+
+/* Jobs - Work Done Off The Main Thread */
+// job type
+typedef enum VOX__jt {
+    VOX__jt__mesh_chunk
+} VOX__jt;
+
+typedef struct VOX__job {
+    VOX__jt p_type;
+
+    // mesh chunk input
+    VOX__chunk_position p_position;
+    u64 p_version;
+    VOX__chunk p_chunk; // owned copy
+    VOX__chunk_neighborhood* p_neighborhood; // owned, 0 meshes the chunk unlit
+    VOX__block_dictionary p_block_dictionary; // shared, read only
+    VOX__vft p_vertex_format;
+    u64 p_lod_level;
+
+    // mesh chunk output
+    VOX__object_datum p_mesh;
+} VOX__job;
+
+// the job takes ownership of neighborhood (which may be 0)
+VOX__job* VOX__create__job__mesh_chunk(VOX__chunk_position chunk_position, u64 version, VOX__chunk chunk, VOX__chunk_neighborhood* neighborhood, VOX__block_dictionary block_dictionary, VOX__vft vertex_format, u64 lod_level) {
+    VOX__job* output;
+
+    // setup output
+    output = (VOX__job*)VOX__create__allocation__allocator(&VOX__global__pool_allocator, sizeof(VOX__job));
+    (*output).p_type = VOX__jt__mesh_chunk;
+    (*output).p_position = chunk_position;
+    (*output).p_version = version;
+    (*output).p_chunk = VOX__create__chunk__copy(chunk);
+    (*output).p_neighborhood = neighborhood;
+    (*output).p_block_dictionary = block_dictionary;
+    (*output).p_vertex_format = vertex_format;
+    (*output).p_lod_level = lod_level;
+    (*output).p_mesh = VOX__create_null__object_datum();
+
+    return output;
+}
+
+// scratch allocations made by the job are left for the caller to reset
+void VOX__run__job(VOX__job* job, VOX__allocator* scratch_allocator) {
+    switch ((*job).p_type) {
+    case VOX__jt__mesh_chunk:
+        (*job).p_mesh = VOX__create__object_datum__greedy_mesh_from_chunk__lit((*job).p_chunk, (*job).p_neighborhood, (*job).p_block_dictionary, VOX__calculate__world_position_from_chunk_position((*job).p_position), (*job).p_vertex_format, (*job).p_lod_level, scratch_allocator);
+        break;
+    }
+
+    return;
+}
+
+void VOX__destroy__job(VOX__job* job) {
+    switch ((*job).p_type) {
+    case VOX__jt__mesh_chunk:
+        VOX__destroy__chunk((*job).p_chunk);
+        if ((*job).p_neighborhood != 0) {
+            VOX__destroy__allocation__allocator(&VOX__global__pool_allocator, (*job).p_neighborhood, sizeof(VOX__chunk_neighborhood));
+        }
+        VOX__destroy__object_datum((*job).p_mesh);
+        break;
+    }
+
+    VOX__destroy__allocation__allocator(&VOX__global__pool_allocator, job, sizeof(VOX__job));
+
+    return;
+}
+
+/* Job Queue - Growable FIFO Of Jobs (Caller Provides Locking) */
+typedef struct VOX__job_queue {
+    VOX__buffer p_jobs;
+    u64 p_head;
+    u64 p_count;
+} VOX__job_queue;
+
+VOX__job_queue VOX__create__job_queue() {
+    VOX__job_queue output;
+
+    // setup output
+    output.p_jobs = VOX__create__buffer(sizeof(VOX__job*) * 64);
+    output.p_head = 0;
+    output.p_count = 0;
+
+    return output;
+}
+
+void VOX__push__job_queue(VOX__job_queue* job_queue, VOX__job* job) {
+    VOX__buffer larger_jobs;
+    u64 capacity;
+
+    // grow ring, unwrapping it into the new buffer
+    capacity = (*job_queue).p_jobs.p_length / sizeof(VOX__job*);
+    if ((*job_queue).p_count == capacity) {
+        larger_jobs = VOX__create__buffer((*job_queue).p_jobs.p_length * 2);
+        for (u64 i = 0; i < (*job_queue).p_count; i++) {
+            ((VOX__job**)larger_jobs.p_data)[i] = ((VOX__job**)(*job_queue).p_jobs.p_data)[((*job_queue).p_head + i) % capacity];
+        }
+        VOX__destroy__buffer((*job_queue).p_jobs);
+        (*job_queue).p_jobs = larger_jobs;
+        (*job_queue).p_head = 0;
+        capacity *= 2;
+    }
+
+    // append
+    ((VOX__job**)(*job_queue).p_jobs.p_data)[((*job_queue).p_head + (*job_queue).p_count) % capacity] = job;
+    (*job_queue).p_count++;
+
+    return;
+}
+
+VOX__job* VOX__pop__job_queue(VOX__job_queue* job_queue) {
+    VOX__job* output;
+
+    // empty
+    if ((*job_queue).p_count == 0) {
+        return 0;
+    }
+
+    // take front
+    output = ((VOX__job**)(*job_queue).p_jobs.p_data)[(*job_queue).p_head];
+    (*job_queue).p_head = ((*job_queue).p_head + 1) % ((*job_queue).p_jobs.p_length / sizeof(VOX__job*));
+    (*job_queue).p_count--;
+
+    return output;
+}
+
+void VOX__destroy__job_queue(VOX__job_queue job_queue) {
+    VOX__destroy__buffer(job_queue.p_jobs);
+
+    return;
+}
+
+/* Job Deque - Chase-Lev Work Stealing Deque (Owner Pushes & Pops Bottom, Thieves Steal Top) */
+typedef struct VOX__job_deque {
+    _Atomic(VOX__job*) p_jobs[VOX__dt__job_deque_capacity];
+    _Atomic s64 p_top;
+    _Atomic s64 p_bottom;
+} VOX__job_deque;
+
+void VOX__setup__job_deque(VOX__job_deque* job_deque) {
+    atomic_init(&(*job_deque).p_top, 0);
+    atomic_init(&(*job_deque).p_bottom, 0);
+
+    return;
+}
+
+VOX__bt VOX__push__job_deque(VOX__job_deque* job_deque, VOX__job* job) {
+    s64 bottom;
+    s64 top;
+
+    // check for space
+    bottom = atomic_load_explicit(&(*job_deque).p_bottom, memory_order_relaxed);
+    top = atomic_load_explicit(&(*job_deque).p_top, memory_order_acquire);
+    if (bottom - top >= VOX__dt__job_deque_capacity) {
+        return VOX__bt__false;
+    }
+
+    // publish job
+    atomic_store_explicit(&(*job_deque).p_jobs[bottom & (VOX__dt__job_deque_capacity - 1)], job, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&(*job_deque).p_bottom, bottom + 1, memory_order_relaxed);
+
+    return VOX__bt__true;
+}
+
+VOX__job* VOX__pop__job_deque(VOX__job_deque* job_deque) {
+    VOX__job* output;
+    s64 bottom;
+    s64 top;
+
+    // reserve bottom
+    bottom = atomic_load_explicit(&(*job_deque).p_bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&(*job_deque).p_bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    top = atomic_load_explicit(&(*job_deque).p_top, memory_order_relaxed);
+
+    // empty
+    if (top > bottom) {
+        atomic_store_explicit(&(*job_deque).p_bottom, bottom + 1, memory_order_relaxed);
+
+        return 0;
+    }
+
+    output = atomic_load_explicit(&(*job_deque).p_jobs[bottom & (VOX__dt__job_deque_capacity - 1)], memory_order_relaxed);
+
+    // last job, race thieves for it
+    if (top == bottom) {
+        if (atomic_compare_exchange_strong_explicit(&(*job_deque).p_top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed) == 0) {
+            output = 0;
+        }
+        atomic_store_explicit(&(*job_deque).p_bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    return output;
+}
+
+VOX__job* VOX__steal__job_deque(VOX__job_deque* job_deque) {
+    VOX__job* output;
+    s64 top;
+    s64 bottom;
+
+    // read ends
+    top = atomic_load_explicit(&(*job_deque).p_top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    bottom = atomic_load_explicit(&(*job_deque).p_bottom, memory_order_acquire);
+
+    // empty
+    if (top >= bottom) {
+        return 0;
+    }
+
+    // claim top
+    output = atomic_load_explicit(&(*job_deque).p_jobs[top & (VOX__dt__job_deque_capacity - 1)], memory_order_relaxed);
+    if (atomic_compare_exchange_strong_explicit(&(*job_deque).p_top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed) == 0) {
+        return 0;
+    }
+
+    return output;
+}
+
+/* Job System - Worker Pool With Work Stealing & A Main Thread Completion Queue */
+typedef struct VOX__job_worker {
+    pthread_t p_thread;
+    VOX__job_deque p_deque;
+    VOX__allocator p_scratch_allocator; // arena only this worker touches, reset after every job
+    struct VOX__job_system* p_job_system;
+    u64 p_index;
+} VOX__job_worker;
+
+typedef struct VOX__job_system {
+    VOX__buffer p_workers;
+    u64 p_worker_count;
+
+    // submitted jobs not yet moved into a worker deque
+    pthread_mutex_t p_submitted_lock;
+    pthread_cond_t p_submitted_signal;
+    VOX__job_queue p_submitted;
+    VOX__bt p_quit;
+
+    // jobs queued anywhere (submitted or in a deque) and not yet started
+    _Atomic u64 p_queued_count;
+
+    // finished jobs waiting for the main thread
+    pthread_mutex_t p_completed_lock;
+    VOX__job_queue p_completed;
+} VOX__job_system;
+
+u64 VOX__calculate__processor_count() {
+    s64 output;
+
+    // ask operating system
+    output = sysconf(_SC_NPROCESSORS_ONLN);
+    if (output < 1) {
+        output = 1;
+    }
+
+    return (u64)output;
+}
+
+VOX__job* VOX__take__worker_job(VOX__job_worker* worker) {
+    VOX__job_system* job_system;
+    VOX__job_worker* workers;
+    VOX__job* output;
+    u64 batch;
+
+    // setup variables
+    job_system = (*worker).p_job_system;
+    workers = (VOX__job_worker*)(*job_system).p_workers.p_data;
+
+    // own work first
+    output = VOX__pop__job_deque(&(*worker).p_deque);
+    if (output != 0) {
+        return output;
+    }
+
+    // steal from the other workers
+    for (u64 i = 1; i < (*job_system).p_worker_count; i++) {
+        output = VOX__steal__job_deque(&workers[((*worker).p_index + i) % (*job_system).p_worker_count].p_deque);
+        if (output != 0) {
+            return output;
+        }
+    }
+
+    // take a fair share of submitted jobs, sleeping while nothing is queued anywhere
+    pthread_mutex_lock(&(*job_system).p_submitted_lock);
+    while (atomic_load(&(*job_system).p_queued_count) == 0 && (*job_system).p_quit == VOX__bt__false) {
+        pthread_cond_wait(&(*job_system).p_submitted_signal, &(*job_system).p_submitted_lock);
+    }
+    output = VOX__pop__job_queue(&(*job_system).p_submitted);
+    batch = ((*job_system).p_submitted.p_count / (*job_system).p_worker_count) + 1;
+    for (u64 i = 0; i < batch && (*job_system).p_submitted.p_count > 0; i++) {
+        if (VOX__push__job_deque(&(*worker).p_deque, ((VOX__job**)(*job_system).p_submitted.p_jobs.p_data)[(*job_system).p_submitted.p_head]) == VOX__bt__false) {
+            break;
+        }
+        VOX__pop__job_queue(&(*job_system).p_submitted);
+    }
+    pthread_mutex_unlock(&(*job_system).p_submitted_lock);
+
+    return output;
+}
+
+void* VOX__run__job_worker(void* argument) {
+    VOX__job_worker* worker;
+    VOX__job_system* job_system;
+    VOX__job* job;
+    u64 idle_count;
+
+    // setup variables
+    worker = (VOX__job_worker*)argument;
+    job_system = (*worker).p_job_system;
+    idle_count = 0;
+
+    while (VOX__bt__true) {
+        job = VOX__take__worker_job(worker);
+
+        // nothing to do, either quit or look again
+        if (job == 0) {
+            pthread_mutex_lock(&(*job_system).p_submitted_lock);
+            if ((*job_system).p_quit == VOX__bt__true && atomic_load(&(*job_system).p_queued_count) == 0) {
+                pthread_mutex_unlock(&(*job_system).p_submitted_lock);
+
+                break;
+            }
+            pthread_mutex_unlock(&(*job_system).p_submitted_lock);
+
+            // queued jobs sit in deques this sweep could not steal from, back off before looking again (briefly, then by yielding to whoever holds them)
+            idle_count++;
+            if (idle_count < VOX__dt__job_worker_idle_pause_count) {
+#if defined(__SSE2__)
+                _mm_pause();
+#endif
+            } else {
+                sched_yield();
+            }
+
+            continue;
+        }
+        idle_count = 0;
+
+        // run job
+        atomic_fetch_sub(&(*job_system).p_queued_count, 1);
+        VOX__run__job(job, &(*worker).p_scratch_allocator);
+        VOX__reset__allocator(&(*worker).p_scratch_allocator);
+
+        // hand back to main thread
+        pthread_mutex_lock(&(*job_system).p_completed_lock);
+        VOX__push__job_queue(&(*job_system).p_completed, job);
+        pthread_mutex_unlock(&(*job_system).p_completed_lock);
+    }
+
+    return 0;
+}
+
+// worker_count of 0 uses one worker per processor
+VOX__job_system* VOX__open__job_system(u64 worker_count) {
+    VOX__job_system* output;
+    VOX__job_worker* workers;
+
+    // pick worker count
+    if (worker_count == 0) {
+        worker_count = VOX__calculate__processor_count();
+    }
+
+    // setup output in place (locks must not move)
+    output = (VOX__job_system*)VOX__create__allocation(sizeof(VOX__job_system));
+    (*output).p_workers = VOX__create__buffer(sizeof(VOX__job_worker) * worker_count);
+    (*output).p_worker_count = worker_count;
+    pthread_mutex_init(&(*output).p_submitted_lock, NULL);
+    pthread_cond_init(&(*output).p_submitted_signal, NULL);
+    (*output).p_submitted = VOX__create__job_queue();
+    (*output).p_quit = VOX__bt__false;
+    atomic_init(&(*output).p_queued_count, 0);
+    pthread_mutex_init(&(*output).p_completed_lock, NULL);
+    (*output).p_completed = VOX__create__job_queue();
+
+    // start workers
+    workers = (VOX__job_worker*)(*output).p_workers.p_data;
+    for (u64 i = 0; i < worker_count; i++) {
+        VOX__setup__job_deque(&workers[i].p_deque);
+        workers[i].p_scratch_allocator = VOX__open__allocator__arena(sizeof(VOX__chunk_mesh_quad) * VOX__dt__chunk_mesh_maximum_quad_count * 2);
+        workers[i].p_job_system = output;
+        workers[i].p_index = i;
+    }
+    for (u64 i = 0; i < worker_count; i++) {
+        pthread_create(&workers[i].p_thread, NULL, VOX__run__job_worker, &workers[i]);
+    }
+
+    return output;
+}
+
+void VOX__submit__job(VOX__job_system* job_system, VOX__job* job) {
+    pthread_mutex_lock(&(*job_system).p_submitted_lock);
+    VOX__push__job_queue(&(*job_system).p_submitted, job);
+    atomic_fetch_add(&(*job_system).p_queued_count, 1);
+    pthread_cond_signal(&(*job_system).p_submitted_signal);
+    pthread_mutex_unlock(&(*job_system).p_submitted_lock);
+
+    return;
+}
+
+// returns 0 when no job has finished
+VOX__job* VOX__take__completed_job(VOX__job_system* job_system) {
+    VOX__job* output;
+
+    pthread_mutex_lock(&(*job_system).p_completed_lock);
+    output = VOX__pop__job_queue(&(*job_system).p_completed);
+    pthread_mutex_unlock(&(*job_system).p_completed_lock);
+
+    return output;
+}
+
+void VOX__close__job_system(VOX__job_system* job_system) {
+    VOX__job_worker* workers;
+    VOX__job* job;
+
+    // drop jobs nobody started yet
+    pthread_mutex_lock(&(*job_system).p_submitted_lock);
+    while ((job = VOX__pop__job_queue(&(*job_system).p_submitted)) != 0) {
+        atomic_fetch_sub(&(*job_system).p_queued_count, 1);
+        VOX__destroy__job(job);
+    }
+    (*job_system).p_quit = VOX__bt__true;
+    pthread_cond_broadcast(&(*job_system).p_submitted_signal);
+    pthread_mutex_unlock(&(*job_system).p_submitted_lock);
+
+    // wait for workers to drain their deques
+    workers = (VOX__job_worker*)(*job_system).p_workers.p_data;
+    for (u64 i = 0; i < (*job_system).p_worker_count; i++) {
+        pthread_join(workers[i].p_thread, NULL);
+    }
+
+    // drop finished jobs nobody took
+    while ((job = VOX__take__completed_job(job_system)) != 0) {
+        VOX__destroy__job(job);
+    }
+    for (u64 i = 0; i < (*job_system).p_worker_count; i++) {
+        VOX__close__allocator(&workers[i].p_scratch_allocator);
+    }
+
+    // clean up
+    pthread_mutex_destroy(&(*job_system).p_submitted_lock);
+    pthread_cond_destroy(&(*job_system).p_submitted_signal);
+    pthread_mutex_destroy(&(*job_system).p_completed_lock);
+    VOX__destroy__job_queue((*job_system).p_submitted);
+    VOX__destroy__job_queue((*job_system).p_completed);
+    VOX__destroy__buffer((*job_system).p_workers);
+    VOX__destroy__allocation(job_system, sizeof(VOX__job_system));
+
+    return;
+}
+
+/* Chunk IO - Region Loads & Saves Off The Main Thread, Nearest Chunks First */
+// one io thread owns every open region & submits reads & writes in batches, decode threads turn payloads into chunks
+// (reading the payloads themselves when there is no io_uring) & finished loads come back through a lock free stack
+// chunk io request type
+typedef enum VOX__cirt {
+    VOX__cirt__load,
+    VOX__cirt__save
+} VOX__cirt;
+
+// chunk io status type
+typedef enum VOX__cist {
+    VOX__cist__pending,
+    VOX__cist__loaded, // read from its region
+    VOX__cist__generated, // not on disk (or unreadable), generated from the seed instead
+    VOX__cist__cancelled // dropped from the queue after leaving the kept range, no chunk
+} VOX__cist;
+
+typedef struct VOX__chunk_io_request {
+    VOX__cirt p_type;
+    VOX__cist p_status;
+    VOX__chunk_position p_position;
+    u64 p_seed;
+    VOX__chunk p_chunk; // saves own the chunk they write, finished loads hand theirs to the taker
+    VOX__buffer p_payload; // null when there is nothing to decode
+    u64 p_payload_length;
+    int p_file_descriptor; // region copy the decode thread reads the payload from, -1 when already read
+    u64 p_payload_offset;
+    u64 p_entry_index;
+    VOX__region_file_entry p_entry;
+    struct VOX__chunk_io_request* p_next; // save queue, decode queue & completion stack link
+} VOX__chunk_io_request;
+
+typedef struct VOX__chunk_io_region {
+    VOX__region p_region; // file descriptor is -1 when the slot is empty
+    u64 p_last_used;
+} VOX__chunk_io_region;
+
+typedef struct VOX__chunk_io {
+    char p_directory[VOX__dt__region_path_length];
+    VOX__bt p_has_directory; // without one every load is generated & saves are dropped
+
+    // io thread state
+    pthread_t p_io_thread;
+    VOX__io_ring p_io_ring;
+    VOX__chunk_io_region p_regions[VOX__dt__chunk_io_open_region_count];
+    u64 p_region_use_count;
+
+    // requests waiting for the io thread (loads are a heap nearest the center first, saves keep their order)
+    pthread_mutex_t p_requests_lock;
+    pthread_cond_t p_requests_signal;
+    VOX__buffer p_loads;
+    u64 p_load_count;
+    VOX__chunk_io_request* p_saves_head;
+    VOX__chunk_io_request* p_saves_tail;
+    VOX__chunk_position p_center;
+    VOX__bt p_quit;
+
+    // loads waiting for a decode thread
+    pthread_mutex_t p_decodes_lock;
+    pthread_cond_t p_decodes_signal;
+    VOX__chunk_io_request* p_decodes_head;
+    VOX__chunk_io_request* p_decodes_tail;
+    VOX__buffer p_decode_threads;
+    u64 p_decode_thread_count;
+    VOX__bt p_decodes_quit;
+    _Atomic u64 p_decode_count; // queued or being decoded
+
+    // finished loads for the main thread
+    _Atomic(VOX__chunk_io_request*) p_completed;
+
+    // counters
+    VOX__bt p_uses_io_ring;
+    _Atomic u64 p_loaded_count;
+    _Atomic u64 p_generated_count;
+    _Atomic u64 p_saved_count;
+    _Atomic u64 p_failed_count;
+} VOX__chunk_io;
+
+VOX__chunk_io_request* VOX__create__chunk_io_request(VOX__cirt type, VOX__chunk_position chunk_position, u64 seed, VOX__chunk chunk) {
+    VOX__chunk_io_request* output;
+
+    // setup output
+    output = (VOX__chunk_io_request*)VOX__create__allocation__allocator(&VOX__global__pool_allocator, sizeof(VOX__chunk_io_request));
+    (*output).p_type = type;
+    (*output).p_status = VOX__cist__pending;
+    (*output).p_position = chunk_position;
+    (*output).p_seed = seed;
+    (*output).p_chunk = chunk;
+    (*output).p_payload = VOX__create__buffer__add_address(0, 0);
+    (*output).p_payload_length = 0;
+    (*output).p_file_descriptor = -1;
+    (*output).p_payload_offset = 0;
+    (*output).p_entry_index = 0;
+    (*output).p_next = 0;
+
+    return output;
+}
+
+// also destroys a chunk still owned by the request
+void VOX__destroy__chunk_io_request(VOX__chunk_io_request* request) {
+    VOX__destroy__chunk((*request).p_chunk);
+    VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, (*request).p_payload);
+    if ((*request).p_file_descriptor >= 0) {
+        close((*request).p_file_descriptor);
+    }
+    VOX__destroy__allocation__allocator(&VOX__global__pool_allocator, request, sizeof(VOX__chunk_io_request));
+
+    return;
+}
+
+s64 VOX__calculate__chunk_io_priority(VOX__chunk_io* chunk_io, VOX__chunk_io_request* request) {
+    s64 x;
+    s64 y;
+    s64 z;
+
+    // squared distance from the center, lower runs first
+    x = (s64)(*request).p_position.p_x - (*chunk_io).p_center.p_x;
+    y = (s64)(*request).p_position.p_y - (*chunk_io).p_center.p_y;
+    z = (s64)(*request).p_position.p_z - (*chunk_io).p_center.p_z;
+
+    return (x * x) + (y * y) + (z * z);
+}
+
+// heap helpers, the requests lock must be held
+void VOX__sift_down__chunk_io_loads(VOX__chunk_io* chunk_io, u64 index) {
+    VOX__chunk_io_request** loads;
+    VOX__chunk_io_request* swap;
+    u64 child;
+
+    loads = (VOX__chunk_io_request**)(*chunk_io).p_loads.p_data;
+    while ((index * 2) + 1 < (*chunk_io).p_load_count) {
+        // nearer child
+        child = (index * 2) + 1;
+        if (child + 1 < (*chunk_io).p_load_count && VOX__calculate__chunk_io_priority(chunk_io, loads[child + 1]) < VOX__calculate__chunk_io_priority(chunk_io, loads[child])) {
+            child++;
+        }
+        if (VOX__calculate__chunk_io_priority(chunk_io, loads[index]) <= VOX__calculate__chunk_io_priority(chunk_io, loads[child])) {
+            break;
+        }
+
+        swap = loads[index];
+        loads[index] = loads[child];
+        loads[child] = swap;
+        index = child;
+    }
+
+    return;
+}
+
+void VOX__push__chunk_io_load(VOX__chunk_io* chunk_io, VOX__chunk_io_request* request) {
+    VOX__chunk_io_request** loads;
+    VOX__chunk_io_request* swap;
+    VOX__buffer larger_loads;
+    u64 index;
+
+    // grow
+    if ((*chunk_io).p_load_count == (*chunk_io).p_loads.p_length / sizeof(VOX__chunk_io_request*)) {
+        larger_loads = VOX__create__buffer((*chunk_io).p_loads.p_length * 2);
+        VOX__copy__bytes_to_bytes((*chunk_io).p_loads.p_data, (*chunk_io).p_loads.p_length, larger_loads.p_data);
+        VOX__destroy__buffer((*chunk_io).p_loads);
+        (*chunk_io).p_loads = larger_loads;
+    }
+
+    // sift up
+    loads = (VOX__chunk_io_request**)(*chunk_io).p_loads.p_data;
+    index = (*chunk_io).p_load_count;
+    loads[index] = request;
+    (*chunk_io).p_load_count++;
+    while (index > 0 && VOX__calculate__chunk_io_priority(chunk_io, loads[index]) < VOX__calculate__chunk_io_priority(chunk_io, loads[(index - 1) / 2])) {
+        swap = loads[index];
+        loads[index] = loads[(index - 1) / 2];
+        loads[(index - 1) / 2] = swap;
+        index = (index - 1) / 2;
+    }
+
+    return;
+}
+
+VOX__chunk_io_request* VOX__pop__chunk_io_load(VOX__chunk_io* chunk_io) {
+    VOX__chunk_io_request** loads;
+    VOX__chunk_io_request* output;
+
+    // empty
+    if ((*chunk_io).p_load_count == 0) {
+        return 0;
+    }
+
+    // take nearest
+    loads = (VOX__chunk_io_request**)(*chunk_io).p_loads.p_data;
+    output = loads[0];
+    (*chunk_io).p_load_count--;
+    loads[0] = loads[(*chunk_io).p_load_count];
+    VOX__sift_down__chunk_io_loads(chunk_io, 0);
+
+    return output;
+}
+
+// lock free, any thread may push
+void VOX__push__chunk_io_completion(VOX__chunk_io* chunk_io, VOX__chunk_io_request* request) {
+    VOX__chunk_io_request* head;
+
+    head = atomic_load_explicit(&(*chunk_io).p_completed, memory_order_relaxed);
+    do {
+        (*request).p_next = head;
+    } while (atomic_compare_exchange_weak_explicit(&(*chunk_io).p_completed, &head, request, memory_order_release, memory_order_relaxed) == 0);
+
+    return;
+}
+
+// returns every finished load (linked through p_next) or 0, the caller destroys them
+VOX__chunk_io_request* VOX__take__completed_chunk_io_requests(VOX__chunk_io* chunk_io) {
+    return atomic_exchange_explicit(&(*chunk_io).p_completed, (VOX__chunk_io_request*)0, memory_order_acquire);
+}
+
+// io thread only, opens the region on first use & closes the least recently used one when all slots are taken
+VOX__region* VOX__find__chunk_io_region(VOX__chunk_io* chunk_io, VOX__chunk_position chunk_position) {
+    VOX__chunk_io_region* slot;
+    VOX__chunk_position region_position;
+    VOX__error error;
+
+    // find open region or the slot to reuse
+    region_position = VOX__calculate__region_position_from_chunk_position(chunk_position);
+    slot = &(*chunk_io).p_regions[0];
+    for (u64 i = 0; i < VOX__dt__chunk_io_open_region_count; i++) {
+        if ((*chunk_io).p_regions[i].p_region.p_file_descriptor >= 0 && VOX__check__chunk_positions_are_equal((*chunk_io).p_regions[i].p_region.p_position, region_position) == VOX__bt__true) {
+            slot = &(*chunk_io).p_regions[i];
+            (*slot).p_last_used = ++(*chunk_io).p_region_use_count;
+
+            return &(*slot).p_region;
+        }
+
+        if ((*chunk_io).p_regions[i].p_last_used < (*slot).p_last_used) {
+            slot = &(*chunk_io).p_regions[i];
+        }
+    }
+
+    // replace
+    VOX__close__region((*slot).p_region);
+    error = VOX__create__error__no_error();
+    (*slot).p_region = VOX__open__region(&error, (*chunk_io).p_directory, region_position);
+    if (VOX__check__error__has_error_occured(&error) == VOX__bt__true) {
+        VOX__close__region((*slot).p_region);
+        (*slot).p_region = VOX__create_null__region();
+        (*slot).p_last_used = 0;
+
+        return 0;
+    }
+    (*slot).p_last_used = ++(*chunk_io).p_region_use_count;
+
+    return &(*slot).p_region;
+}
+
+void VOX__push__chunk_io_decodes(VOX__chunk_io* chunk_io, VOX__chunk_io_request* head, VOX__chunk_io_request* tail) {
+    pthread_mutex_lock(&(*chunk_io).p_decodes_lock);
+    if ((*chunk_io).p_decodes_tail == 0) {
+        (*chunk_io).p_decodes_head = head;
+    } else {
+        (*(*chunk_io).p_decodes_tail).p_next = head;
+    }
+    (*chunk_io).p_decodes_tail = tail;
+    pthread_cond_broadcast(&(*chunk_io).p_decodes_signal);
+    pthread_mutex_unlock(&(*chunk_io).p_decodes_lock);
+
+    return;
+}
+
+// encodes, places & writes a batch of saves (payloads first, then table entries in a second batch)
+void VOX__run__chunk_io_saves(VOX__chunk_io* chunk_io, VOX__chunk_io_request** saves, u64 save_count) {
+    VOX__io_operation operations[VOX__dt__chunk_io_batch_length];
+    VOX__region* regions[VOX__dt__chunk_io_batch_length];
+    VOX__region_file_entry old_entries[VOX__dt__chunk_io_batch_length];
+    u64 operation_indices[VOX__dt__chunk_io_batch_length]; // per save, the operation that wrote its payload
+    VOX__error error;
+    u64 operation_count;
+
+    // only the newest save of a chunk in the batch is written
+    for (u64 i = 0; i < save_count; i++) {
+        regions[i] = 0;
+        for (u64 j = i + 1; j < save_count && saves[i] != 0; j++) {
+            if (saves[j] != 0 && VOX__check__chunk_positions_are_equal((*saves[i]).p_position, (*saves[j]).p_position) == VOX__bt__true) {
+                VOX__destroy__chunk_io_request(saves[i]);
+                saves[i] = 0;
+            }
+        }
+    }
+
+    // encode & place payloads
+    operation_count = 0;
+    for (u64 i = 0; i < save_count && (*chunk_io).p_has_directory == VOX__bt__true; i++) {
+        if (saves[i] == 0) {
+            continue;
+        }
+
+        regions[i] = VOX__find__chunk_io_region(chunk_io, (*saves[i]).p_position);
+        if (regions[i] == 0) {
+            atomic_fetch_add(&(*chunk_io).p_failed_count, 1);
+
+            continue;
+        }
+
+        (*saves[i]).p_payload = VOX__create__buffer__allocator(&VOX__global__pool_allocator, VOX__dt__region_chunk_payload_maximum_length);
+        (*saves[i]).p_payload_length = VOX__write__chunk_to_region_payload((*saves[i]).p_chunk, (u8*)(*saves[i]).p_payload.p_data);
+        (*saves[i]).p_entry_index = VOX__calculate__region_entry_index((*saves[i]).p_position);
+        old_entries[i] = VOX__read__region_file_entry(regions[i], (*saves[i]).p_entry_index);
+        (*saves[i]).p_entry = VOX__reserve__region_file_entry(regions[i], (*saves[i]).p_entry_index, (*saves[i]).p_payload_length);
+        operations[operation_count] = VOX__create__io_operation(VOX__iot__write, (*regions[i]).p_file_descriptor, (*saves[i]).p_payload.p_data, (*saves[i]).p_payload_length, (*saves[i]).p_entry.p_offset);
+        operation_indices[i] = operation_count;
+        operation_count++;
+    }
+    VOX__run__io_operations(&(*chunk_io).p_io_ring, operations, operation_count);
+
+    // failed payloads keep their old table entry
+    for (u64 i = 0; i < save_count; i++) {
+        if (regions[i] == 0 || operations[operation_indices[i]].p_succeeded == VOX__bt__true) {
+            continue;
+        }
+
+        VOX__cancel__region_file_entry_reservation(regions[i], old_entries[i], (*saves[i]).p_entry);
+        regions[i] = 0;
+        atomic_fetch_add(&(*chunk_io).p_failed_count, 1);
+    }
+
+    // point tables at payloads that made it to disk
+    operation_count = 0;
+    for (u64 i = 0; i < save_count; i++) {
+        if (regions[i] == 0) {
+            continue;
+        }
+
+        operations[operation_count] = VOX__create__io_operation(VOX__iot__write, (*regions[i]).p_file_descriptor, &(*saves[i]).p_entry, sizeof(VOX__region_file_entry), VOX__calculate__region_file_entry_offset((*saves[i]).p_entry_index));
+        operation_indices[i] = operation_count;
+        operation_count++;
+    }
+    VOX__run__io_operations(&(*chunk_io).p_io_ring, operations, operation_count);
+
+    // finish
+    for (u64 i = 0; i < save_count; i++) {
+        if (saves[i] == 0) {
+            continue;
+        }
+
+        if (regions[i] != 0 && operations[operation_indices[i]].p_succeeded == VOX__bt__true) {
+            atomic_fetch_add(&(*chunk_io).p_saved_count, 1);
+
+            error = VOX__create__error__no_error();
+            VOX__check__region_compaction(&error, regions[i]);
+        } else if (regions[i] != 0) {
+            VOX__cancel__region_file_entry_reservation(regions[i], old_entries[i], (*saves[i]).p_entry);
+            atomic_fetch_add(&(*chunk_io).p_failed_count, 1);
+        }
+        VOX__destroy__chunk_io_request(saves[i]);
+    }
+
+    return;
+}
+
+// finds & reads (or leaves reading to the decode threads) a batch of loads, then queues them for decoding
+void VOX__run__chunk_io_loads(VOX__chunk_io* chunk_io, VOX__chunk_io_request** loads, u64 load_count) {
+    VOX__io_operation operations[VOX__dt__chunk_io_batch_length];
+    VOX__chunk_io_request* operation_loads[VOX__dt__chunk_io_batch_length];
+    VOX__region* region;
+    VOX__region_file_entry entry;
+    u64 operation_count;
+
+    // find payloads
+    operation_count = 0;
+    for (u64 i = 0; i < load_count && (*chunk_io).p_has_directory == VOX__bt__true; i++) {
+        region = VOX__find__chunk_io_region(chunk_io, (*loads[i]).p_position);
+        if (region == 0) {
+            atomic_fetch_add(&(*chunk_io).p_failed_count, 1);
+
+            continue;
+        }
+
+        entry = VOX__read__region_file_entry(region, VOX__calculate__region_entry_index((*loads[i]).p_position));
+        if (entry.p_offset == 0 || entry.p_length > VOX__dt__region_chunk_payload_maximum_length || entry.p_offset + entry.p_length > (*region).p_file_length) {
+            continue;
+        }
+
+        // read now in one batch, or give the decode thread its own handle to the file so the region may close meanwhile
+        (*loads[i]).p_payload = VOX__create__buffer__allocator(&VOX__global__pool_allocator, entry.p_length);
+        (*loads[i]).p_payload_length = entry.p_length;
+        if ((*chunk_io).p_io_ring.p_file_descriptor >= 0) {
+            operations[operation_count] = VOX__create__io_operation(VOX__iot__read, (*region).p_file_descriptor, (*loads[i]).p_payload.p_data, entry.p_length, entry.p_offset);
+            operation_loads[operation_count] = loads[i];
+            operation_count++;
+        } else {
+            (*loads[i]).p_file_descriptor = dup((*region).p_file_descriptor);
+            (*loads[i]).p_payload_offset = entry.p_offset;
+        }
+    }
+    VOX__run__io_operations(&(*chunk_io).p_io_ring, operations, operation_count);
+
+    // unreadable payloads are generated instead
+    for (u64 i = 0; i < operation_count; i++) {
+        if (operations[i].p_succeeded == VOX__bt__false) {
+            VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, (*operation_loads[i]).p_payload);
+            (*operation_loads[i]).p_payload = VOX__create__buffer__add_address(0, 0);
+            atomic_fetch_add(&(*chunk_io).p_failed_count, 1);
+        }
+    }
+
+    // hand over in order
+    for (u64 i = 0; i + 1 < load_count; i++) {
+        (*loads[i]).p_next = loads[i + 1];
+    }
+    (*loads[load_count - 1]).p_next = 0;
+    VOX__push__chunk_io_decodes(chunk_io, loads[0], loads[load_count - 1]);
+
+    return;
+}
+
+void* VOX__run__chunk_io_thread(void* argument) {
+    VOX__chunk_io* chunk_io;
+    VOX__chunk_io_request* saves[VOX__dt__chunk_io_batch_length];
+    VOX__chunk_io_request* loads[VOX__dt__chunk_io_batch_length];
+    VOX__chunk_io_request* request;
+    u64 save_count;
+    u64 load_count;
+    VOX__bt quit;
+
+    // setup variables
+    chunk_io = (VOX__chunk_io*)argument;
+
+    while (VOX__bt__true) {
+        // wait for work, then take a batch (saves first so a later load of the same chunk reads what was saved)
+        pthread_mutex_lock(&(*chunk_io).p_requests_lock);
+        while ((*chunk_io).p_saves_head == 0 && ((*chunk_io).p_load_count == 0 || atomic_load(&(*chunk_io).p_decode_count) >= VOX__dt__chunk_io_maximum_decode_count) && (*chunk_io).p_quit == VOX__bt__false) {
+            pthread_cond_wait(&(*chunk_io).p_requests_signal, &(*chunk_io).p_requests_lock);
+        }
+        save_count = 0;
+        while ((*chunk_io).p_saves_head != 0 && save_count < VOX__dt__chunk_io_batch_length) {
+            saves[save_count] = (*chunk_io).p_saves_head;
+            (*chunk_io).p_saves_head = (*saves[save_count]).p_next;
+            save_count++;
+        }
+        if ((*chunk_io).p_saves_head == 0) {
+            (*chunk_io).p_saves_tail = 0;
+        }
+        load_count = 0;
+        while ((*chunk_io).p_quit == VOX__bt__false && load_count < VOX__dt__chunk_io_batch_length && atomic_load(&(*chunk_io).p_decode_count) + load_count < VOX__dt__chunk_io_maximum_decode_count && (request = VOX__pop__chunk_io_load(chunk_io)) != 0) {
+            loads[load_count] = request;
+            load_count++;
+        }
+        atomic_fetch_add(&(*chunk_io).p_decode_count, load_count);
+        quit = (*chunk_io).p_quit == VOX__bt__true && (*chunk_io).p_saves_head == 0;
+        pthread_mutex_unlock(&(*chunk_io).p_requests_lock);
+
+        // run batch
+        if (save_count > 0) {
+            VOX__run__chunk_io_saves(chunk_io, saves, save_count);
+        }
+        if (load_count > 0) {
+            VOX__run__chunk_io_loads(chunk_io, loads, load_count);
+        }
+
+        // every save is written before quitting, loads are dropped
+        if (quit == VOX__bt__true) {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+void* VOX__run__chunk_io_decode_thread(void* argument) {
+    VOX__chunk_io* chunk_io;
+    VOX__chunk_io_request* request;
+
+    // setup variables
+    chunk_io = (VOX__chunk_io*)argument;
+
+    while (VOX__bt__true) {
+        // take one load
+        pthread_mutex_lock(&(*chunk_io).p_decodes_lock);
+        while ((*chunk_io).p_decodes_head == 0 && (*chunk_io).p_decodes_quit == VOX__bt__false) {
+            pthread_cond_wait(&(*chunk_io).p_decodes_signal, &(*chunk_io).p_decodes_lock);
+        }
+        request = (*chunk_io).p_decodes_head;
+        if (request != 0) {
+            (*chunk_io).p_decodes_head = (*request).p_next;
+            if ((*chunk_io).p_decodes_head == 0) {
+                (*chunk_io).p_decodes_tail = 0;
+            }
+        }
+        pthread_mutex_unlock(&(*chunk_io).p_decodes_lock);
+        if (request == 0) {
+            break;
+        }
+
+        // read payload when the io thread left it to us
+        if ((*request).p_file_descriptor >= 0) {
+            if (VOX__read__bytes_from_file_descriptor((*request).p_file_descriptor, (*request).p_payload.p_data, (*request).p_payload_length, (*request).p_payload_offset) == VOX__bt__false) {
+                VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, (*request).p_payload);
+                (*request).p_payload = VOX__create__buffer__add_address(0, 0);
+                atomic_fetch_add(&(*chunk_io).p_failed_count, 1);
+            }
+            close((*request).p_file_descriptor);
+            (*request).p_file_descriptor = -1;
+        }
+
+        // decode, or generate what was never saved
+        if ((*request).p_payload.p_data != 0 && VOX__read__chunk_from_region_payload(VOX__create__buffer__add_address((*request).p_payload.p_data, (*request).p_payload_length), &(*request).p_chunk) == VOX__bt__true) {
+            (*request).p_status = VOX__cist__loaded;
+            atomic_fetch_add(&(*chunk_io).p_loaded_count, 1);
+        } else {
+            (*request).p_chunk = VOX__create__chunk__generated((*request).p_position, (*request).p_seed);
+            (*request).p_status = VOX__cist__generated;
+            atomic_fetch_add(&(*chunk_io).p_generated_count, 1);
+        }
+        VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, (*request).p_payload);
+        (*request).p_payload = VOX__create__buffer__add_address(0, 0);
+
+        // hand back, waking the io thread when it was holding loads back for room
+        VOX__push__chunk_io_completion(chunk_io, request);
+        if (atomic_fetch_sub(&(*chunk_io).p_decode_count, 1) == VOX__dt__chunk_io_maximum_decode_count) {
+            pthread_mutex_lock(&(*chunk_io).p_requests_lock);
+            pthread_cond_signal(&(*chunk_io).p_requests_signal);
+            pthread_mutex_unlock(&(*chunk_io).p_requests_lock);
+        }
+    }
+
+    return 0;
+}
+
+// directory may be 0 (nothing is read or written, loads are generated off the main thread), decode_thread_count of 0 picks one per four processors
+VOX__chunk_io* VOX__open__chunk_io(char* directory, u64 decode_thread_count) {
+    VOX__chunk_io* output;
+
+    // pick thread count
+    if (decode_thread_count == 0) {
+        decode_thread_count = (VOX__calculate__processor_count() + 3) / 4;
+    }
+
+    // setup output in place (locks must not move)
+    output = (VOX__chunk_io*)VOX__create__allocation(sizeof(VOX__chunk_io));
+    (*output).p_has_directory = (directory != 0) ? VOX__bt__true : VOX__bt__false;
+    (*output).p_directory[0] = 0;
+    if (directory != 0) {
+        snprintf((*output).p_directory, sizeof((*output).p_directory), "%s", directory);
+        mkdir(directory, 0755);
+    }
+    (*output).p_io_ring = VOX__open__io_ring(VOX__dt__io_ring_entry_count);
+    (*output).p_uses_io_ring = ((*output).p_io_ring.p_file_descriptor >= 0) ? VOX__bt__true : VOX__bt__false;
+    for (u64 i = 0; i < VOX__dt__chunk_io_open_region_count; i++) {
+        (*output).p_regions[i].p_region = VOX__create_null__region();
+        (*output).p_regions[i].p_last_used = 0;
+    }
+    (*output).p_region_use_count = 0;
+    pthread_mutex_init(&(*output).p_requests_lock, NULL);
+    pthread_cond_init(&(*output).p_requests_signal, NULL);
+    (*output).p_loads = VOX__create__buffer(sizeof(VOX__chunk_io_request*) * 256);
+    (*output).p_load_count = 0;
+    (*output).p_saves_head = 0;
+    (*output).p_saves_tail = 0;
+    (*output).p_center = VOX__create__chunk_position(0, 0, 0);
+    (*output).p_quit = VOX__bt__false;
+    pthread_mutex_init(&(*output).p_decodes_lock, NULL);
+    pthread_cond_init(&(*output).p_decodes_signal, NULL);
+    (*output).p_decodes_head = 0;
+    (*output).p_decodes_tail = 0;
+    (*output).p_decode_threads = VOX__create__buffer(sizeof(pthread_t) * decode_thread_count);
+    (*output).p_decode_thread_count = decode_thread_count;
+    (*output).p_decodes_quit = VOX__bt__false;
+    atomic_init(&(*output).p_decode_count, 0);
+    atomic_init(&(*output).p_completed, 0);
+    atomic_init(&(*output).p_loaded_count, 0);
+    atomic_init(&(*output).p_generated_count, 0);
+    atomic_init(&(*output).p_saved_count, 0);
+    atomic_init(&(*output).p_failed_count, 0);
+
+    // start threads
+    pthread_create(&(*output).p_io_thread, NULL, VOX__run__chunk_io_thread, output);
+    for (u64 i = 0; i < decode_thread_count; i++) {
+        pthread_create(&((pthread_t*)(*output).p_decode_threads.p_data)[i], NULL, VOX__run__chunk_io_decode_thread, output);
+    }
+
+    return output;
+}
+
+// queues many loads under one lock & one wake up
+void VOX__request__chunk_loads(VOX__chunk_io* chunk_io, VOX__chunk_position* chunk_positions, u64 count, u64 seed) {
+    VOX__chunk_io_request* requests[VOX__dt__chunk_io_batch_length];
+    u64 batch_count;
+
+    for (u64 i = 0; i < count; i += batch_count) {
+        // allocate outside the lock
+        batch_count = ((count - i) < VOX__dt__chunk_io_batch_length) ? (count - i) : VOX__dt__chunk_io_batch_length;
+        for (u64 j = 0; j < batch_count; j++) {
+            requests[j] = VOX__create__chunk_io_request(VOX__cirt__load, chunk_positions[i + j], seed, VOX__create_null__chunk());
+        }
+
+        // queue
+        pthread_mutex_lock(&(*chunk_io).p_requests_lock);
+        for (u64 j = 0; j < batch_count; j++) {
+            VOX__push__chunk_io_load(chunk_io, requests[j]);
+        }
+        pthread_mutex_unlock(&(*chunk_io).p_requests_lock);
+    }
+
+    // wake io thread
+    pthread_mutex_lock(&(*chunk_io).p_requests_lock);
+    pthread_cond_signal(&(*chunk_io).p_requests_signal);
+    pthread_mutex_unlock(&(*chunk_io).p_requests_lock);
+
+    return;
+}
+
+void VOX__request__chunk_load(VOX__chunk_io* chunk_io, VOX__chunk_position chunk_position, u64 seed) {
+    VOX__request__chunk_loads(chunk_io, &chunk_position, 1, seed);
+
+    return;
+}
+
+// takes ownership of the chunk
+void VOX__request__chunk_save(VOX__chunk_io* chunk_io, VOX__chunk_position chunk_position, VOX__chunk chunk) {
+    VOX__chunk_io_request* request;
+
+    // setup request
+    request = VOX__create__chunk_io_request(VOX__cirt__save, chunk_position, 0, chunk);
+
+    // append
+    pthread_mutex_lock(&(*chunk_io).p_requests_lock);
+    if ((*chunk_io).p_saves_tail == 0) {
+        (*chunk_io).p_saves_head = request;
+    } else {
+        (*(*chunk_io).p_saves_tail).p_next = request;
+    }
+    (*chunk_io).p_saves_tail = request;
+    pthread_cond_signal(&(*chunk_io).p_requests_signal);
+    pthread_mutex_unlock(&(*chunk_io).p_requests_lock);
+
+    return;
+}
+
+// reorders queued loads around a new center & cancels the ones outside the kept range
+void VOX__update__chunk_io_center(VOX__chunk_io* chunk_io, VOX__chunk_position center, s32 radius, s32 height_radius) {
+    VOX__chunk_io_request** loads;
+    u64 kept_count;
+
+    pthread_mutex_lock(&(*chunk_io).p_requests_lock);
+
+    // cancel
+    loads = (VOX__chunk_io_request**)(*chunk_io).p_loads.p_data;
+    kept_count = 0;
+    for (u64 i = 0; i < (*chunk_io).p_load_count; i++) {
+        if (VOX__check__chunk_position_is_within_radius(center, (*loads[i]).p_position, radius, height_radius) == VOX__bt__true) {
+            loads[kept_count] = loads[i];
+            kept_count++;
+        } else {
+            (*loads[i]).p_status = VOX__cist__cancelled;
+            VOX__push__chunk_io_completion(chunk_io, loads[i]);
+        }
+    }
+    (*chunk_io).p_load_count = kept_count;
+
+    // reheap
+    (*chunk_io).p_center = center;
+    for (u64 i = kept_count / 2; i > 0; i--) {
+        VOX__sift_down__chunk_io_loads(chunk_io, i - 1);
+    }
+
+    pthread_mutex_unlock(&(*chunk_io).p_requests_lock);
+
+    return;
+}
+
+// writes every queued save, drops queued loads & destroys loads nobody took
+void VOX__close__chunk_io(VOX__chunk_io* chunk_io) {
+    VOX__chunk_io_request* request;
+    VOX__chunk_io_request* next;
+
+    // drop loads not started yet & stop io thread once saves are written
+    pthread_mutex_lock(&(*chunk_io).p_requests_lock);
+    while ((request = VOX__pop__chunk_io_load(chunk_io)) != 0) {
+        VOX__destroy__chunk_io_request(request);
+    }
+    (*chunk_io).p_quit = VOX__bt__true;
+    pthread_cond_signal(&(*chunk_io).p_requests_signal);
+    pthread_mutex_unlock(&(*chunk_io).p_requests_lock);
+    pthread_join((*chunk_io).p_io_thread, NULL);
+
+    // stop decode threads once the queue is empty
+    pthread_mutex_lock(&(*chunk_io).p_decodes_lock);
+    (*chunk_io).p_decodes_quit = VOX__bt__true;
+    pthread_cond_broadcast(&(*chunk_io).p_decodes_signal);
+    pthread_mutex_unlock(&(*chunk_io).p_decodes_lock);
+    for (u64 i = 0; i < (*chunk_io).p_decode_thread_count; i++) {
+        pthread_join(((pthread_t*)(*chunk_io).p_decode_threads.p_data)[i], NULL);
+    }
+
+    // drop finished loads nobody took
+    request = VOX__take__completed_chunk_io_requests(chunk_io);
+    while (request != 0) {
+        next = (*request).p_next;
+        VOX__destroy__chunk_io_request(request);
+        request = next;
+    }
+
+    // clean up
+    for (u64 i = 0; i < VOX__dt__chunk_io_open_region_count; i++) {
+        VOX__close__region((*chunk_io).p_regions[i].p_region);
+    }
+    VOX__close__io_ring((*chunk_io).p_io_ring);
+    pthread_mutex_destroy(&(*chunk_io).p_requests_lock);
+    pthread_cond_destroy(&(*chunk_io).p_requests_signal);
+    pthread_mutex_destroy(&(*chunk_io).p_decodes_lock);
+    pthread_cond_destroy(&(*chunk_io).p_decodes_signal);
+    VOX__destroy__buffer((*chunk_io).p_loads);
+    VOX__destroy__buffer((*chunk_io).p_decode_threads);
+    VOX__destroy__allocation(chunk_io, sizeof(VOX__chunk_io));
+
+    return;
+}
+
+/* Light Queue - Growable FIFO Of Blocks Whose Light Still Has To Spread */
+// light channel type (the channel's shift inside a light byte)
+typedef enum VOX__lct {
+    VOX__lct__block = 0,
+    VOX__lct__sky = 4
+} VOX__lct;
+
+typedef struct VOX__light_node {
+    s32 p_x;
+    s32 p_y;
+    s32 p_z;
+    u8 p_level;
+    u8 p_channel; // VOX__lct
+} VOX__light_node;
+
+typedef struct VOX__light_queue {
+    VOX__buffer p_nodes;
+    u64 p_head;
+    u64 p_count;
+} VOX__light_queue;
+
+VOX__light_node VOX__create__light_node(s64 x, s64 y, s64 z, u8 level, VOX__lct channel) {
+    VOX__light_node output;
+
+    // setup output
+    output.p_x = (s32)x;
+    output.p_y = (s32)y;
+    output.p_z = (s32)z;
+    output.p_level = level;
+    output.p_channel = (u8)channel;
+
+    return output;
+}
+
+VOX__light_queue VOX__create__light_queue() {
+    VOX__light_queue output;
+
+    // setup output
+    output.p_nodes = VOX__create__buffer(sizeof(VOX__light_node) * 1024);
+    output.p_head = 0;
+    output.p_count = 0;
+
+    return output;
+}
+
+void VOX__push__light_queue(VOX__light_queue* light_queue, VOX__light_node light_node) {
+    VOX__buffer larger_nodes;
+    u64 capacity;
+
+    // grow ring, unwrapping it into the new buffer
+    capacity = (*light_queue).p_nodes.p_length / sizeof(VOX__light_node);
+    if ((*light_queue).p_count == capacity) {
+        larger_nodes = VOX__create__buffer((*light_queue).p_nodes.p_length * 2);
+        for (u64 i = 0; i < (*light_queue).p_count; i++) {
+            ((VOX__light_node*)larger_nodes.p_data)[i] = ((VOX__light_node*)(*light_queue).p_nodes.p_data)[((*light_queue).p_head + i) % capacity];
+        }
+        VOX__destroy__buffer((*light_queue).p_nodes);
+        (*light_queue).p_nodes = larger_nodes;
+        (*light_queue).p_head = 0;
+        capacity *= 2;
+    }
+
+    // append
+    ((VOX__light_node*)(*light_queue).p_nodes.p_data)[((*light_queue).p_head + (*light_queue).p_count) % capacity] = light_node;
+    (*light_queue).p_count++;
+
+    return;
+}
+
+// the queue must not be empty
+VOX__light_node VOX__pop__light_queue(VOX__light_queue* light_queue) {
+    VOX__light_node output;
+
+    // take front
+    output = ((VOX__light_node*)(*light_queue).p_nodes.p_data)[(*light_queue).p_head];
+    (*light_queue).p_head = ((*light_queue).p_head + 1) % ((*light_queue).p_nodes.p_length / sizeof(VOX__light_node));
+    (*light_queue).p_count--;
+
+    return output;
+}
+
+void VOX__destroy__light_queue(VOX__light_queue light_queue) {
+    VOX__destroy__buffer(light_queue.p_nodes);
+
+    return;
+}
+
+// light left after one step into a block, full sky light falls straight down through clear blocks without fading
+u8 VOX__calculate__light_step(u8 level, u8 opacity, VOX__lct channel, VOX__bt downward) {
+    if (channel == VOX__lct__sky && downward == VOX__bt__true && level == VOX__dt__light_maximum && opacity == 0) {
+        return VOX__dt__light_maximum;
+    }
+    if (level <= opacity + 1) {
+        return 0;
+    }
+
+    return level - opacity - 1;
+}
+
+/* World - Chunks Streamed In & Out Around The Camera */
+typedef struct VOX__world_slot {
+    VOX__bt p_occupied;
+    VOX__chunk_position p_position;
+    VOX__chunk p_chunk;
+    VOX__bt p_needs_mesh;
+    VOX__bt p_loading; // waiting on chunk io, the chunk is null until it arrives
+    VOX__bt p_modified; // saved through chunk io when unloaded
+    u64 p_version; // taken from the world's counter on every change, stale mesh jobs are dropped
+    u64 p_lod_level; // level the chunk is (or is about to be) meshed at
+    VOX__gpu_arena_allocation p_mesh;
+    VOX__buffer p_light; // u8 per block (sky light << 4 | block light), null until the chunk arrives
+    u32 p_light_changes; // during light updates, a bit per neighbor ((x + 1) + (y + 1) * 3 + (z + 1) * 9) whose mesh reads changed light
+    VOX__bt p_edited; // a block in the chunk (or on a neighbor's touching border) changed since the last mesh
+    VOX__patchable_mesh* p_patchable_mesh; // kept once edited so later edits upload only changed quads, 0 otherwise
+} VOX__world_slot;
+
+typedef struct VOX__world {
+    VOX__buffer p_slots; // open addressing, linear probing
+    u64 p_slot_count; // power of two
+    u64 p_chunk_count;
+    u64 p_maximum_chunk_count;
+    s32 p_load_radius;
+    s32 p_load_height_radius;
+    s32 p_lod_distance; // chunks meshed at full detail around the center, 0 meshes everything at full detail
+    u64 p_maximum_loads_per_update;
+    u64 p_seed;
+    VOX__chunk_io* p_chunk_io; // 0 generates chunks on the updating thread
+    VOX__chunk_position p_center;
+    VOX__bt p_fully_loaded;
+    u64 p_total_loads;
+    u64 p_total_unloads;
+    VOX__buffer p_draw_allocations; // draw scratch, VOX__gpu_arena_allocation per slot
+    VOX__buffer p_draw_offsets; // draw scratch, chunk world position per draw
+    VOX__buffer p_cull_slots; // cull scratch, u64 slot index per candidate
+    VOX__buffer p_cull_centers; // cull scratch, x then y then z f32 arrays of slot count each
+    VOX__buffer p_cull_visible; // cull scratch, u8 per candidate
+    VOX__buffer p_load_requests; // update scratch, VOX__chunk_position per chunk io load requested
+    VOX__light_queue p_light_additions;
+    VOX__light_queue p_light_removals;
+    VOX__buffer p_light_changed_chunks; // light scratch, VOX__chunk_position per slot with light changes
+    u64 p_light_changed_chunk_count;
+    u64 p_next_version; // slot versions only ever increase, so a chunk unloaded & loaded again never matches a job from before
+} VOX__world;
+
+// chunk_io may be 0, otherwise chunks are loaded (or generated) in the background & maximum_loads_per_update only bounds synchronous loads
+// chunk meshes halve in detail every time the distance passes another doubling of lod_distance (see VOX__calculate__chunk_lod_level)
+VOX__world VOX__create__world(s32 load_radius, s32 load_height_radius, s32 lod_distance, u64 maximum_loads_per_update, u64 seed, VOX__chunk_io* chunk_io) {
+    VOX__world output;
+
+    // chunks are unloaded one chunk past the load radius, so bound memory by that
+    output.p_maximum_chunk_count = (u64)((load_radius * 2) + 3) * (u64)((load_radius * 2) + 3) * (u64)((load_height_radius * 2) + 3);
+
+    // keep load factor at or below one half
+    output.p_slot_count = 1;
+    while (output.p_slot_count < output.p_maximum_chunk_count * 2) {
+        output.p_slot_count *= 2;
+    }
+
+    // setup slots
+    output.p_slots = VOX__create__buffer(sizeof(VOX__world_slot) * output.p_slot_count);
+    for (u64 i = 0; i < output.p_slot_count; i++) {
+        ((VOX__world_slot*)output.p_slots.p_data)[i].p_occupied = VOX__bt__false;
+    }
+
+    // setup other data
+    output.p_chunk_count = 0;
+    output.p_load_radius = load_radius;
+    output.p_load_height_radius = load_height_radius;
+    output.p_lod_distance = lod_distance;
+    output.p_maximum_loads_per_update = maximum_loads_per_update;
+    output.p_seed = seed;
+    output.p_chunk_io = chunk_io;
+    output.p_center = VOX__create__chunk_position(0, 0, 0);
+    output.p_fully_loaded = VOX__bt__false;
+    output.p_total_loads = 0;
+    output.p_total_unloads = 0;
+    output.p_draw_allocations = VOX__create__buffer(sizeof(VOX__gpu_arena_allocation) * output.p_slot_count);
+    output.p_draw_offsets = VOX__create__buffer(sizeof(VOX__3D_position) * output.p_slot_count);
+    output.p_cull_slots = VOX__create__buffer(sizeof(u64) * output.p_slot_count);
+    output.p_cull_centers = VOX__create__buffer(sizeof(f32) * output.p_slot_count * 3);
+    output.p_cull_visible = VOX__create__buffer(sizeof(u8) * output.p_slot_count);
+    output.p_load_requests = VOX__create__buffer(sizeof(VOX__chunk_position) * output.p_slot_count);
+    output.p_light_additions = VOX__create__light_queue();
+    output.p_light_removals = VOX__create__light_queue();
+    output.p_light_changed_chunks = VOX__create__buffer(sizeof(VOX__chunk_position) * output.p_slot_count);
+    output.p_light_changed_chunk_count = 0;
+    output.p_next_version = 1;
+
+    return output;
+}
+
+VOX__world_slot* VOX__find__world_slot(VOX__world* world, VOX__chunk_position chunk_position) {
+    VOX__world_slot* slots;
+    u64 index;
+
+    // setup probe
+    slots = (VOX__world_slot*)(*world).p_slots.p_data;
+    index = VOX__calculate__chunk_position_hash(chunk_position) & ((*world).p_slot_count - 1);
+
+    // probe until found or empty
+    while (slots[index].p_occupied == VOX__bt__true) {
+        if (VOX__check__chunk_positions_are_equal(slots[index].p_position, chunk_position) == VOX__bt__true) {
+            return &slots[index];
+        }
+
+        index = (index + 1) & ((*world).p_slot_count - 1);
+    }
+
+    return 0;
+}
+
+VOX__world_slot* VOX__insert__chunk_into_world(VOX__world* world, VOX__chunk_position chunk_position, VOX__chunk chunk) {
+    VOX__world_slot* slots;
+    u64 index;
+
+    // setup probe
+    slots = (VOX__world_slot*)(*world).p_slots.p_data;
+    index = VOX__calculate__chunk_position_hash(chunk_position) & ((*world).p_slot_count - 1);
+
+    // find first empty slot
+    while (slots[index].p_occupied == VOX__bt__true) {
+        index = (index + 1) & ((*world).p_slot_count - 1);
+    }
+
+    // write slot
+    slots[index].p_occupied = VOX__bt__true;
+    slots[index].p_position = chunk_position;
+    slots[index].p_chunk = chunk;
+    slots[index].p_needs_mesh = VOX__bt__true;
+    slots[index].p_loading = VOX__bt__false;
+    slots[index].p_modified = VOX__bt__false;
+    slots[index].p_version = (*world).p_next_version++;
+    slots[index].p_lod_level = VOX__calculate__chunk_lod_level((*world).p_center, chunk_position, (*world).p_lod_distance);
+    slots[index].p_mesh = VOX__create_null__gpu_arena_allocation();
+    slots[index].p_light = VOX__create__buffer__add_address(0, 0);
+    slots[index].p_light_changes = 0;
+    slots[index].p_edited = VOX__bt__false;
+    slots[index].p_patchable_mesh = 0;
+    (*world).p_chunk_count++;
+    (*world).p_total_loads++;
+
+    return &slots[index];
+}
+
+void VOX__close__world_slot_patchable_mesh(VOX__world_slot* slot) {
+    // nothing kept
+    if ((*slot).p_patchable_mesh == 0) {
+        return;
+    }
+
+    VOX__destroy__patchable_mesh(*(*slot).p_patchable_mesh);
+    VOX__destroy__allocation__allocator(&VOX__global__pool_allocator, (*slot).p_patchable_mesh, sizeof(VOX__patchable_mesh));
+    (*slot).p_patchable_mesh = 0;
+
+    return;
+}
+
+// gpu_arena may be 0 when running headless (no meshes are ever sent)
+void VOX__remove__world_slot(VOX__world* world, u64 index, VOX__gpu_arena* gpu_arena) {
+    VOX__world_slot* slots;
+    u64 mask;
+    u64 next;
+    u64 home;
+
+    // setup variables
+    slots = (VOX__world_slot*)(*world).p_slots.p_data;
+    mask = (*world).p_slot_count - 1;
+
+    // free slot contents, keeping changes
+    if (slots[index].p_modified == VOX__bt__true && (*world).p_chunk_io != 0) {
+        VOX__compact__chunk(&slots[index].p_chunk);
+        VOX__request__chunk_save((*world).p_chunk_io, slots[index].p_position, slots[index].p_chunk);
+    } else {
+        VOX__destroy__chunk(slots[index].p_chunk);
+    }
+    if (gpu_arena != 0) {
+        VOX__close__gpu_arena_allocation(gpu_arena, slots[index].p_mesh);
+    }
+    VOX__close__world_slot_patchable_mesh(&slots[index]);
+    VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, slots[index].p_light);
+    slots[index].p_occupied = VOX__bt__false;
+    (*world).p_chunk_count--;
+    (*world).p_total_unloads++;
+
+    // shift later probe chain entries back so no tombstones are needed
+    next = index;
+    while (VOX__bt__true) {
+        next = (next + 1) & mask;
+        if (slots[next].p_occupied == VOX__bt__false) {
+            break;
+        }
+
+        // entries whose home lies cyclically in (index, next] stay where they are
+        home = VOX__calculate__chunk_position_hash(slots[next].p_position) & mask;
+        if ((index <= next) ? (index < home && home <= next) : (index < home || home <= next)) {
+            continue;
+        }
+
+        slots[index] = slots[next];
+        slots[next].p_occupied = VOX__bt__false;
+        index = next;
+    }
+
+    return;
+}
+
+void VOX__mark__world_slot_for_mesh(VOX__world* world, VOX__world_slot* slot) {
+    (*slot).p_version = (*world).p_next_version++;
+
+    // loading chunks are meshed once they arrive anyway
+    if ((*slot).p_loading == VOX__bt__false) {
+        (*slot).p_needs_mesh = VOX__bt__true;
+    }
+
+    return;
+}
+
+// the slot holding a block whose chunk is loaded & lit, 0 otherwise (cache keeps the last slot found, light mostly spreads within one chunk)
+VOX__world_slot* VOX__find__world_slot__lit_block(VOX__world* world, s64 x, s64 y, s64 z, VOX__world_slot** cache) {
+    VOX__chunk_position chunk_position;
+    VOX__world_slot* output;
+
+    // setup chunk position
+    chunk_position = VOX__create__chunk_position(VOX__calculate__floor_division((s32)x, VOX__dt__chunk_side_length), VOX__calculate__floor_division((s32)y, VOX__dt__chunk_side_length), VOX__calculate__floor_division((s32)z, VOX__dt__chunk_side_length));
+
+    // same chunk as last time
+    if (*cache != 0 && VOX__check__chunk_positions_are_equal((**cache).p_position, chunk_position) == VOX__bt__true) {
+        return *cache;
+    }
+
+    // look up
+    output = VOX__find__world_slot(world, chunk_position);
+    if (output == 0 || (*output).p_light.p_data == 0) {
+        return 0;
+    }
+    *cache = output;
+
+    return output;
+}
+
+// a bit per chunk ((x + 1) + (y + 1) * 3 + (z + 1) * 9) whose mesh reads the local block, the chunk itself & every neighbor whose border reaches it
+u32 VOX__calculate__chunk_border_neighbor_mask(u64 x, u64 y, u64 z) {
+    s64 low[3];
+    s64 high[3];
+    u64 position[3];
+    u32 output;
+
+    // neighbors on each side the block touches
+    position[0] = x;
+    position[1] = y;
+    position[2] = z;
+    for (u64 axis = 0; axis < 3; axis++) {
+        low[axis] = (position[axis] == 0) ? -1 : 0;
+        high[axis] = (position[axis] == VOX__dt__chunk_side_length - 1) ? 1 : 0;
+    }
+    output = 0;
+    for (s64 dz = low[2]; dz <= high[2]; dz++) {
+        for (s64 dy = low[1]; dy <= high[1]; dy++) {
+            for (s64 dx = low[0]; dx <= high[0]; dx++) {
+                output |= (u32)1 << ((dx + 1) + ((dy + 1) * 3) + ((dz + 1) * 9));
+            }
+        }
+    }
+
+    return output;
+}
+
+// notes which chunk meshes read a changed light value
+void VOX__record__world_light_change(VOX__world* world, VOX__world_slot* slot, u64 x, u64 y, u64 z) {
+    u32 changes;
+
+    // chunks reading the block
+    changes = VOX__calculate__chunk_border_neighbor_mask(x, y, z);
+
+    // first change in this chunk
+    if ((*slot).p_light_changes == 0) {
+        ((VOX__chunk_position*)(*world).p_light_changed_chunks.p_data)[(*world).p_light_changed_chunk_count] = (*slot).p_position;
+        (*world).p_light_changed_chunk_count++;
+    }
+    (*slot).p_light_changes |= changes;
+
+    return;
+}
+
+// every chunk whose mesh reads a changed light value is meshed again
+void VOX__send__world_light_changes_to_meshes(VOX__world* world) {
+    VOX__chunk_position chunk_position;
+    VOX__world_slot* slot;
+    VOX__world_slot* neighbor;
+
+    for (u64 i = 0; i < (*world).p_light_changed_chunk_count; i++) {
+        chunk_position = ((VOX__chunk_position*)(*world).p_light_changed_chunks.p_data)[i];
+        slot = VOX__find__world_slot(world, chunk_position);
+
+        for (u64 bit = 0; bit < 27; bit++) {
+            if (((*slot).p_light_changes & ((u32)1 << bit)) == 0) {
+                continue;
+            }
+
+            neighbor = VOX__find__world_slot(world, VOX__create__chunk_position(chunk_position.p_x + (s32)(bit % 3) - 1, chunk_position.p_y + (s32)((bit / 3) % 3) - 1, chunk_position.p_z + (s32)(bit / 9) - 1));
+            if (neighbor != 0) {
+                VOX__mark__world_slot_for_mesh(world, neighbor);
+            }
+        }
+
+        (*slot).p_light_changes = 0;
+    }
+    (*world).p_light_changed_chunk_count = 0;
+
+    return;
+}
+
+// runs queued removals then additions until the light settles
+void VOX__propagate__world_light(VOX__world* world) {
+    s64 directions[VOX__dt__block_face_count][3] = { { -1, 0, 0 }, { 1, 0, 0 }, { 0, -1, 0 }, { 0, 1, 0 }, { 0, 0, -1 }, { 0, 0, 1 } };
+    VOX__world_slot* cache;
+    VOX__world_slot* slot;
+    VOX__light_node node;
+    s64 neighbor[3];
+    u64 local[3];
+    u8* light;
+    u8 level;
+    u8 next_level;
+    u8 emission;
+
+    // setup variables
+    cache = 0;
+
+    // removals darken everything the removed light reached, brighter light met on the way is spread back in afterwards
+    while ((*world).p_light_removals.p_count > 0) {
+        node = VOX__pop__light_queue(&(*world).p_light_removals);
+
+        for (u64 direction = 0; direction < VOX__dt__block_face_count; direction++) {
+            neighbor[0] = node.p_x + directions[direction][0];
+            neighbor[1] = node.p_y + directions[direction][1];
+            neighbor[2] = node.p_z + directions[direction][2];
+            slot = VOX__find__world_slot__lit_block(world, neighbor[0], neighbor[1], neighbor[2], &cache);
+            if (slot == 0) {
+                continue;
+            }
+
+            // read neighbor
+            for (u64 axis = 0; axis < 3; axis++) {
+                local[axis] = (u64)neighbor[axis] & (VOX__dt__chunk_side_length - 1);
+            }
+            light = &((u8*)(*slot).p_light.p_data)[VOX__calculate__chunk_block_index(local[0], local[1], local[2])];
+            level = (*light >> node.p_channel) & 15;
+            if (level == 0) {
+                continue;
+            }
+
+            // lit by the removed light (sky light straight below full sky light always is)
+            if (level < node.p_level || (node.p_channel == VOX__lct__sky && direction == VOX__bft__bottom && node.p_level == VOX__dt__light_maximum && level == VOX__dt__light_maximum)) {
+                *light &= ~(15 << node.p_channel);
+                VOX__record__world_light_change(world, slot, local[0], local[1], local[2]);
+                VOX__push__light_queue(&(*world).p_light_removals, VOX__create__light_node(neighbor[0], neighbor[1], neighbor[2], level, node.p_channel));
+
+                // light sources keep their own light
+                emission = (node.p_channel == VOX__lct__block) ? VOX__read__block_light_emission(VOX__read__block_ID_from_chunk((*slot).p_chunk, local[0], local[1], local[2])) : 0;
+                if (emission > 0) {
+                    *light |= emission;
+                    VOX__push__light_queue(&(*world).p_light_additions, VOX__create__light_node(neighbor[0], neighbor[1], neighbor[2], emission, node.p_channel));
+                }
+            } else {
+                VOX__push__light_queue(&(*world).p_light_additions, VOX__create__light_node(neighbor[0], neighbor[1], neighbor[2], level, node.p_channel));
+            }
+        }
+    }
+
+    // additions spread from the level each block holds now
+    while ((*world).p_light_additions.p_count > 0) {
+        node = VOX__pop__light_queue(&(*world).p_light_additions);
+        slot = VOX__find__world_slot__lit_block(world, node.p_x, node.p_y, node.p_z, &cache);
+        if (slot == 0) {
+            continue;
+        }
+        level = (((u8*)(*slot).p_light.p_data)[VOX__calculate__chunk_block_index((u64)node.p_x & (VOX__dt__chunk_side_length - 1), (u64)node.p_y & (VOX__dt__chunk_side_length - 1), (u64)node.p_z & (VOX__dt__chunk_side_length - 1))] >> node.p_channel) & 15;
+
+        for (u64 direction = 0; direction < VOX__dt__block_face_count; direction++) {
+            neighbor[0] = node.p_x + directions[direction][0];
+            neighbor[1] = node.p_y + directions[direction][1];
+            neighbor[2] = node.p_z + directions[direction][2];
+            slot = VOX__find__world_slot__lit_block(world, neighbor[0], neighbor[1], neighbor[2], &cache);
+            if (slot == 0) {
+                continue;
+            }
+
+            // brighten neighbor
+            for (u64 axis = 0; axis < 3; axis++) {
+                local[axis] = (u64)neighbor[axis] & (VOX__dt__chunk_side_length - 1);
+            }
+            light = &((u8*)(*slot).p_light.p_data)[VOX__calculate__chunk_block_index(local[0], local[1], local[2])];
+            next_level = VOX__calculate__light_step(level, VOX__read__block_light_opacity(VOX__read__block_ID_from_chunk((*slot).p_chunk, local[0], local[1], local[2])), node.p_channel, direction == VOX__bft__bottom);
+            if (next_level > ((*light >> node.p_channel) & 15)) {
+                *light = (*light & ~(15 << node.p_channel)) | (next_level << node.p_channel);
+                VOX__record__world_light_change(world, slot, local[0], local[1], local[2]);
+                VOX__push__light_queue(&(*world).p_light_additions, VOX__create__light_node(neighbor[0], neighbor[1], neighbor[2], next_level, node.p_channel));
+            }
+        }
+    }
+
+    // remesh what changed
+    VOX__send__world_light_changes_to_meshes(world);
+
+    return;
+}
+
+// queues a chunk's own light sources, open sky comes in from above when the chunk above is not loaded
+void VOX__seed__world_chunk_light(VOX__world* world, VOX__world_slot* slot) {
+    VOX__world_slot* above;
+    s64 origin[3];
+    u8* light;
+    VOX__block_ID block_ID;
+    u8 level;
+
+    // setup variables
+    light = (u8*)(*slot).p_light.p_data;
+    origin[0] = (s64)(*slot).p_position.p_x * VOX__dt__chunk_side_length;
+    origin[1] = (s64)(*slot).p_position.p_y * VOX__dt__chunk_side_length;
+    origin[2] = (s64)(*slot).p_position.p_z * VOX__dt__chunk_side_length;
+    above = VOX__find__world_slot(world, VOX__create__chunk_position((*slot).p_position.p_x, (*slot).p_position.p_y + 1, (*slot).p_position.p_z));
+
+    // all air chunks hold no light sources
+    if ((*slot).p_chunk.p_bits_per_block != 0 || ((VOX__block_ID*)(*slot).p_chunk.p_palette.p_data)[0] != VOX__bit__air) {
+        for (u64 z = 0; z < VOX__dt__chunk_side_length; z++) {
+            for (u64 y = 0; y < VOX__dt__chunk_side_length; y++) {
+                for (u64 x = 0; x < VOX__dt__chunk_side_length; x++) {
+                    level = VOX__read__block_light_emission(VOX__read__block_ID_from_chunk((*slot).p_chunk, x, y, z));
+                    if (level > 0) {
+                        light[VOX__calculate__chunk_block_index(x, y, z)] |= level;
+                        VOX__record__world_light_change(world, slot, x, y, z);
+                        VOX__push__light_queue(&(*world).p_light_additions, VOX__create__light_node(origin[0] + x, origin[1] + y, origin[2] + z, level, VOX__lct__block));
+                    }
+                }
+            }
+        }
+    }
+
+    // open sky over the top layer
+    if (above == 0 || (*above).p_light.p_data == 0) {
+        for (u64 z = 0; z < VOX__dt__chunk_side_length; z++) {
+            for (u64 x = 0; x < VOX__dt__chunk_side_length; x++) {
+                block_ID = VOX__read__block_ID_from_chunk((*slot).p_chunk, x, VOX__dt__chunk_side_length - 1, z);
+                level = VOX__calculate__light_step(VOX__dt__light_maximum, VOX__read__block_light_opacity(block_ID), VOX__lct__sky, VOX__bt__true);
+                if (level > 0) {
+                    light[VOX__calculate__chunk_block_index(x, VOX__dt__chunk_side_length - 1, z)] |= level << VOX__lct__sky;
+                    VOX__record__world_light_change(world, slot, x, VOX__dt__chunk_side_length - 1, z);
+                    VOX__push__light_queue(&(*world).p_light_additions, VOX__create__light_node(origin[0] + x, origin[1] + VOX__dt__chunk_side_length - 1, origin[2] + z, level, VOX__lct__sky));
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+// lights a chunk that just arrived from its own light sources, the sky & the light already around it
+void VOX__light__world_chunk(VOX__world* world, VOX__world_slot* slot) {
+    s64 directions[VOX__dt__block_face_count][3] = { { -1, 0, 0 }, { 1, 0, 0 }, { 0, -1, 0 }, { 0, 1, 0 }, { 0, 0, -1 }, { 0, 0, 1 } };
+    VOX__world_slot* neighbor;
+    VOX__world_slot* below;
+    u64 axis;
+    u64 u_axis;
+    u64 v_axis;
+    u64 local[3];
+    s64 origin[3];
+    u8 light;
+    u8 opacity;
+    u8 open_sky_level;
+
+    // setup light
+    (*slot).p_light = VOX__create__buffer__allocator(&VOX__global__pool_allocator, VOX__dt__chunk_block_count);
+    VOX__fill__bytes((*slot).p_light.p_data, (*slot).p_light.p_length, 0);
+    VOX__seed__world_chunk_light(world, slot);
+
+    // light on each lit neighbor's facing layer spreads in
+    for (u64 direction = 0; direction < VOX__dt__block_face_count; direction++) {
+        neighbor = VOX__find__world_slot(world, VOX__create__chunk_position((*slot).p_position.p_x + (s32)directions[direction][0], (*slot).p_position.p_y + (s32)directions[direction][1], (*slot).p_position.p_z + (s32)directions[direction][2]));
+        if (neighbor == 0 || (*neighbor).p_light.p_data == 0) {
+            continue;
+        }
+
+        // the neighbor's layer touching this chunk
+        axis = direction / 2;
+        u_axis = (axis + 1) % 3;
+        v_axis = (axis + 2) % 3;
+        local[axis] = (direction % 2 == 1) ? 0 : VOX__dt__chunk_side_length - 1;
+        origin[0] = (s64)(*neighbor).p_position.p_x * VOX__dt__chunk_side_length;
+        origin[1] = (s64)(*neighbor).p_position.p_y * VOX__dt__chunk_side_length;
+        origin[2] = (s64)(*neighbor).p_position.p_z * VOX__dt__chunk_side_length;
+        for (u64 v = 0; v < VOX__dt__chunk_side_length; v++) {
+            for (u64 u = 0; u < VOX__dt__chunk_side_length; u++) {
+                local[u_axis] = u;
+                local[v_axis] = v;
+                light = ((u8*)(*neighbor).p_light.p_data)[VOX__calculate__chunk_block_index(local[0], local[1], local[2])];
+                if ((light & 15) > 0) {
+                    VOX__push__light_queue(&(*world).p_light_additions, VOX__create__light_node(origin[0] + local[0], origin[1] + local[1], origin[2] + local[2], light & 15, VOX__lct__block));
+                }
+                if ((light >> 4) > 0) {
+                    VOX__push__light_queue(&(*world).p_light_additions, VOX__create__light_node(origin[0] + local[0], origin[1] + local[1], origin[2] + local[2], light >> 4, VOX__lct__sky));
+                }
+            }
+        }
+
+        // the new blocks shade the neighbor's border faces (chunks only touching at edges & corners catch up on their next change)
+        if ((*slot).p_chunk.p_bits_per_block != 0 || ((VOX__block_ID*)(*slot).p_chunk.p_palette.p_data)[0] != VOX__bit__air) {
+            VOX__mark__world_slot_for_mesh(world, neighbor);
+        }
+    }
+    VOX__propagate__world_light(world);
+
+    // the chunk below took open sky for granted, columns where this chunk lets less through go dark & relight from around them
+    below = VOX__find__world_slot(world, VOX__create__chunk_position((*slot).p_position.p_x, (*slot).p_position.p_y - 1, (*slot).p_position.p_z));
+    if (below != 0 && (*below).p_light.p_data != 0) {
+        for (u64 z = 0; z < VOX__dt__chunk_side_length; z++) {
+            for (u64 x = 0; x < VOX__dt__chunk_side_length; x++) {
+                opacity = VOX__read__block_light_opacity(VOX__read__block_ID_from_chunk((*below).p_chunk, x, VOX__dt__chunk_side_length - 1, z));
+                open_sky_level = VOX__calculate__light_step(VOX__dt__light_maximum, opacity, VOX__lct__sky, VOX__bt__true);
+                light = ((u8*)(*below).p_light.p_data)[VOX__calculate__chunk_block_index(x, VOX__dt__chunk_side_length - 1, z)];
+                if (open_sky_level > 0 && (light >> 4) == open_sky_level && VOX__calculate__light_step(((u8*)(*slot).p_light.p_data)[VOX__calculate__chunk_block_index(x, 0, z)] >> 4, opacity, VOX__lct__sky, VOX__bt__true) < open_sky_level) {
+                    ((u8*)(*below).p_light.p_data)[VOX__calculate__chunk_block_index(x, VOX__dt__chunk_side_length - 1, z)] &= 15;
+                    VOX__record__world_light_change(world, below, x, VOX__dt__chunk_side_length - 1, z);
+                    VOX__push__light_queue(&(*world).p_light_removals, VOX__create__light_node(((s64)(*below).p_position.p_x * VOX__dt__chunk_side_length) + x, ((s64)(*below).p_position.p_y * VOX__dt__chunk_side_length) + VOX__dt__chunk_side_length - 1, ((s64)(*below).p_position.p_z * VOX__dt__chunk_side_length) + z, open_sky_level, VOX__lct__sky));
+                }
+            }
+        }
+        VOX__propagate__world_light(world);
+    }
+
+    return;
+}
+
+// clears every chunk's light & floods it again from scratch (what incremental updates must always agree with)
+void VOX__relight__world(VOX__world* world) {
+    VOX__world_slot* slots;
+
+    // setup variables
+    slots = (VOX__world_slot*)(*world).p_slots.p_data;
+
+    // darken everything first so open sky checks see every lit chunk
+    for (u64 i = 0; i < (*world).p_slot_count; i++) {
+        if (slots[i].p_occupied == VOX__bt__true && slots[i].p_light.p_data != 0) {
+            VOX__fill__bytes(slots[i].p_light.p_data, slots[i].p_light.p_length, 0);
+            VOX__record__world_light_change(world, &slots[i], 1, 1, 1);
+        }
+    }
+
+    // seed & spread
+    for (u64 i = 0; i < (*world).p_slot_count; i++) {
+        if (slots[i].p_occupied == VOX__bt__true && slots[i].p_light.p_data != 0) {
+            VOX__seed__world_chunk_light(world, &slots[i]);
+        }
+    }
+    VOX__propagate__world_light(world);
+
+    return;
+}
+
+// blocks in chunks that are not loaded (or still loading) read as unlit
+u8 VOX__read__light_from_world(VOX__world* world, s64 x, s64 y, s64 z) {
+    VOX__world_slot* cache;
+    VOX__world_slot* slot;
+
+    // find chunk
+    cache = 0;
+    slot = VOX__find__world_slot__lit_block(world, x, y, z, &cache);
+    if (slot == 0) {
+        return 0;
+    }
+
+    return ((u8*)(*slot).p_light.p_data)[VOX__calculate__chunk_block_index((u64)x & (VOX__dt__chunk_side_length - 1), (u64)y & (VOX__dt__chunk_side_length - 1), (u64)z & (VOX__dt__chunk_side_length - 1))];
+}
+
+// the chunk & only those neighbors whose border touches the block switch to patched meshes
+void VOX__mark__world_block_edit(VOX__world* world, VOX__world_slot* slot, u64 x, u64 y, u64 z) {
+    VOX__world_slot* neighbor;
+    u32 neighbors;
+
+    // mark chunk
+    (*slot).p_edited = VOX__bt__true;
+
+    // mark touching neighbors
+    neighbors = VOX__calculate__chunk_border_neighbor_mask(x, y, z) & ~((u32)1 << 13);
+    for (u64 bit = 0; bit < 27; bit++) {
+        if ((neighbors & ((u32)1 << bit)) != 0) {
+            neighbor = VOX__find__world_slot(world, VOX__create__chunk_position((*slot).p_position.p_x + (s32)(bit % 3) - 1, (*slot).p_position.p_y + (s32)((bit / 3) % 3) - 1, (*slot).p_position.p_z + (s32)(bit / 9) - 1));
+            if (neighbor != 0) {
+                (*neighbor).p_edited = VOX__bt__true;
+            }
+        }
+    }
+
+    return;
+}
+
+// returns false when the block's chunk is not loaded, light flows back in or drains out around the change
+VOX__bt VOX__write__block_ID_to_world(VOX__world* world, s64 x, s64 y, s64 z, VOX__block_ID block_ID) {
+    s64 directions[VOX__dt__block_face_count][3] = { { -1, 0, 0 }, { 1, 0, 0 }, { 0, -1, 0 }, { 0, 1, 0 }, { 0, 0, -1 }, { 0, 0, 1 } };
+    VOX__world_slot* cache;
+    VOX__world_slot* slot;
+    u64 local[3];
+    u8* light;
+    u8 neighbor_light;
+    u8 emission;
+
+    // find chunk
+    cache = 0;
+    slot = VOX__find__world_slot__lit_block(world, x, y, z, &cache);
+    if (slot == 0) {
+        return VOX__bt__false;
+    }
+    local[0] = (u64)x & (VOX__dt__chunk_side_length - 1);
+    local[1] = (u64)y & (VOX__dt__chunk_side_length - 1);
+    local[2] = (u64)z & (VOX__dt__chunk_side_length - 1);
+
+    // nothing changes
+    if (VOX__read__block_ID_from_chunk((*slot).p_chunk, local[0], local[1], local[2]) == block_ID) {
+        return VOX__bt__true;
+    }
+
+    // write block (faces & occlusion on the chunk border are read by the neighbors' meshes too)
+    VOX__write__block_ID_to_chunk(&(*slot).p_chunk, local[0], local[1], local[2], block_ID);
+    (*slot).p_modified = VOX__bt__true;
+    VOX__mark__world_slot_for_mesh(world, slot);
+    VOX__record__world_light_change(world, slot, local[0], local[1], local[2]);
+    VOX__mark__world_block_edit(world, slot, local[0], local[1], local[2]);
+
+    // drain the old light in both channels
+    light = &((u8*)(*slot).p_light.p_data)[VOX__calculate__chunk_block_index(local[0], local[1], local[2])];
+    if ((*light & 15) > 0) {
+        VOX__push__light_queue(&(*world).p_light_removals, VOX__create__light_node(x, y, z, *light & 15, VOX__lct__block));
+    }
+    if ((*light >> 4) > 0) {
+        VOX__push__light_queue(&(*world).p_light_removals, VOX__create__light_node(x, y, z, *light >> 4, VOX__lct__sky));
+    }
+    *light = 0;
+
+    // new light source
+    emission = VOX__read__block_light_emission(block_ID);
+    if (emission > 0) {
+        *light = emission;
+        VOX__push__light_queue(&(*world).p_light_additions, VOX__create__light_node(x, y, z, emission, VOX__lct__block));
+    }
+
+    // light around the block flows back in
+    for (u64 direction = 0; direction < VOX__dt__block_face_count; direction++) {
+        neighbor_light = VOX__read__light_from_world(world, x + directions[direction][0], y + directions[direction][1], z + directions[direction][2]);
+        if ((neighbor_light & 15) > 0) {
+            VOX__push__light_queue(&(*world).p_light_additions, VOX__create__light_node(x + directions[direction][0], y + directions[direction][1], z + directions[direction][2], neighbor_light & 15, VOX__lct__block));
+        }
+        if ((neighbor_light >> 4) > 0) {
+            VOX__push__light_queue(&(*world).p_light_additions, VOX__create__light_node(x + directions[direction][0], y + directions[direction][1], z + directions[direction][2], neighbor_light >> 4, VOX__lct__sky));
+        }
+    }
+    VOX__propagate__world_light(world);
+
+    return VOX__bt__true;
+}
+
+// blocks & light around a lit chunk, borders toward chunks not loaded (or loading) are air lit like the chunk's own edge so faces there are not shaded dark
+void VOX__read__chunk_neighborhood_from_world(VOX__world* world, VOX__world_slot* slot, VOX__chunk_neighborhood* neighborhood) {
+    VOX__block_ID block_IDs[VOX__dt__chunk_block_count];
+    VOX__world_slot* neighbors[27];
+    VOX__world_slot* neighbor;
+    s64 region[3];
+    s64 position[3];
+    u64 local[3];
+    u64 index;
+
+    // unlit chunks have nothing to share
+    if ((*slot).p_light.p_data == 0) {
+        VOX__write__chunk_to_chunk_neighborhood__unlit((*slot).p_chunk, neighborhood);
+
+        return;
+    }
+
+    // find every lit neighbor once
+    for (u64 i = 0; i < 27; i++) {
+        neighbors[i] = VOX__find__world_slot(world, VOX__create__chunk_position((*slot).p_position.p_x + (s32)(i % 3) - 1, (*slot).p_position.p_y + (s32)((i / 3) % 3) - 1, (*slot).p_position.p_z + (s32)(i / 9) - 1));
+        if (neighbors[i] != 0 && (*neighbors[i]).p_light.p_data == 0) {
+            neighbors[i] = 0;
+        }
+    }
+
+    // chunk itself
+    VOX__read__block_IDs_from_chunk((*slot).p_chunk, block_IDs);
+    for (u64 z = 0; z < VOX__dt__chunk_side_length; z++) {
+        for (u64 y = 0; y < VOX__dt__chunk_side_length; y++) {
+            for (u64 x = 0; x < VOX__dt__chunk_side_length; x++) {
+                index = VOX__calculate__chunk_neighborhood_index(x, y, z);
+                (*neighborhood).p_block_IDs[index] = block_IDs[VOX__calculate__chunk_block_index(x, y, z)];
+                (*neighborhood).p_light[index] = ((u8*)(*slot).p_light.p_data)[VOX__calculate__chunk_block_index(x, y, z)];
+            }
+        }
+    }
+
+    // border
+    for (position[2] = -1; position[2] <= VOX__dt__chunk_side_length; position[2]++) {
+        for (position[1] = -1; position[1] <= VOX__dt__chunk_side_length; position[1]++) {
+            for (position[0] = -1; position[0] <= VOX__dt__chunk_side_length; position[0]++) {
+                // setup which neighbor holds the block
+                for (u64 axis = 0; axis < 3; axis++) {
+                    region[axis] = (position[axis] < 0) ? -1 : ((position[axis] >= VOX__dt__chunk_side_length) ? 1 : 0);
+                }
+                if (region[0] == 0 && region[1] == 0 && region[2] == 0) {
+                    continue;
+                }
+                neighbor = neighbors[(region[0] + 1) + ((region[1] + 1) * 3) + ((region[2] + 1) * 9)];
+                index = VOX__calculate__chunk_neighborhood_index(position[0], position[1], position[2]);
+
+                // read neighbor, or copy the nearest edge light of this chunk
+                if (neighbor != 0) {
+                    for (u64 axis = 0; axis < 3; axis++) {
+                        local[axis] = (u64)position[axis] & (VOX__dt__chunk_side_length - 1);
+                    }
+                    (*neighborhood).p_block_IDs[index] = VOX__read__block_ID_from_chunk((*neighbor).p_chunk, local[0], local[1], local[2]);
+                    (*neighborhood).p_light[index] = ((u8*)(*neighbor).p_light.p_data)[VOX__calculate__chunk_block_index(local[0], local[1], local[2])];
+                } else {
+                    for (u64 axis = 0; axis < 3; axis++) {
+                        local[axis] = (u64)(position[axis] - region[axis]);
+                    }
+                    (*neighborhood).p_block_IDs[index] = VOX__bit__air;
+                    (*neighborhood).p_light[index] = ((u8*)(*slot).p_light.p_data)[VOX__calculate__chunk_block_index(local[0], local[1], local[2])];
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+// chunks that crossed a level boundary get meshed again, their old mesh stays drawn until the new one lands
+// (chunk meshes always close their border faces, so neighbors at different levels meet with steps but never holes)
+void VOX__update__world_lod_levels(VOX__world* world) {
+    VOX__world_slot* slots;
+    u64 lod_level;
+
+    // setup variables
+    slots = (VOX__world_slot*)(*world).p_slots.p_data;
+
+    // compare every chunk against the current center
+    for (u64 i = 0; i < (*world).p_slot_count; i++) {
+        if (slots[i].p_occupied == VOX__bt__false) {
+            continue;
+        }
+
+        lod_level = VOX__calculate__chunk_lod_level((*world).p_center, slots[i].p_position, (*world).p_lod_distance);
+        if (lod_level != slots[i].p_lod_level) {
+            slots[i].p_lod_level = lod_level;
+            slots[i].p_version = (*world).p_next_version++;
+
+            // loading chunks are meshed once they arrive anyway
+            if (slots[i].p_loading == VOX__bt__false) {
+                slots[i].p_needs_mesh = VOX__bt__true;
+            }
+        }
+    }
+
+    return;
+}
+
+// fills loading slots with chunks chunk io finished
+void VOX__receive__world_chunk_loads(VOX__world* world) {
+    VOX__chunk_io_request* request;
+    VOX__chunk_io_request* next;
+    VOX__world_slot* slot;
+
+    // take everything finished so far
+    request = VOX__take__completed_chunk_io_requests((*world).p_chunk_io);
+    while (request != 0) {
+        next = (*request).p_next;
+        slot = VOX__find__world_slot(world, (*request).p_position);
+
+        // slots unloaded (or already filled) meanwhile just drop the chunk, cancelled loads were unloaded when cancelled
+        // (a loading slot found for one belongs to a newer request)
+        if (slot != 0 && (*slot).p_loading == VOX__bt__true && (*request).p_status != VOX__cist__cancelled) {
+            (*slot).p_chunk = (*request).p_chunk;
+            (*slot).p_loading = VOX__bt__false;
+            (*slot).p_needs_mesh = VOX__bt__true;
+            (*request).p_chunk = VOX__create_null__chunk();
+            VOX__light__world_chunk(world, slot);
+        }
+
+        VOX__destroy__chunk_io_request(request);
+        request = next;
+    }
+
+    return;
+}
+
+// gpu_arena may be 0 when running headless
+void VOX__update__world(VOX__world* world, VOX__camera camera, VOX__gpu_arena* gpu_arena) {
+    VOX__world_slot* slots;
+    VOX__chunk_position center;
+    VOX__chunk_position chunk_position;
+    VOX__world_slot* slot;
+    s32 ring_count;
+    u64 loads;
+    u64 removals;
+
+    // setup variables
+    slots = (VOX__world_slot*)(*world).p_slots.p_data;
+    center = VOX__calculate__chunk_position_from_world_position(camera.p_position[0], camera.p_position[1], camera.p_position[2]);
+
+    // take finished background loads
+    if ((*world).p_chunk_io != 0) {
+        VOX__receive__world_chunk_loads(world);
+    }
+
+    // camera entered a new chunk, unload chunks that fell out of range
+    if (VOX__check__chunk_positions_are_equal(center, (*world).p_center) == VOX__bt__false || (*world).p_total_loads == 0) {
+        (*world).p_center = center;
+        (*world).p_fully_loaded = VOX__bt__false;
+
+        // removal shifts later entries back & a probe chain wrapping past the end shifts into slots already passed, so repeat until a pass removes nothing
+        do {
+            removals = 0;
+            for (u64 i = 0; i < (*world).p_slot_count;) {
+                if (slots[i].p_occupied == VOX__bt__true && VOX__check__chunk_position_is_within_radius(center, slots[i].p_position, (*world).p_load_radius + 1, (*world).p_load_height_radius + 1) == VOX__bt__false) {
+                    // removal may shift another entry into this slot, so check it again
+                    VOX__remove__world_slot(world, i, gpu_arena);
+                    removals++;
+                } else {
+                    i++;
+                }
+            }
+        } while (removals != 0);
+
+        // queued loads follow the camera, the ones that would be unloaded on arrival are cancelled
+        if ((*world).p_chunk_io != 0) {
+            VOX__update__chunk_io_center((*world).p_chunk_io, center, (*world).p_load_radius + 1, (*world).p_load_height_radius + 1);
+        }
+
+        // remaining chunks pick their level for the new center
+        if ((*world).p_lod_distance > 0) {
+            VOX__update__world_lod_levels(world);
+        }
+    }
+
+    // nothing left to load
+    if ((*world).p_fully_loaded == VOX__bt__true) {
+        return;
+    }
+
+    // load missing chunks nearest ring first, a bounded amount per update
+    loads = 0;
+    ring_count = ((*world).p_load_radius > (*world).p_load_height_radius) ? (*world).p_load_radius : (*world).p_load_height_radius;
+    for (s32 ring = 0; ring <= ring_count; ring++) {
+        for (s32 y = -(*world).p_load_height_radius; y <= (*world).p_load_height_radius; y++) {
+            for (s32 z = -(*world).p_load_radius; z <= (*world).p_load_radius; z++) {
+                for (s32 x = -(*world).p_load_radius; x <= (*world).p_load_radius; x++) {
+                    // only visit this ring
+                    if (abs(x) != ring && abs(y) != ring && abs(z) != ring) {
+                        continue;
+                    }
+                    if (abs(x) > ring || abs(y) > ring || abs(z) > ring) {
+                        continue;
+                    }
+
+                    // skip loaded chunks
+                    chunk_position = VOX__create__chunk_position(center.p_x + x, center.p_y + y, center.p_z + z);
+                    if (VOX__find__world_slot(world, chunk_position) != 0) {
+                        continue;
+                    }
+
+                    // out of budget for this update (background loads cost the caller nothing, so only the bound applies)
+                    if (((*world).p_chunk_io == 0 && loads >= (*world).p_maximum_loads_per_update) || (*world).p_chunk_count >= (*world).p_maximum_chunk_count) {
+                        goto VOX__label__update_world__send_loads;
+                    }
+
+                    // load chunk
+                    if ((*world).p_chunk_io != 0) {
+                        slot = VOX__insert__chunk_into_world(world, chunk_position, VOX__create_null__chunk());
+                        (*slot).p_loading = VOX__bt__true;
+                        (*slot).p_needs_mesh = VOX__bt__false;
+                        ((VOX__chunk_position*)(*world).p_load_requests.p_data)[loads] = chunk_position;
+                    } else {
+                        VOX__light__world_chunk(world, VOX__insert__chunk_into_world(world, chunk_position, VOX__create__chunk__generated(chunk_position, (*world).p_seed)));
+                    }
+                    loads++;
+                }
+            }
+        }
+    }
+
+    (*world).p_fully_loaded = VOX__bt__true;
+
+    // queue background loads together (nearest first within the batch, though chunk io reorders anyway)
+    VOX__label__update_world__send_loads:
+    if ((*world).p_chunk_io != 0 && loads > 0) {
+        VOX__request__chunk_loads((*world).p_chunk_io, (VOX__chunk_position*)(*world).p_load_requests.p_data, loads, (*world).p_seed);
+    }
+
+    return;
+}
+
+// edited chunks are patched in place (recreating the patchable copy when it no longer fits), other chunks replace their mesh
+void VOX__send__mesh_to_world_slot(VOX__world_slot* slot, VOX__gpu_arena* gpu_arena, VOX__object_datum mesh) {
+    // patch
+    if ((*slot).p_patchable_mesh != 0 && VOX__check__gpu_arena_allocation_is_null((*slot).p_mesh) == VOX__bt__false && VOX__patch__patchable_mesh((*slot).p_patchable_mesh, mesh) == VOX__bt__true) {
+        VOX__send__patchable_mesh_to_gpu_arena((*slot).p_patchable_mesh, gpu_arena, &(*slot).p_mesh);
+        (*slot).p_edited = VOX__bt__false;
+
+        return;
+    }
+
+    // replace old mesh
+    VOX__close__gpu_arena_allocation(gpu_arena, (*slot).p_mesh);
+    (*slot).p_mesh = VOX__create_null__gpu_arena_allocation();
+    VOX__close__world_slot_patchable_mesh(slot);
+    if ((*slot).p_edited == VOX__bt__true) {
+        (*slot).p_patchable_mesh = (VOX__patchable_mesh*)VOX__create__allocation__allocator(&VOX__global__pool_allocator, sizeof(VOX__patchable_mesh));
+        *(*slot).p_patchable_mesh = VOX__create__patchable_mesh(mesh, VOX__calculate__vbo_vertex_size((*gpu_arena).p_vertex_format));
+        (*slot).p_mesh = VOX__open__gpu_arena_allocation__patchable_mesh(gpu_arena, (*slot).p_patchable_mesh);
+
+        // arena full
+        if (VOX__check__gpu_arena_allocation_is_null((*slot).p_mesh) == VOX__bt__true) {
+            VOX__close__world_slot_patchable_mesh(slot);
+        } else {
+            VOX__send__patchable_mesh_to_gpu_arena((*slot).p_patchable_mesh, gpu_arena, &(*slot).p_mesh);
+        }
+    } else {
+        (*slot).p_mesh = VOX__send__object_datum_to_gpu_arena(gpu_arena, mesh);
+    }
+    (*slot).p_edited = VOX__bt__false;
+
+    return;
+}
+
+// edited chunks go first so building & digging show up before newly streamed chunks
+void VOX__send__world_meshes_to_gpu_arena(VOX__world* world, VOX__gpu_arena* gpu_arena, VOX__block_dictionary block_dictionary, u64 maximum_meshes) {
+    VOX__world_slot* slots;
+    VOX__chunk_neighborhood neighborhood;
+    VOX__object_datum mesh;
+    u64 meshes;
 
-typedef struct VOX__game_textures {
-    // texture data
-    VOX__2D_texture_array p_block_faces;
+    // setup variables
+    slots = (VOX__world_slot*)(*world).p_slots.p_data;
+    meshes = 0;
+
+    // mesh and upload a bounded number of chunks, edited ones then the rest
+    for (u64 pass = 0; pass < 2; pass++) {
+        for (u64 i = 0; i < (*world).p_slot_count && meshes < maximum_meshes; i++) {
+            if (slots[i].p_occupied == VOX__bt__false || slots[i].p_needs_mesh == VOX__bt__false || (pass == 0 && slots[i].p_edited == VOX__bt__false)) {
+                continue;
+            }
 
-    // texture handles
-    GLuint p_block_faces_handle;
+            // mesh with current neighbors
+            VOX__read__chunk_neighborhood_from_world(world, &slots[i], &neighborhood);
+            mesh = VOX__create__object_datum__greedy_mesh_from_chunk__lit(slots[i].p_chunk, &neighborhood, block_dictionary, VOX__calculate__world_position_from_chunk_position(slots[i].p_position), (*gpu_arena).p_vertex_format, slots[i].p_lod_level, &VOX__global__heap_allocator);
+            VOX__send__mesh_to_world_slot(&slots[i], gpu_arena, mesh);
+            VOX__destroy__object_datum(mesh);
 
-    // active textures
-    GLenum p_block_faces_texture_ID;
-} VOX__game_textures;
+            slots[i].p_needs_mesh = VOX__bt__false;
+            meshes++;
+        }
+    }
 
-VOX__game_textures VOX__open__game_textures(VOX__2D_texture_array block_faces) {
-    VOX__game_textures output;
+    return;
+}
 
-    // setup texture data
-    output.p_block_faces = block_faces;
+void VOX__submit__world_mesh_jobs(VOX__world* world, VOX__job_system* job_system, VOX__block_dictionary block_dictionary, VOX__vft vertex_format) {
+    VOX__world_slot* slots;
+    VOX__chunk_neighborhood* neighborhood;
+
+    // hand every chunk needing a mesh to the workers, with the blocks & light around it as they are now
+    slots = (VOX__world_slot*)(*world).p_slots.p_data;
+    for (u64 i = 0; i < (*world).p_slot_count; i++) {
+        if (slots[i].p_occupied == VOX__bt__true && slots[i].p_needs_mesh == VOX__bt__true) {
+            neighborhood = (VOX__chunk_neighborhood*)VOX__create__allocation__allocator(&VOX__global__pool_allocator, sizeof(VOX__chunk_neighborhood));
+            VOX__read__chunk_neighborhood_from_world(world, &slots[i], neighborhood);
+            VOX__submit__job(job_system, VOX__create__job__mesh_chunk(slots[i].p_position, slots[i].p_version, slots[i].p_chunk, neighborhood, block_dictionary, vertex_format, slots[i].p_lod_level));
+            slots[i].p_needs_mesh = VOX__bt__false;
+        }
+    }
 
-    // setup texture handles
-    glCreateTextures(block_faces.p_texture_type, 1, &(output.p_block_faces_handle));
+    return;
+}
 
-    // setup active textures
-    output.p_block_faces_texture_ID = GL_TEXTURE0 + 0;
+void VOX__send__completed_world_meshes_to_gpu_arena(VOX__world* world, VOX__job_system* job_system, VOX__gpu_arena* gpu_arena) {
+    VOX__job* job;
+    VOX__world_slot* slot;
+
+    // upload finished meshes (only the gl context thread may do this)
+    while ((job = VOX__take__completed_job(job_system)) != 0) {
+        slot = VOX__find__world_slot(world, (*job).p_position);
+
+        // chunk still loaded and unchanged since the job was made
+        if (slot != 0 && (*slot).p_version == (*job).p_version) {
+            VOX__send__mesh_to_world_slot(slot, gpu_arena, (*job).p_mesh);
+        }
+
+        VOX__destroy__job(job);
+    }
+
+    return;
+}
+
+u64 VOX__calculate__world_visible_meshes(VOX__world* world, VOX__frustum* frustum) {
+    VOX__world_slot* slots;
+    u64* cull_slots;
+    f32* centers;
+    VOX__3D_position chunk_offset;
+    u64 candidate_count;
+    u64 output;
+
+    // setup variables
+    slots = (VOX__world_slot*)(*world).p_slots.p_data;
+    cull_slots = (u64*)(*world).p_cull_slots.p_data;
+    centers = (f32*)(*world).p_cull_centers.p_data;
+
+    // collect chunk boxes of every mesh
+    candidate_count = 0;
+    for (u64 i = 0; i < (*world).p_slot_count; i++) {
+        if (slots[i].p_occupied == VOX__bt__true && VOX__check__gpu_arena_allocation_is_null(slots[i].p_mesh) == VOX__bt__false) {
+            chunk_offset = VOX__calculate__world_position_from_chunk_position(slots[i].p_position);
+            cull_slots[candidate_count] = i;
+            centers[candidate_count] = chunk_offset.p_x + (VOX__dt__chunk_side_length / 2.0f);
+            centers[(*world).p_slot_count + candidate_count] = chunk_offset.p_y + (VOX__dt__chunk_side_length / 2.0f);
+            centers[((*world).p_slot_count * 2) + candidate_count] = chunk_offset.p_z + (VOX__dt__chunk_side_length / 2.0f);
+            candidate_count++;
+        }
+    }
+
+    // cull all boxes at once
+    VOX__calculate__boxes_in_frustum(frustum, centers, centers + (*world).p_slot_count, centers + ((*world).p_slot_count * 2), VOX__dt__chunk_side_length / 2.0f, candidate_count, (u8*)(*world).p_cull_visible.p_data);
+
+    // keep visible meshes
+    output = 0;
+    for (u64 i = 0; i < candidate_count; i++) {
+        if (((u8*)(*world).p_cull_visible.p_data)[i] != 0) {
+            ((VOX__gpu_arena_allocation*)(*world).p_draw_allocations.p_data)[output] = slots[cull_slots[i]].p_mesh;
+            ((VOX__3D_position*)(*world).p_draw_offsets.p_data)[output] = VOX__calculate__world_position_from_chunk_position(slots[cull_slots[i]].p_position);
+            output++;
+        }
+    }
+
+    return output;
+}
+
+void VOX__draw__world(VOX__world* world, VOX__gpu_arena* gpu_arena, VOX__frustum* frustum) {
+    u64 draw_count;
+
+    // collect meshes inside the view
+    draw_count = VOX__calculate__world_visible_meshes(world, frustum);
+
+    // draw all meshes at once (float meshes already hold world positions, packed meshes are chunk local)
+    if ((*gpu_arena).p_vertex_format == VOX__vft__packed) {
+        VOX__draw__gpu_arena_allocations(gpu_arena, (VOX__gpu_arena_allocation*)(*world).p_draw_allocations.p_data, (VOX__3D_position*)(*world).p_draw_offsets.p_data, draw_count);
+    } else {
+        VOX__draw__gpu_arena_allocations(gpu_arena, (VOX__gpu_arena_allocation*)(*world).p_draw_allocations.p_data, 0, draw_count);
+    }
+
+    return;
+}
+
+// blocks in chunks that are not loaded (or still loading) read as air
+VOX__block_ID VOX__read__block_ID_from_world(VOX__world* world, s64 x, s64 y, s64 z) {
+    VOX__world_slot* slot;
+
+    // find chunk
+    slot = VOX__find__world_slot(world, VOX__create__chunk_position((s32)VOX__calculate__floor_division(x, VOX__dt__chunk_side_length), (s32)VOX__calculate__floor_division(y, VOX__dt__chunk_side_length), (s32)VOX__calculate__floor_division(z, VOX__dt__chunk_side_length)));
+    if (slot == 0 || (*slot).p_loading == VOX__bt__true) {
+        return VOX__bit__air;
+    }
+
+    return VOX__read__block_ID_from_chunk((*slot).p_chunk, (u64)x & (VOX__dt__chunk_side_length - 1), (u64)y & (VOX__dt__chunk_side_length - 1), (u64)z & (VOX__dt__chunk_side_length - 1));
+}
+
+u64 VOX__calculate__world_block_memory_size(VOX__world* world) {
+    u64 output;
+
+    // setup output
+    output = 0;
+
+    // add up every loaded chunk
+    for (u64 i = 0; i < (*world).p_slot_count; i++) {
+        if (((VOX__world_slot*)(*world).p_slots.p_data)[i].p_occupied == VOX__bt__true) {
+            output += VOX__calculate__chunk_memory_size(((VOX__world_slot*)(*world).p_slots.p_data)[i].p_chunk);
+        }
+    }
+
+    return output;
+}
+
+u64 VOX__calculate__world_loading_count(VOX__world* world) {
+    u64 output;
+
+    // setup output
+    output = 0;
+
+    // count slots still waiting on chunk io
+    for (u64 i = 0; i < (*world).p_slot_count; i++) {
+        if (((VOX__world_slot*)(*world).p_slots.p_data)[i].p_occupied == VOX__bt__true && ((VOX__world_slot*)(*world).p_slots.p_data)[i].p_loading == VOX__bt__true) {
+            output++;
+        }
+    }
+
+    return output;
+}
+
+// gpu_arena may be 0 when running headless
+void VOX__destroy__world(VOX__world world, VOX__gpu_arena* gpu_arena) {
+    VOX__world_slot* slots;
+
+    // destroy chunks (modified ones are handed to chunk io, which writes them before closing)
+    slots = (VOX__world_slot*)world.p_slots.p_data;
+    for (u64 i = 0; i < world.p_slot_count; i++) {
+        if (slots[i].p_occupied == VOX__bt__true) {
+            if (slots[i].p_modified == VOX__bt__true && world.p_chunk_io != 0) {
+                VOX__compact__chunk(&slots[i].p_chunk);
+                VOX__request__chunk_save(world.p_chunk_io, slots[i].p_position, slots[i].p_chunk);
+            } else {
+                VOX__destroy__chunk(slots[i].p_chunk);
+            }
+            if (gpu_arena != 0) {
+                VOX__close__gpu_arena_allocation(gpu_arena, slots[i].p_mesh);
+            }
+            VOX__close__world_slot_patchable_mesh(&slots[i]);
+            VOX__destroy__buffer__allocator(&VOX__global__pool_allocator, slots[i].p_light);
+        }
+    }
+
+    // destroy buffers
+    VOX__destroy__buffer(world.p_slots);
+    VOX__destroy__buffer(world.p_draw_allocations);
+    VOX__destroy__buffer(world.p_draw_offsets);
+    VOX__destroy__buffer(world.p_cull_slots);
+    VOX__destroy__buffer(world.p_cull_centers);
+    VOX__destroy__buffer(world.p_cull_visible);
+    VOX__destroy__buffer(world.p_load_requests);
+    VOX__destroy__light_queue(world.p_light_additions);
+    VOX__destroy__light_queue(world.p_light_removals);
+    VOX__destroy__buffer(world.p_light_changed_chunks);
+
+    return;
+}
+
+/* Brick Tree - Octree Over Chunk Sized Bricks For Queries Across Large Mostly Empty Volumes */
+// a node covers 2^level chunks a side (level 0 is one chunk), leaves either hold one block for their whole volume or, at level 0, a brick
+typedef struct VOX__brick_tree_node {
+    u32 p_children; // first of 8 consecutive child nodes (x, then y, then z halves), 0 for leaves since the root is never a child
+    u32 p_brick; // level 0 leaves with mixed blocks: brick index + 1, otherwise 0
+    VOX__block_ID p_block_ID; // leaves without a brick: the block filling the whole node
+} VOX__brick_tree_node;
+
+typedef struct VOX__brick_tree_brick {
+    VOX__chunk p_chunk; // owned compacted copy
+    u64 p_occupancy; // one bit per 2x2x2 cell holding any solid block, cell x + 4 y + 16 z
+} VOX__brick_tree_brick;
+
+typedef struct VOX__brick_tree {
+    VOX__chunk_position p_origin; // lowest chunk covered
+    u64 p_depth; // covers 2^depth chunks a side
+    VOX__buffer p_nodes; // VOX__brick_tree_node, grown by doubling
+    u64 p_node_count;
+    u32 p_free_node_group; // first node of a released group of 8, chained through p_children, 0 when none
+    VOX__buffer p_bricks; // VOX__brick_tree_brick, grown by doubling
+    u64 p_brick_count;
+    VOX__buffer p_free_bricks; // u32 stack of released brick indices
+    u64 p_free_brick_count;
+} VOX__brick_tree;
+
+// depths past VOX__dt__brick_tree_maximum_depth are clamped to it
+VOX__brick_tree VOX__create__brick_tree(VOX__chunk_position origin, u64 depth) {
+    VOX__brick_tree output;
+
+    // setup output
+    output.p_origin = origin;
+    output.p_depth = (depth > VOX__dt__brick_tree_maximum_depth) ? VOX__dt__brick_tree_maximum_depth : depth;
+    output.p_nodes = VOX__create__buffer(sizeof(VOX__brick_tree_node) * 64);
+    output.p_node_count = 1;
+    output.p_free_node_group = 0;
+    output.p_bricks = VOX__create__buffer(sizeof(VOX__brick_tree_brick) * 64);
+    output.p_brick_count = 0;
+    output.p_free_bricks = VOX__create__buffer(sizeof(u32) * 64);
+    output.p_free_brick_count = 0;
+
+    // root starts as all air
+    ((VOX__brick_tree_node*)output.p_nodes.p_data)[0].p_children = 0;
+    ((VOX__brick_tree_node*)output.p_nodes.p_data)[0].p_brick = 0;
+    ((VOX__brick_tree_node*)output.p_nodes.p_data)[0].p_block_ID = VOX__bit__air;
+
+    return output;
+}
+
+u64 VOX__calculate__brick_tree_side_length(VOX__brick_tree* tree) {
+    return (u64)VOX__dt__chunk_side_length << (*tree).p_depth;
+}
+
+// children inherit the leaf's block, returns the first child
+u32 VOX__split__brick_tree_node(VOX__brick_tree* tree, u64 node) {
+    VOX__buffer larger_nodes;
+    VOX__brick_tree_node* nodes;
+    u32 output;
+
+    // reuse a released group
+    if ((*tree).p_free_node_group != 0) {
+        output = (*tree).p_free_node_group;
+        (*tree).p_free_node_group = ((VOX__brick_tree_node*)(*tree).p_nodes.p_data)[output].p_children;
+    } else {
+        // grow nodes
+        if (((*tree).p_node_count + 8) * sizeof(VOX__brick_tree_node) > (*tree).p_nodes.p_length) {
+            larger_nodes = VOX__create__buffer((*tree).p_nodes.p_length * 2);
+            VOX__copy__bytes_to_bytes((*tree).p_nodes.p_data, (*tree).p_node_count * sizeof(VOX__brick_tree_node), larger_nodes.p_data);
+            VOX__destroy__buffer((*tree).p_nodes);
+            (*tree).p_nodes = larger_nodes;
+        }
+
+        output = (u32)(*tree).p_node_count;
+        (*tree).p_node_count += 8;
+    }
+
+    // setup children
+    nodes = (VOX__brick_tree_node*)(*tree).p_nodes.p_data;
+    for (u64 i = 0; i < 8; i++) {
+        nodes[output + i].p_children = 0;
+        nodes[output + i].p_brick = 0;
+        nodes[output + i].p_block_ID = nodes[node].p_block_ID;
+    }
+    nodes[node].p_children = output;
+
+    return output;
+}
+
+u64 VOX__calculate__brick_occupancy(VOX__chunk chunk) {
+    VOX__block_ID block_IDs[VOX__dt__chunk_block_count];
+    u64 output;
+
+    // setup output
+    output = 0;
+
+    // mark cells holding any solid block
+    VOX__read__block_IDs_from_chunk(chunk, block_IDs);
+    for (u64 z = 0; z < VOX__dt__chunk_side_length; z++) {
+        for (u64 y = 0; y < VOX__dt__chunk_side_length; y++) {
+            for (u64 x = 0; x < VOX__dt__chunk_side_length; x++) {
+                if (block_IDs[VOX__calculate__chunk_block_index(x, y, z)] != VOX__bit__air) {
+                    output |= (u64)1 << ((x / VOX__dt__brick_cell_side_length) + ((y / VOX__dt__brick_cell_side_length) * VOX__dt__brick_cells_per_side) + ((z / VOX__dt__brick_cell_side_length) * VOX__dt__brick_cells_per_side * VOX__dt__brick_cells_per_side));
+                }
+            }
+        }
+    }
+
+    return output;
+}
+
+u32 VOX__open__brick_tree_brick(VOX__brick_tree* tree, VOX__chunk chunk, u64 occupancy) {
+    VOX__buffer larger_bricks;
+    VOX__buffer larger_free_bricks;
+    u32 output;
+
+    // reuse a released brick
+    if ((*tree).p_free_brick_count > 0) {
+        (*tree).p_free_brick_count--;
+        output = ((u32*)(*tree).p_free_bricks.p_data)[(*tree).p_free_brick_count];
+    } else {
+        // grow bricks (the free stack can hold every brick)
+        if (((*tree).p_brick_count + 1) * sizeof(VOX__brick_tree_brick) > (*tree).p_bricks.p_length) {
+            larger_bricks = VOX__create__buffer((*tree).p_bricks.p_length * 2);
+            larger_free_bricks = VOX__create__buffer((*tree).p_free_bricks.p_length * 2);
+            VOX__copy__bytes_to_bytes((*tree).p_bricks.p_data, (*tree).p_brick_count * sizeof(VOX__brick_tree_brick), larger_bricks.p_data);
+            VOX__destroy__buffer((*tree).p_bricks);
+            VOX__destroy__buffer((*tree).p_free_bricks);
+            (*tree).p_bricks = larger_bricks;
+            (*tree).p_free_bricks = larger_free_bricks;
+        }
+
+        output = (u32)(*tree).p_brick_count;
+        (*tree).p_brick_count++;
+    }
+
+    // setup brick
+    ((VOX__brick_tree_brick*)(*tree).p_bricks.p_data)[output].p_chunk = chunk;
+    ((VOX__brick_tree_brick*)(*tree).p_bricks.p_data)[output].p_occupancy = occupancy;
+
+    return output;
+}
+
+void VOX__close__brick_tree_brick(VOX__brick_tree* tree, u32 brick) {
+    // free chunk & keep index for reuse
+    VOX__destroy__chunk(((VOX__brick_tree_brick*)(*tree).p_bricks.p_data)[brick].p_chunk);
+    ((VOX__brick_tree_brick*)(*tree).p_bricks.p_data)[brick].p_chunk = VOX__create_null__chunk();
+    ((u32*)(*tree).p_free_bricks.p_data)[(*tree).p_free_brick_count] = brick;
+    (*tree).p_free_brick_count++;
+
+    return;
+}
+
+// replaces the chunk's volume (chunks outside the tree are ignored), uniform chunks take no brick & equal siblings merge back into their parent
+void VOX__write__chunk_to_brick_tree(VOX__brick_tree* tree, VOX__chunk_position chunk_position, VOX__chunk chunk) {
+    VOX__brick_tree_node* nodes;
+    u64 path[VOX__dt__brick_tree_maximum_depth + 1];
+    s64 local[3];
+    u64 node;
+    u64 octant;
+    VOX__chunk copy;
+    VOX__bt mergeable;
+
+    // the path has one entry per level, so a tree deeper than the maximum is never written
+    if ((*tree).p_depth > VOX__dt__brick_tree_maximum_depth) {
+        return;
+    }
+
+    // setup local chunk coordinates
+    local[0] = (s64)chunk_position.p_x - (*tree).p_origin.p_x;
+    local[1] = (s64)chunk_position.p_y - (*tree).p_origin.p_y;
+    local[2] = (s64)chunk_position.p_z - (*tree).p_origin.p_z;
+    for (u64 axis = 0; axis < 3; axis++) {
+        if (local[axis] < 0 || local[axis] >= ((s64)1 << (*tree).p_depth)) {
+            return;
+        }
+    }
+
+    // descend to the chunk's node, splitting leaves on the way (node indices stay valid when nodes grow, pointers do not)
+    node = 0;
+    for (u64 level = (*tree).p_depth; level > 0; level--) {
+        path[level] = node;
+        if (((VOX__brick_tree_node*)(*tree).p_nodes.p_data)[node].p_children == 0) {
+            VOX__split__brick_tree_node(tree, node);
+        }
+
+        octant = ((local[0] >> (level - 1)) & 1) | (((local[1] >> (level - 1)) & 1) << 1) | (((local[2] >> (level - 1)) & 1) << 2);
+        node = ((VOX__brick_tree_node*)(*tree).p_nodes.p_data)[node].p_children + octant;
+    }
+
+    // release old brick
+    nodes = (VOX__brick_tree_node*)(*tree).p_nodes.p_data;
+    if (nodes[node].p_brick != 0) {
+        VOX__close__brick_tree_brick(tree, nodes[node].p_brick - 1);
+        nodes[node].p_brick = 0;
+    }
+
+    // uniform chunks are stored as the leaf's block (compacting first catches chunks whose other blocks were all overwritten)
+    if (chunk.p_bits_per_block == 0) {
+        nodes[node].p_block_ID = ((VOX__block_ID*)chunk.p_palette.p_data)[0];
+    } else {
+        copy = VOX__create__chunk__copy(chunk);
+        VOX__compact__chunk(&copy);
+
+        if (copy.p_bits_per_block == 0) {
+            nodes[node].p_block_ID = ((VOX__block_ID*)copy.p_palette.p_data)[0];
+            VOX__destroy__chunk(copy);
+        } else {
+            nodes[node].p_brick = VOX__open__brick_tree_brick(tree, copy, VOX__calculate__brick_occupancy(copy)) + 1;
+            nodes[node].p_block_ID = VOX__bit__air;
+        }
+    }
+
+    // merge back up while all 8 siblings are equal uniform leaves
+    for (u64 level = 1; level <= (*tree).p_depth; level++) {
+        node = nodes[path[level]].p_children;
+        mergeable = VOX__bt__true;
+        for (u64 i = 0; i < 8; i++) {
+            if (nodes[node + i].p_children != 0 || nodes[node + i].p_brick != 0 || nodes[node + i].p_block_ID != nodes[node].p_block_ID) {
+                mergeable = VOX__bt__false;
+
+                break;
+            }
+        }
+        if (mergeable == VOX__bt__false) {
+            break;
+        }
+
+        nodes[path[level]].p_block_ID = nodes[node].p_block_ID;
+        nodes[path[level]].p_children = 0;
+        nodes[node].p_children = (*tree).p_free_node_group;
+        (*tree).p_free_node_group = (u32)node;
+    }
+
+    return;
+}
+
+// returns the leaf holding the block & writes its level, or returns ~0 when the block is outside the tree
+u64 VOX__find__brick_tree_leaf(VOX__brick_tree* tree, s64 x, s64 y, s64 z, u64* level) {
+    VOX__brick_tree_node* nodes;
+    s64 local[3];
+    u64 output;
+
+    // setup local block coordinates
+    local[0] = x - ((s64)(*tree).p_origin.p_x * VOX__dt__chunk_side_length);
+    local[1] = y - ((s64)(*tree).p_origin.p_y * VOX__dt__chunk_side_length);
+    local[2] = z - ((s64)(*tree).p_origin.p_z * VOX__dt__chunk_side_length);
+    for (u64 axis = 0; axis < 3; axis++) {
+        if (local[axis] < 0 || local[axis] >= (s64)VOX__calculate__brick_tree_side_length(tree)) {
+            return ~(u64)0;
+        }
+    }
+
+    // descend (children at a level split blocks on bit level + 2, chunk sized nodes span 3 bits)
+    nodes = (VOX__brick_tree_node*)(*tree).p_nodes.p_data;
+    output = 0;
+    *level = (*tree).p_depth;
+    while (nodes[output].p_children != 0) {
+        (*level)--;
+        output = nodes[output].p_children + (((local[0] >> (*level + 3)) & 1) | (((local[1] >> (*level + 3)) & 1) << 1) | (((local[2] >> (*level + 3)) & 1) << 2));
+    }
+
+    return output;
+}
+
+// blocks outside the tree read as air
+VOX__block_ID VOX__read__block_ID_from_brick_tree(VOX__brick_tree* tree, s64 x, s64 y, s64 z) {
+    VOX__brick_tree_node node;
+    u64 level;
+    u64 index;
+
+    // find leaf
+    index = VOX__find__brick_tree_leaf(tree, x, y, z, &level);
+    if (index == ~(u64)0) {
+        return VOX__bit__air;
+    }
+    node = ((VOX__brick_tree_node*)(*tree).p_nodes.p_data)[index];
+
+    // uniform leaf
+    if (node.p_brick == 0) {
+        return node.p_block_ID;
+    }
+
+    // brick
+    return VOX__read__block_ID_from_chunk(((VOX__brick_tree_brick*)(*tree).p_bricks.p_data)[node.p_brick - 1].p_chunk, (u64)x & (VOX__dt__chunk_side_length - 1), (u64)y & (VOX__dt__chunk_side_length - 1), (u64)z & (VOX__dt__chunk_side_length - 1));
+}
+
+// side length (in blocks) of the largest tree aligned all air cube holding the block, writing its lowest corner, 0 when the block is solid
+// (outside the tree only the block itself is reported, so callers crossing the bounds keep stepping one block at a time)
+u64 VOX__calculate__brick_tree_empty_cube(VOX__brick_tree* tree, s64 x, s64 y, s64 z, s64* cube_corner) {
+    VOX__brick_tree_node node;
+    VOX__brick_tree_brick brick;
+    s64 position[3];
+    s64 origin[3];
+    u64 level;
+    u64 index;
+    u64 output;
+    u64 cell;
+
+    // setup positions
+    position[0] = x;
+    position[1] = y;
+    position[2] = z;
+    origin[0] = (s64)(*tree).p_origin.p_x * VOX__dt__chunk_side_length;
+    origin[1] = (s64)(*tree).p_origin.p_y * VOX__dt__chunk_side_length;
+    origin[2] = (s64)(*tree).p_origin.p_z * VOX__dt__chunk_side_length;
+
+    // find leaf
+    index = VOX__find__brick_tree_leaf(tree, x, y, z, &level);
+    if (index == ~(u64)0) {
+        output = 1;
+    } else {
+        node = ((VOX__brick_tree_node*)(*tree).p_nodes.p_data)[index];
+
+        if (node.p_brick == 0) {
+            // uniform leaf, the whole node is empty or solid
+            if (node.p_block_ID != VOX__bit__air) {
+                return 0;
+            }
+
+            output = (u64)VOX__dt__chunk_side_length << level;
+        } else {
+            // brick, the cell is empty or the single block is checked
+            brick = ((VOX__brick_tree_brick*)(*tree).p_bricks.p_data)[node.p_brick - 1];
+            cell = ((((u64)x & (VOX__dt__chunk_side_length - 1)) / VOX__dt__brick_cell_side_length) + ((((u64)y & (VOX__dt__chunk_side_length - 1)) / VOX__dt__brick_cell_side_length) * VOX__dt__brick_cells_per_side) + ((((u64)z & (VOX__dt__chunk_side_length - 1)) / VOX__dt__brick_cell_side_length) * VOX__dt__brick_cells_per_side * VOX__dt__brick_cells_per_side));
+
+            if ((brick.p_occupancy & ((u64)1 << cell)) == 0) {
+                output = VOX__dt__brick_cell_side_length;
+            } else if (VOX__read__block_ID_from_chunk(brick.p_chunk, (u64)x & (VOX__dt__chunk_side_length - 1), (u64)y & (VOX__dt__chunk_side_length - 1), (u64)z & (VOX__dt__chunk_side_length - 1)) == VOX__bit__air) {
+                output = 1;
+            } else {
+                return 0;
+            }
+        }
+    }
+
+    // align corner to the cube (node corners are relative to the tree origin)
+    for (u64 axis = 0; axis < 3; axis++) {
+        cube_corner[axis] = origin[axis] + ((position[axis] - origin[axis]) & ~((s64)output - 1));
+    }
+
+    return output;
+}
+
+VOX__bt VOX__check__brick_tree_node_box_has_solid_blocks(VOX__brick_tree* tree, u64 node, u64 level, s64* node_corner, s64* box_minimum, s64* box_maximum) {
+    VOX__brick_tree_node* nodes;
+    VOX__brick_tree_brick brick;
+    s64 side_length;
+    s64 child_corner[3];
+    s64 low[3];
+    s64 high[3];
+
+    // setup variables
+    nodes = (VOX__brick_tree_node*)(*tree).p_nodes.p_data;
+    side_length = (s64)VOX__dt__chunk_side_length << level;
+
+    // overlap of box & node
+    for (u64 axis = 0; axis < 3; axis++) {
+        low[axis] = (box_minimum[axis] > node_corner[axis]) ? box_minimum[axis] : node_corner[axis];
+        high[axis] = (box_maximum[axis] < node_corner[axis] + side_length - 1) ? box_maximum[axis] : node_corner[axis] + side_length - 1;
+        if (low[axis] > high[axis]) {
+            return VOX__bt__false;
+        }
+    }
+
+    // inner node, visit children
+    if (nodes[node].p_children != 0) {
+        for (u64 i = 0; i < 8; i++) {
+            child_corner[0] = node_corner[0] + ((i & 1) ? side_length / 2 : 0);
+            child_corner[1] = node_corner[1] + ((i & 2) ? side_length / 2 : 0);
+            child_corner[2] = node_corner[2] + ((i & 4) ? side_length / 2 : 0);
+            if (VOX__check__brick_tree_node_box_has_solid_blocks(tree, nodes[node].p_children + i, level - 1, child_corner, box_minimum, box_maximum) == VOX__bt__true) {
+                return VOX__bt__true;
+            }
+        }
+
+        return VOX__bt__false;
+    }
+
+    // uniform leaf
+    if (nodes[node].p_brick == 0) {
+        return nodes[node].p_block_ID != VOX__bit__air;
+    }
+
+    // brick, skipping empty cells
+    brick = ((VOX__brick_tree_brick*)(*tree).p_bricks.p_data)[nodes[node].p_brick - 1];
+    for (s64 z = low[2] - node_corner[2]; z <= high[2] - node_corner[2]; z++) {
+        for (s64 y = low[1] - node_corner[1]; y <= high[1] - node_corner[1]; y++) {
+            for (s64 x = low[0] - node_corner[0]; x <= high[0] - node_corner[0]; x++) {
+                if ((brick.p_occupancy & ((u64)1 << ((x / VOX__dt__brick_cell_side_length) + ((y / VOX__dt__brick_cell_side_length) * VOX__dt__brick_cells_per_side) + ((z / VOX__dt__brick_cell_side_length) * VOX__dt__brick_cells_per_side * VOX__dt__brick_cells_per_side)))) != 0 && VOX__read__block_ID_from_chunk(brick.p_chunk, x, y, z) != VOX__bit__air) {
+                    return VOX__bt__true;
+                }
+            }
+        }
+    }
+
+    return VOX__bt__false;
+}
+
+// box corners are inclusive block coordinates, whole air nodes are skipped without looking inside
+VOX__bt VOX__check__brick_tree_box_has_solid_blocks(VOX__brick_tree* tree, s64* box_minimum, s64* box_maximum) {
+    s64 root_corner[3];
+
+    // setup root corner
+    root_corner[0] = (s64)(*tree).p_origin.p_x * VOX__dt__chunk_side_length;
+    root_corner[1] = (s64)(*tree).p_origin.p_y * VOX__dt__chunk_side_length;
+    root_corner[2] = (s64)(*tree).p_origin.p_z * VOX__dt__chunk_side_length;
+
+    return VOX__check__brick_tree_node_box_has_solid_blocks(tree, 0, (*tree).p_depth, root_corner, box_minimum, box_maximum);
+}
+
+u64 VOX__calculate__brick_tree_memory_size(VOX__brick_tree* tree) {
+    u64 output;
+
+    // setup output
+    output = (*tree).p_nodes.p_length + (*tree).p_bricks.p_length + (*tree).p_free_bricks.p_length;
+
+    // add brick storage
+    for (u64 i = 0; i < (*tree).p_brick_count; i++) {
+        output += VOX__calculate__chunk_memory_size(((VOX__brick_tree_brick*)(*tree).p_bricks.p_data)[i].p_chunk);
+    }
+
+    return output;
+}
+
+// covers every chunk the world may hold around its current center (chunks still loading are left as air)
+VOX__brick_tree VOX__create__brick_tree__from_world(VOX__world* world) {
+    VOX__brick_tree output;
+    VOX__world_slot* slots;
+    s32 radius;
+    u64 depth;
+
+    // smallest cube holding the unload radius on every axis
+    radius = (((*world).p_load_radius > (*world).p_load_height_radius) ? (*world).p_load_radius : (*world).p_load_height_radius) + 1;
+    depth = 0;
+    while (((s64)1 << depth) < (2 * (s64)radius) + 1) {
+        depth++;
+    }
+
+    // setup output
+    output = VOX__create__brick_tree(VOX__create__chunk_position((*world).p_center.p_x - radius, (*world).p_center.p_y - radius, (*world).p_center.p_z - radius), depth);
+
+    // write chunks
+    slots = (VOX__world_slot*)(*world).p_slots.p_data;
+    for (u64 i = 0; i < (*world).p_slot_count; i++) {
+        if (slots[i].p_occupied == VOX__bt__true && slots[i].p_loading == VOX__bt__false) {
+            VOX__write__chunk_to_brick_tree(&output, slots[i].p_position, slots[i].p_chunk);
+        }
+    }
+
+    return output;
+}
+
+void VOX__destroy__brick_tree(VOX__brick_tree tree) {
+    // destroy bricks (released bricks hold null chunks)
+    for (u64 i = 0; i < tree.p_brick_count; i++) {
+        VOX__destroy__chunk(((VOX__brick_tree_brick*)tree.p_bricks.p_data)[i].p_chunk);
+    }
+
+    // destroy buffers
+    VOX__destroy__buffer(tree.p_nodes);
+    VOX__destroy__buffer(tree.p_bricks);
+    VOX__destroy__buffer(tree.p_free_bricks);
+
+    return;
+}
+
+/* Raycasting - Block By Block Grid Traversal (Amanatides & Woo) With Jumps Across Empty Cubes */
+typedef struct VOX__ray {
+    f64 p_origin[3];
+    f64 p_direction[3]; // normalised
+    f64 p_inverse_direction[3]; // 0 on axes the ray does not move along
+    s64 p_step[3]; // -1, 0 or 1 per axis
+    s64 p_block[3]; // block the ray is in
+    f64 p_next_boundary[3]; // distance at which the ray crosses into the next block on each axis
+    f64 p_distance; // distance at which the ray entered the current block
+    u64 p_entry_axis; // axis crossed to enter the current block, 3 for the starting block
+} VOX__ray;
+
+typedef struct VOX__ray_hit {
+    VOX__bt p_hit;
+    VOX__block_ID p_block_ID;
+    s64 p_block[3];
+    s32 p_normal[3]; // outward normal of the face the ray entered through, zero when the ray starts inside the block
+    VOX__bft p_block_face; // same face, only meaningful when the normal is not zero
+    f32 p_distance; // along the normalised direction to where the ray enters the block
+} VOX__ray_hit;
+
+f64 VOX__calculate__ray_boundary_distance(VOX__ray* ray, u64 axis) {
+    // never crosses
+    if ((*ray).p_step[axis] == 0) {
+        return INFINITY;
+    }
+
+    return ((f64)((*ray).p_block[axis] + ((*ray).p_step[axis] > 0)) - (*ray).p_origin[axis]) * (*ray).p_inverse_direction[axis];
+}
+
+// a zero direction never leaves its starting block
+VOX__ray VOX__create__ray(VOX__3D_position origin, VOX__3D_position direction) {
+    VOX__ray output;
+    f64 length;
+
+    // setup origin & direction
+    output.p_origin[0] = origin.p_x;
+    output.p_origin[1] = origin.p_y;
+    output.p_origin[2] = origin.p_z;
+    output.p_direction[0] = direction.p_x;
+    output.p_direction[1] = direction.p_y;
+    output.p_direction[2] = direction.p_z;
+    length = sqrt((output.p_direction[0] * output.p_direction[0]) + (output.p_direction[1] * output.p_direction[1]) + (output.p_direction[2] * output.p_direction[2]));
+
+    // setup traversal
+    for (u64 axis = 0; axis < 3; axis++) {
+        if (length > 0.0) {
+            output.p_direction[axis] /= length;
+        }
+        output.p_block[axis] = (s64)floor(output.p_origin[axis]);
+
+        if (output.p_direction[axis] > 0.0) {
+            output.p_step[axis] = 1;
+            output.p_inverse_direction[axis] = 1.0 / output.p_direction[axis];
+        } else if (output.p_direction[axis] < 0.0) {
+            output.p_step[axis] = -1;
+            output.p_inverse_direction[axis] = 1.0 / output.p_direction[axis];
+        } else {
+            output.p_step[axis] = 0;
+            output.p_inverse_direction[axis] = 0.0;
+        }
+    }
+    for (u64 axis = 0; axis < 3; axis++) {
+        output.p_next_boundary[axis] = VOX__calculate__ray_boundary_distance(&output, axis);
+    }
+    output.p_distance = (length > 0.0) ? 0.0 : INFINITY;
+    output.p_entry_axis = 3;
 
     return output;
 }
 
-void VOX__draw__bind__specific_game_textures_texture(VOX__game_textures game_textures, VOX__gtt game_textures_type) {
-    switch (game_textures_type) {
-    case VOX__gtt__block_faces:
-        glActiveTexture(game_textures.p_block_faces_texture_ID);
-        glBindTexture(game_textures.p_block_faces.p_texture_type, game_textures.p_block_faces_handle);
-        break;
+// moves into the next block along the nearest boundary (ties go to the lower axis)
+void VOX__step__ray(VOX__ray* ray) {
+    u64 axis;
+
+    // nearest boundary
+    axis = 0;
+    if ((*ray).p_next_boundary[1] < (*ray).p_next_boundary[axis]) {
+        axis = 1;
     }
+    if ((*ray).p_next_boundary[2] < (*ray).p_next_boundary[axis]) {
+        axis = 2;
+    }
+
+    // cross it
+    (*ray).p_distance = (*ray).p_next_boundary[axis];
+    (*ray).p_block[axis] += (*ray).p_step[axis];
+    (*ray).p_next_boundary[axis] = VOX__calculate__ray_boundary_distance(ray, axis);
+    (*ray).p_entry_axis = axis;
+
+    return;
 }
 
-void VOX__draw__unbind__specific_game_textures_texture(VOX__game_textures game_textures, VOX__gtt game_textures_type) {
-    switch (game_textures_type) {
-    case VOX__gtt__block_faces:
-        glBindTexture(game_textures.p_block_faces.p_texture_type, 0);
-        break;
+// jumps straight to the first block past the cube the ray is in (cube corner is its lowest block, side length in blocks)
+void VOX__skip__ray_past_cube(VOX__ray* ray, s64* cube_corner, u64 side_length) {
+    f64 exit_distance;
+    f64 boundary_distance;
+    u64 exit_axis;
+
+    // face the ray leaves through
+    exit_distance = INFINITY;
+    exit_axis = 0;
+    for (u64 axis = 0; axis < 3; axis++) {
+        if ((*ray).p_step[axis] != 0) {
+            boundary_distance = ((f64)(cube_corner[axis] + (((*ray).p_step[axis] > 0) ? (s64)side_length : 0)) - (*ray).p_origin[axis]) * (*ray).p_inverse_direction[axis];
+            if (boundary_distance < exit_distance) {
+                exit_distance = boundary_distance;
+                exit_axis = axis;
+            }
+        }
     }
-}
 
-void VOX__send__game_textures_to_opengl(VOX__game_textures game_textures) {
-    // send block textures
-    VOX__draw__bind__specific_game_textures_texture(game_textures, VOX__gtt__block_faces);
-    glTexParameteri(game_textures.p_block_faces.p_texture_type, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(game_textures.p_block_faces.p_texture_type, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(game_textures.p_block_faces.p_texture_type, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(game_textures.p_block_faces.p_texture_type, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexImage3D(game_textures.p_block_faces.p_texture_type, 0, GL_RGBA8, game_textures.p_block_faces.p_single_texture_width, game_textures.p_block_faces.p_single_texture_height, game_textures.p_block_faces.p_texture_count, 0, GL_RGBA, GL_UNSIGNED_BYTE, game_textures.p_block_faces.p_textures.p_data);
-    VOX__draw__unbind__specific_game_textures_texture(game_textures, VOX__gtt__block_faces);
+    // block past that face, the other axes are wherever the ray is at that distance (kept inside the cube)
+    for (u64 axis = 0; axis < 3; axis++) {
+        if (axis == exit_axis) {
+            (*ray).p_block[axis] = ((*ray).p_step[axis] > 0) ? cube_corner[axis] + (s64)side_length : cube_corner[axis] - 1;
+        } else if ((*ray).p_step[axis] != 0) {
+            (*ray).p_block[axis] = (s64)floor((*ray).p_origin[axis] + ((*ray).p_direction[axis] * exit_distance));
+            if ((*ray).p_block[axis] < cube_corner[axis]) {
+                (*ray).p_block[axis] = cube_corner[axis];
+            }
+            if ((*ray).p_block[axis] > cube_corner[axis] + (s64)side_length - 1) {
+                (*ray).p_block[axis] = cube_corner[axis] + (s64)side_length - 1;
+            }
+        }
+        (*ray).p_next_boundary[axis] = VOX__calculate__ray_boundary_distance(ray, axis);
+    }
+
+    // rounding can leave another axis short of a boundary the ray already crossed
+    for (u64 axis = 0; axis < 3; axis++) {
+        while (axis != exit_axis && (*ray).p_next_boundary[axis] < exit_distance) {
+            (*ray).p_block[axis] += (*ray).p_step[axis];
+            (*ray).p_next_boundary[axis] = VOX__calculate__ray_boundary_distance(ray, axis);
+        }
+    }
+    (*ray).p_distance = exit_distance;
+    (*ray).p_entry_axis = exit_axis;
 
     return;
 }
 
-void VOX__close__game_textures(VOX__game_textures game_textures) {
-    // destroy data on cpu
-    VOX__destroy__2D_texture_array(game_textures.p_block_faces);
+VOX__ray_hit VOX__create_null__ray_hit() {
+    VOX__ray_hit output;
 
-    // destroy data on gpu
-    glDeleteTextures(1, &(game_textures.p_block_faces_handle));
+    // setup output
+    output.p_hit = VOX__bt__false;
+    output.p_block_ID = VOX__bit__air;
+    output.p_distance = 0.0f;
+    output.p_block_face = VOX__bft__left;
+    for (u64 axis = 0; axis < 3; axis++) {
+        output.p_block[axis] = 0;
+        output.p_normal[axis] = 0;
+    }
 
-    return;
+    return output;
 }
 
-/* Blocks */
-typedef u16 VOX__block_ID;
+// hit on the block the ray is in
+VOX__ray_hit VOX__create__ray_hit(VOX__ray* ray, VOX__block_ID block_ID) {
+    VOX__ray_hit output;
 
-typedef struct VOX__block {
-    VOX__block_ID p_ID;
-} VOX__block;
+    // setup output
+    output = VOX__create_null__ray_hit();
+    output.p_hit = VOX__bt__true;
+    output.p_block_ID = block_ID;
+    output.p_distance = (f32)(*ray).p_distance;
+    for (u64 axis = 0; axis < 3; axis++) {
+        output.p_block[axis] = (*ray).p_block[axis];
+    }
 
-typedef struct VOX__block_dictionary_entry {
-    GLenum p_top_texture_ID;
-    GLenum p_bottom_texture_ID;
-    GLenum p_left_texture_ID;
-    GLenum p_right_texture_ID;
-    GLenum p_front_texture_ID;
-    GLenum p_back_texture_ID;
-} VOX__block_dictionary_entry;
+    // entered face (faces go negative then positive per axis)
+    if ((*ray).p_entry_axis < 3) {
+        output.p_normal[(*ray).p_entry_axis] = (s32)-(*ray).p_step[(*ray).p_entry_axis];
+        output.p_block_face = (VOX__bft)(((*ray).p_entry_axis * 2) + ((*ray).p_step[(*ray).p_entry_axis] < 0));
+    }
 
-typedef struct VOX__block_dictionary {
-    VOX__buffer p_dictionary;
-    u64 p_entry_count;
-} VOX__block_dictionary;
+    return output;
+}
 
-/* Chunks */
-typedef struct VOX__chunk {
-    VOX__buffer p_blocks;
-} VOX__chunk;
+// any block but air stops the ray, chunks that are not loaded (or still loading) count as air
+// one hash lookup per chunk entered, missing & all air chunks are crossed in a single jump
+VOX__ray_hit VOX__cast__ray_through_world(VOX__world* world, VOX__3D_position origin, VOX__3D_position direction, f32 maximum_distance) {
+    VOX__ray ray;
+    VOX__chunk_position chunk_position;
+    VOX__chunk_position cached_position;
+    VOX__world_slot* slot;
+    VOX__block_ID block_ID;
+    s64 chunk_corner[3];
+    VOX__bt cached;
+
+    // setup ray
+    ray = VOX__create__ray(origin, direction);
+    slot = 0;
+    cached = VOX__bt__false;
+    cached_position = VOX__create__chunk_position(0, 0, 0);
+
+    // walk blocks
+    while (ray.p_distance <= maximum_distance) {
+        // find chunk when crossing into a new one
+        chunk_position = VOX__create__chunk_position(VOX__calculate__floor_division((s32)ray.p_block[0], VOX__dt__chunk_side_length), VOX__calculate__floor_division((s32)ray.p_block[1], VOX__dt__chunk_side_length), VOX__calculate__floor_division((s32)ray.p_block[2], VOX__dt__chunk_side_length));
+        if (cached == VOX__bt__false || VOX__check__chunk_positions_are_equal(chunk_position, cached_position) == VOX__bt__false) {
+            slot = VOX__find__world_slot(world, chunk_position);
+            if (slot != 0 && (*slot).p_loading == VOX__bt__true) {
+                slot = 0;
+            }
+            cached_position = chunk_position;
+            cached = VOX__bt__true;
+        }
 
-/* Camera */
-typedef struct VOX__camera {
-    f32 p_yaw;
-    f32 p_pitch;
-    vec3 p_position;
-    versor p_angle;
-    mat4 p_matrix_identity;
-    mat4 p_model;
-    mat4 p_view;
-    mat4 p_projection;
-    mat4 p_change;
-} VOX__camera;
+        // skip empty chunks
+        if (slot == 0 || ((*slot).p_chunk.p_bits_per_block == 0 && ((VOX__block_ID*)(*slot).p_chunk.p_palette.p_data)[0] == VOX__bit__air)) {
+            chunk_corner[0] = (s64)chunk_position.p_x * VOX__dt__chunk_side_length;
+            chunk_corner[1] = (s64)chunk_position.p_y * VOX__dt__chunk_side_length;
+            chunk_corner[2] = (s64)chunk_position.p_z * VOX__dt__chunk_side_length;
+            VOX__skip__ray_past_cube(&ray, chunk_corner, VOX__dt__chunk_side_length);
 
-VOX__camera VOX__create__camera() {
-    VOX__camera output;
+            continue;
+        }
 
-    // camera starting position
-    output.p_yaw = 0.0f;
-    output.p_pitch = 0.0f;
-    glm_vec3_zero(output.p_position);
-    glm_quat_identity(output.p_angle);
-    glm_mat4_identity(output.p_matrix_identity);
-    glm_mat4_identity(output.p_model);
-    glm_mat4_identity(output.p_view);
-    glm_mat4_identity(output.p_projection);
-    glm_mat4_identity(output.p_change);
+        // check block
+        block_ID = VOX__read__block_ID_from_chunk((*slot).p_chunk, (u64)ray.p_block[0] & (VOX__dt__chunk_side_length - 1), (u64)ray.p_block[1] & (VOX__dt__chunk_side_length - 1), (u64)ray.p_block[2] & (VOX__dt__chunk_side_length - 1));
+        if (block_ID != VOX__bit__air) {
+            return VOX__create__ray_hit(&ray, block_ID);
+        }
 
-    return output;
+        VOX__step__ray(&ray);
+    }
+
+    return VOX__create_null__ray_hit();
 }
 
-VOX__camera VOX__move__camera(VOX__camera camera, VOX__3D_position camera_position_change, VOX__3D_position camera_rotation_change) {
-    vec3 direction;
-    vec3 front;
+// the direction VOX__move__camera derives from yaw & pitch
+VOX__3D_position VOX__calculate__camera_direction(VOX__camera camera) {
+    return VOX__create__3D_position(cosf(glm_rad(camera.p_yaw)) * cosf(glm_rad(camera.p_pitch)), sinf(glm_rad(camera.p_pitch)), sinf(glm_rad(camera.p_yaw)) * cosf(glm_rad(camera.p_pitch)));
+}
 
-    // adjust camera data
-    camera.p_position[0] += camera_position_change.p_x;
-    camera.p_position[1] += camera_position_change.p_y;
-    camera.p_position[2] += camera_position_change.p_z;
-    camera.p_yaw = camera_rotation_change.p_x;
-    camera.p_pitch = camera_rotation_change.p_y;
+// the block the camera is looking at
+VOX__ray_hit VOX__cast__ray_from_camera(VOX__world* world, VOX__camera camera, f32 maximum_distance) {
+    return VOX__cast__ray_through_world(world, VOX__create__3D_position(camera.p_position[0], camera.p_position[1], camera.p_position[2]), VOX__calculate__camera_direction(camera), maximum_distance);
+}
 
-    // calculate direction
-    direction[0] = cosf(glm_rad(camera.p_yaw)) * cosf(glm_rad(camera.p_pitch));
-    direction[1] = sinf(glm_rad(camera.p_pitch));
-    direction[2] = sinf(glm_rad(camera.p_yaw)) * cosf(glm_rad(camera.p_pitch));
+// true once the ray is outside the box & moving away from it on some axis (box corners are inclusive block coordinates)
+VOX__bt VOX__check__ray_is_leaving_box(VOX__ray* ray, s64* box_minimum, s64* box_maximum) {
+    for (u64 axis = 0; axis < 3; axis++) {
+        if (((*ray).p_block[axis] < box_minimum[axis] && (*ray).p_step[axis] <= 0) || ((*ray).p_block[axis] > box_maximum[axis] && (*ray).p_step[axis] >= 0)) {
+            return VOX__bt__true;
+        }
+    }
 
-    // normalize direction
-    glm_vec3_norm(direction);
+    return VOX__bt__false;
+}
 
-    // calculate camera matrices
-    if (camera_rotation_change.p_x != 0) {
-        glm_quatv(camera.p_angle, glm_rad(camera.p_yaw), (vec3){ 1.0f, 0.0f, 0.0f });
-        glm_quat_rotate(camera.p_model, camera.p_angle, camera.p_model);
+// rays are independent, so a batch can be split across threads sharing one tree
+// every step jumps the largest empty cube the tree knows of, rays stop once they leave the tree (blocks outside it count as air)
+void VOX__cast__rays_through_brick_tree(VOX__brick_tree* tree, VOX__3D_position* origins, VOX__3D_position* directions, u64 ray_count, f32 maximum_distance, VOX__ray_hit* hits) {
+    VOX__ray ray;
+    s64 box_minimum[3];
+    s64 box_maximum[3];
+    s64 cube_corner[3];
+    u64 cube_side_length;
+
+    // setup tree bounds
+    box_minimum[0] = (s64)(*tree).p_origin.p_x * VOX__dt__chunk_side_length;
+    box_minimum[1] = (s64)(*tree).p_origin.p_y * VOX__dt__chunk_side_length;
+    box_minimum[2] = (s64)(*tree).p_origin.p_z * VOX__dt__chunk_side_length;
+    for (u64 axis = 0; axis < 3; axis++) {
+        box_maximum[axis] = box_minimum[axis] + (s64)VOX__calculate__brick_tree_side_length(tree) - 1;
     }
-    if (camera_rotation_change.p_y != 0) {
-        glm_quatv(camera.p_angle, glm_rad(camera.p_pitch), (vec3){ 0.0f, 1.0f, 0.0f });
-        glm_quat_rotate(camera.p_model, camera.p_angle, camera.p_model);
+
+    // cast each ray
+    for (u64 i = 0; i < ray_count; i++) {
+        ray = VOX__create__ray(origins[i], directions[i]);
+        hits[i] = VOX__create_null__ray_hit();
+
+        while (ray.p_distance <= maximum_distance && VOX__check__ray_is_leaving_box(&ray, box_minimum, box_maximum) == VOX__bt__false) {
+            cube_side_length = VOX__calculate__brick_tree_empty_cube(tree, ray.p_block[0], ray.p_block[1], ray.p_block[2], cube_corner);
+
+            if (cube_side_length == 0) {
+                hits[i] = VOX__create__ray_hit(&ray, VOX__read__block_ID_from_brick_tree(tree, ray.p_block[0], ray.p_block[1], ray.p_block[2]));
+
+                break;
+            } else if (cube_side_length == 1) {
+                VOX__step__ray(&ray);
+            } else {
+                VOX__skip__ray_past_cube(&ray, cube_corner, cube_side_length);
+            }
+        }
     }
-    glm_vec3_add(camera.p_position, (vec3){ 0.0f, 0.0f, -1.0f }, front);
-    glm_lookat(camera.p_position, front, (vec3){ 0.0f, 1.0f, 0.0f }, camera.p_view);
-    glm_perspective(glm_rad(45.0f), 720.0 / 480.0, 0.1f, 100.0f, camera.p_projection);
-    
-    // prepare matrices for gpu
-    glm_mat4_mul(camera.p_projection, camera.p_view, camera.p_change);
-    glm_mat4_mul(camera.p_change, camera.p_model, camera.p_change);
 
-    // return changed camera
-    return camera;
+    return;
 }
 
 /* Testing - Functions Testing Code */
@@ -1215,6 +9707,46 @@ VOX__object_data VOX__create__test__object_data_from_object_datum(VOX__object_da
     return output;
 }
 
+VOX__block_dictionary VOX__create__test__block_dictionary__1() {
+    VOX__block_dictionary output;
+
+    // setup output
+    output = VOX__create__block_dictionary(7);
+
+    // write entries
+    VOX__write__entry_to_block_dictionary(output, VOX__bit__air, VOX__create__block_dictionary_entry(0, 0, 0, 0, 0, 0));
+    VOX__write__entry_to_block_dictionary(output, VOX__bit__grass, VOX__create__block_dictionary_entry(1, 2, 5, 5, 5, 5));
+    VOX__write__entry_to_block_dictionary(output, VOX__bit__stone, VOX__create__block_dictionary_entry(3, 3, 3, 3, 3, 3));
+    VOX__write__entry_to_block_dictionary(output, VOX__bit__water, VOX__create__block_dictionary_entry(0, 0, 0, 0, 0, 0));
+    VOX__write__entry_to_block_dictionary(output, VOX__bit__sand, VOX__create__block_dictionary_entry(5, 5, 5, 5, 5, 5));
+    VOX__write__entry_to_block_dictionary(output, VOX__bit__snow, VOX__create__block_dictionary_entry(4, 4, 4, 4, 4, 4));
+    VOX__write__entry_to_block_dictionary(output, VOX__bit__lamp, VOX__create__block_dictionary_entry(5, 5, 5, 5, 5, 5));
+
+    return output;
+}
+
+VOX__chunk VOX__create__test__chunk__1() {
+    VOX__chunk output;
+    u64 height;
+
+    // setup output
+    output = VOX__create__chunk(VOX__bit__air);
+
+    // fill stone with a stepped grass surface
+    for (u64 z = 0; z < VOX__dt__chunk_side_length; z++) {
+        for (u64 x = 0; x < VOX__dt__chunk_side_length; x++) {
+            height = 3 + ((x / 3) + (z / 3)) % 3;
+
+            for (u64 y = 0; y < height; y++) {
+                VOX__write__block_ID_to_chunk(&output, x, y, z, 2);
+            }
+            VOX__write__block_ID_to_chunk(&output, x, height, z, 1);
+        }
+    }
+
+    return output;
+}
+
 VOX__game_textures VOX__create__test__game_textures__1() {
     VOX__2D_texture_array block_faces;
     // blue
@@ -1272,7 +9804,7 @@ VOX__game_textures VOX__create__test__game_textures__1() {
     return VOX__open__game_textures(block_faces);
 }
 
-VOX__shaders_program VOX__create__test__shaders_program__1(VOX__error* error) {
+VOX__shaders_program VOX__create__test__shaders_program__1(VOX__error* error, VOX__shader_cache* shader_cache) {
     VOX__shaders_program output;
     VOX__buffer vertex_shader;
     VOX__buffer fragment_shader;
@@ -1282,7 +9814,7 @@ VOX__shaders_program VOX__create__test__shaders_program__1(VOX__error* error) {
     fragment_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nin vec2 pass_texture_coordinates;\nflat in uint pass_texture_number;\nuniform usampler2DArray u_sampler_2D_array;\nout vec4 pass_fragment_color;\nvoid main() {\n\tpass_fragment_color = texture(u_sampler_2D_array, vec3(pass_texture_coordinates, float(pass_texture_number)));\n}");
 
     // compile shaders
-    output = VOX__compile__shaders_program(error, vertex_shader, fragment_shader);
+    output = VOX__compile__shaders_program(error, shader_cache, vertex_shader, fragment_shader);
 
     // destroy code
     VOX__destroy__buffer(vertex_shader);
@@ -1291,19 +9823,35 @@ VOX__shaders_program VOX__create__test__shaders_program__1(VOX__error* error) {
     return output;
 }
 
-VOX__shaders_program VOX__create__test__shaders_program__playground(VOX__error* error) {
+void VOX__create__test__shaders_code__playground(VOX__buffer* vertex_shader, VOX__buffer* fragment_shader) {
+    // create code
+    //vertex_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nlayout (location = 0) in vec3 l_position_attribute;\nlayout (location = 1) in vec2 l_texture_position_attribute;\nlayout (location = 2) in uint l_texture_number_attribute;\nuniform mat4 u_projection;\nuniform mat4 u_view;\nuniform mat4 u_model;\nout vec2 pass_texture_coordinates;\nflat out uint pass_texture_number;\nvoid main() {\n\tpass_texture_coordinates = l_texture_position_attribute;\n\tpass_texture_number = l_texture_number_attribute;\n\tgl_Position = u_projection * u_view * u_model * vec4(l_position_attribute, 1.0f);\n}");
+    //fragment_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nin vec2 pass_texture_coordinates;\nflat in uint pass_texture_number;\nuniform usampler2DArray u_sampler_2D_array;\nout vec4 pass_fragment_color;\nvoid main() {\n\tpass_fragment_color = texture(u_sampler_2D_array, vec3(pass_texture_coordinates, float(pass_texture_number)));\n}");
+    // (lighting is baked into the vertices, the vertex shader turns light levels & ambient occlusion into one brightness the fragments interpolate)
+    *vertex_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nlayout (location = 0) in vec3 l_position_attribute;\nlayout (location = 1) in vec2 l_texture_position_attribute;\nlayout (location = 2) in float l_texture_number_attribute;\nlayout (location = 4) in uint l_lighting_attribute;\nlayout (std140) uniform VOX_frame {\n\tmat4 u_camera;\n\tvec4 u_camera_position;\n\tvec4 u_time;\n};\nout vec3 pass_texture_coordinates;\nout float pass_brightness;\nvoid main() {\n\tfloat light = float(max((l_lighting_attribute >> 4u) & 15u, l_lighting_attribute & 15u));\n\tpass_texture_coordinates = vec3(l_texture_position_attribute, l_texture_number_attribute);\n\tpass_brightness = pow(0.8f, 15.0f - light) * (0.4f + (0.2f * float((l_lighting_attribute >> 8u) & 3u)));\n\tgl_Position = u_camera * vec4(l_position_attribute, 1.0f);\n}");
+    *fragment_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nin vec3 pass_texture_coordinates;\nin float pass_brightness;\nuniform usampler2DArray u_sampler_2D_array;\nout vec4 pass_fragment_color;\nvoid main() {\n\tpass_fragment_color = texture(u_sampler_2D_array, pass_texture_coordinates);\n\tpass_fragment_color.rgb *= pass_brightness;\n}");
+
+    return;
+}
+
+void VOX__create__test__shaders_code__packed(VOX__buffer* vertex_shader, VOX__buffer* fragment_shader) {
+    // create code (decodes VOX__packed_vbo_vertex, chunk local positions are offset by the per draw attribute)
+    *vertex_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nlayout (location = 0) in uint l_packed_position_attribute;\nlayout (location = 1) in uint l_packed_texture_attribute;\nlayout (location = 3) in vec3 l_chunk_offset_attribute;\nlayout (std140) uniform VOX_frame {\n\tmat4 u_camera;\n\tvec4 u_camera_position;\n\tvec4 u_time;\n};\nout vec3 pass_texture_coordinates;\nout float pass_brightness;\nvoid main() {\n\tvec3 position = vec3(float(l_packed_position_attribute & 255u), float((l_packed_position_attribute >> 8u) & 255u), float((l_packed_position_attribute >> 16u) & 255u));\n\tfloat light = float(max(l_packed_texture_attribute >> 28u, (l_packed_texture_attribute >> 24u) & 15u));\n\tpass_texture_coordinates = vec3(float(l_packed_texture_attribute & 255u), float((l_packed_texture_attribute >> 8u) & 255u), float((l_packed_texture_attribute >> 16u) & 255u));\n\tpass_brightness = pow(0.8f, 15.0f - light) * (0.4f + (0.2f * float((l_packed_position_attribute >> 27u) & 3u)));\n\tgl_Position = u_camera * vec4(position + l_chunk_offset_attribute, 1.0f);\n}");
+    *fragment_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nin vec3 pass_texture_coordinates;\nin float pass_brightness;\nuniform usampler2DArray u_sampler_2D_array;\nout vec4 pass_fragment_color;\nvoid main() {\n\tpass_fragment_color = texture(u_sampler_2D_array, pass_texture_coordinates);\n\tpass_fragment_color.rgb *= pass_brightness;\n}");
+
+    return;
+}
+
+VOX__shaders_program VOX__create__test__shaders_program__playground(VOX__error* error, VOX__shader_cache* shader_cache) {
     VOX__shaders_program output;
     VOX__buffer vertex_shader;
     VOX__buffer fragment_shader;
 
     // create code
-    //vertex_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nlayout (location = 0) in vec3 l_position_attribute;\nlayout (location = 1) in vec2 l_texture_position_attribute;\nlayout (location = 2) in uint l_texture_number_attribute;\nuniform mat4 u_projection;\nuniform mat4 u_view;\nuniform mat4 u_model;\nout vec2 pass_texture_coordinates;\nflat out uint pass_texture_number;\nvoid main() {\n\tpass_texture_coordinates = l_texture_position_attribute;\n\tpass_texture_number = l_texture_number_attribute;\n\tgl_Position = u_projection * u_view * u_model * vec4(l_position_attribute, 1.0f);\n}");
-    //fragment_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nin vec2 pass_texture_coordinates;\nflat in uint pass_texture_number;\nuniform usampler2DArray u_sampler_2D_array;\nout vec4 pass_fragment_color;\nvoid main() {\n\tpass_fragment_color = texture(u_sampler_2D_array, vec3(pass_texture_coordinates, float(pass_texture_number)));\n}");
-    vertex_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nlayout (location = 0) in vec3 l_position_attribute;\nlayout (location = 1) in vec2 l_texture_position_attribute;\nlayout (location = 2) in float l_texture_number_attribute;\nuniform mat4 u_camera;\nout vec3 pass_texture_coordinates;\nvoid main() {\n\tpass_texture_coordinates = vec3(l_texture_position_attribute, l_texture_number_attribute);\n\tgl_Position = u_camera * vec4(l_position_attribute, 1.0f);\n}");
-    fragment_shader = VOX__create__buffer_copy_from_c_string("#version 330 core\nin vec3 pass_texture_coordinates;\nuniform usampler2DArray u_sampler_2D_array;\nout vec4 pass_fragment_color;\nvoid main() {\n\tpass_fragment_color = texture(u_sampler_2D_array, pass_texture_coordinates);\n}");
-    
+    VOX__create__test__shaders_code__playground(&vertex_shader, &fragment_shader);
+
     // compile shaders
-    output = VOX__compile__shaders_program(error, vertex_shader, fragment_shader);
+    output = VOX__compile__shaders_program(error, shader_cache, vertex_shader, fragment_shader);
 
     // destroy code
     VOX__destroy__buffer(vertex_shader);
@@ -1312,6 +9860,45 @@ VOX__shaders_program VOX__create__test__shaders_program__playground(VOX__error*
     return output;
 }
 
+VOX__shaders_program VOX__create__test__shaders_program__packed(VOX__error* error, VOX__shader_cache* shader_cache) {
+    VOX__shaders_program output;
+    VOX__buffer vertex_shader;
+    VOX__buffer fragment_shader;
+
+    // create code
+    VOX__create__test__shaders_code__packed(&vertex_shader, &fragment_shader);
+
+    // compile shaders
+    output = VOX__compile__shaders_program(error, shader_cache, vertex_shader, fragment_shader);
+
+    // destroy code
+    VOX__destroy__buffer(vertex_shader);
+    VOX__destroy__buffer(fragment_shader);
+
+    return output;
+}
+
+// builds the program for each vertex format in one batch (shaders_programs is indexed by VOX__vft)
+void VOX__create__test__shaders_programs__per_vertex_format(VOX__error* error, VOX__shader_cache* shader_cache, VOX__shaders_program shaders_programs[2]) {
+    VOX__buffer vertex_shaders[2];
+    VOX__buffer fragment_shaders[2];
+
+    // create code
+    VOX__create__test__shaders_code__playground(&vertex_shaders[VOX__vft__float], &fragment_shaders[VOX__vft__float]);
+    VOX__create__test__shaders_code__packed(&vertex_shaders[VOX__vft__packed], &fragment_shaders[VOX__vft__packed]);
+
+    // compile shaders side by side
+    VOX__compile__shaders_programs(error, shader_cache, vertex_shaders, fragment_shaders, shaders_programs, 2);
+
+    // destroy code
+    for (u64 i = 0; i < 2; i++) {
+        VOX__destroy__buffer(vertex_shaders[i]);
+        VOX__destroy__buffer(fragment_shaders[i]);
+    }
+
+    return;
+}
+
 /* Events - User Input */
 typedef struct VOX__user_input {
     f32 p_mouse_x_change;
@@ -1321,6 +9908,8 @@ typedef struct VOX__user_input {
     VOX__bt p_a;
     VOX__bt p_s;
     VOX__bt p_d;
+    VOX__bt p_dig; // left click this frame
+    VOX__bt p_place; // right click this frame
 } VOX__user_input;
 
 VOX__user_input VOX__create_null__user_input() {
@@ -1336,11 +9925,14 @@ VOX__user_input VOX__create_null__user_input() {
     output.p_a = VOX__bt__false;
     output.p_s = VOX__bt__false;
     output.p_d = VOX__bt__false;
+    output.p_dig = VOX__bt__false;
+    output.p_place = VOX__bt__false;
 
     return output;
 }
 
-VOX__user_input VOX__create__user_input__from_sdl2_events() {
+// held keys carry over from previous_user_input (ticks can run on frames without key events), clicks & mouse movement are only for this frame
+VOX__user_input VOX__create__user_input__from_sdl2_events(VOX__user_input previous_user_input) {
     VOX__user_input output;
     SDL_Event e;
     SDL_Event* e_pointer;
@@ -1349,6 +9941,10 @@ VOX__user_input VOX__create__user_input__from_sdl2_events() {
 
     // setup variables
     output = VOX__create_null__user_input();
+    output.p_w = previous_user_input.p_w;
+    output.p_a = previous_user_input.p_a;
+    output.p_s = previous_user_input.p_s;
+    output.p_d = previous_user_input.p_d;
     e_pointer = &e;
 
     // get mouse position
@@ -1386,6 +9982,13 @@ VOX__user_input VOX__create__user_input__from_sdl2_events() {
             if (e.key.keysym.sym == SDLK_d) {
                 output.p_d = VOX__bt__false;
             }
+        } else if (e.type == SDL_MOUSEBUTTONDOWN) {
+            if (e.button.button == SDL_BUTTON_LEFT) {
+                output.p_dig = VOX__bt__true;
+            }
+            if (e.button.button == SDL_BUTTON_RIGHT) {
+                output.p_place = VOX__bt__true;
+            }
         }
     }
 
@@ -1419,17 +10022,104 @@ VOX__3D_position VOX__calculate__player_camera_rotation_movement(VOX__user_input
     return VOX__create__3D_position((user_input.p_mouse_x_change) * speed, (user_input.p_mouse_y_change) * speed, 0.0f);
 }
 
+/* Simulation - Player State Stepped At A Fixed Rate & Blended Between The Last Two Ticks For Drawing */
+typedef struct VOX__simulation {
+    VOX__3D_position p_previous_position; // at the tick before the latest
+    VOX__3D_position p_position; // at the latest tick
+    f32 p_tick_seconds;
+    u64 p_tick_count;
+} VOX__simulation;
+
+VOX__simulation VOX__create__simulation(VOX__3D_position position, u64 ticks_per_second) {
+    VOX__simulation output;
+
+    // setup output
+    output.p_previous_position = position;
+    output.p_position = position;
+    output.p_tick_seconds = 1.0f / (f32)ticks_per_second;
+    output.p_tick_count = 0;
+
+    return output;
+}
+
+// mouse look is not ticked, it is applied once per drawn frame so turning never waits on the tick rate
+void VOX__tick__simulation(VOX__simulation* simulation, VOX__user_input user_input) {
+    VOX__3D_position movement;
+
+    // step player
+    movement = VOX__calculate__player_position_movement(user_input, (f32)VOX__dt__player_blocks_per_second * (*simulation).p_tick_seconds);
+    (*simulation).p_previous_position = (*simulation).p_position;
+    (*simulation).p_position.p_x += movement.p_x;
+    (*simulation).p_position.p_y += movement.p_y;
+    (*simulation).p_position.p_z += movement.p_z;
+    (*simulation).p_tick_count++;
+
+    return;
+}
+
+// alpha is VOX__calculate__loop_scheduler_alpha, drawing runs up to one tick behind the simulation
+VOX__3D_position VOX__calculate__simulation_position(VOX__simulation* simulation, f32 alpha) {
+    VOX__3D_position from;
+    VOX__3D_position to;
+
+    from = (*simulation).p_previous_position;
+    to = (*simulation).p_position;
+
+    return VOX__create__3D_position(from.p_x + ((to.p_x - from.p_x) * alpha), from.p_y + ((to.p_y - from.p_y) * alpha), from.p_z + ((to.p_z - from.p_z) * alpha));
+}
+
+// simulated time at the drawn moment, for effects that should freeze & catch up with the simulation rather than the wall clock
+f64 VOX__calculate__simulation_seconds(VOX__simulation* simulation, f32 alpha) {
+    if ((*simulation).p_tick_count == 0) {
+        return 0.0;
+    }
+
+    return ((f64)((*simulation).p_tick_count - 1) + (f64)alpha) * (f64)(*simulation).p_tick_seconds;
+}
+
+// places the camera at the drawn position & turns it by this frame's mouse movement
+VOX__camera VOX__move__camera__to_simulation(VOX__camera camera, VOX__simulation* simulation, f32 alpha, VOX__3D_position camera_rotation_change) {
+    VOX__3D_position position;
+
+    // place
+    position = VOX__calculate__simulation_position(simulation, alpha);
+    camera.p_position[0] = position.p_x;
+    camera.p_position[1] = position.p_y;
+    camera.p_position[2] = position.p_z;
+
+    return VOX__move__camera(camera, VOX__create__3D_position(0.0f, 0.0f, 0.0f), camera_rotation_change);
+}
+
 /* Game Loop - Run Actual Game */
 void VOX__play(VOX__error* error) {
     VOX__window_configuration configuration;
     VOX__graphics graphics;
     VOX__buffer title;
     VOX__user_input user_input;
-    VOX__shaders_program shaders_program;
+    VOX__shader_cache shader_cache;
+    VOX__shaders_program shaders_programs[2];
+    VOX__vft vertex_format;
     VOX__game_textures game_textures;
     VOX__camera camera;
-    VOX__drawable_object pattern;
-    f32 affect;
+    VOX__block_dictionary block_dictionary;
+    VOX__gpu_arena gpu_arena;
+    VOX__world world;
+    VOX__job_system* job_system;
+    VOX__chunk_io* chunk_io;
+    VOX__frustum frustum;
+    VOX__frame_uniform_buffer frame_uniform_buffer;
+    VOX__ray_hit ray_hit;
+    VOX__loop_scheduler loop_scheduler;
+    VOX__simulation simulation;
+    VOX__vmt vsync_mode;
+    u64 ticks_per_second;
+    u64 tick_count;
+    f32 alpha;
+    VOX__profiler profiler;
+    VOX__allocator frame_allocator;
+    VOX__error trace_error;
+    char* trace_path;
+    char trace_file_path[1024];
 
     // setup title
     title = VOX__create__buffer_copy_from_c_string("Voxelize!");
@@ -1440,62 +10130,125 @@ void VOX__play(VOX__error* error) {
     // open window
     graphics = VOX__open__graphics__new_window(error, configuration);
 
-    // setup opengl shaders
-    shaders_program = VOX__create__test__shaders_program__playground(error);
+    // setup vsync (VOXELIZE_VSYNC is off, on or adaptive)
+    vsync_mode = VOX__set__vsync_mode(VOX__read__vsync_mode_from_name(getenv("VOXELIZE_VSYNC"), VOX__vmt__adaptive));
+
+    // setup opengl shaders (VOXELIZE_SHADER_CACHE names a directory to keep linked programs in between runs)
+    shader_cache = VOX__open__shader_cache(getenv("VOXELIZE_SHADER_CACHE"));
+    VOX__create__test__shaders_programs__per_vertex_format(error, &shader_cache, shaders_programs);
     if (VOX__check__error__has_error_occured(error) == VOX__bt__true) {
         goto VOX__label__quit_game__shader_failure;
     }
 
-    // user shaders
-    VOX__use__use_shaders(shaders_program);
+    // user shaders (VOXELIZE_VERTEX_FORMAT set to packed draws compact chunk local vertices)
+    vertex_format = VOX__vft__float;
+    if (getenv("VOXELIZE_VERTEX_FORMAT") != 0 && VOX__check__c_strings_are_equal(getenv("VOXELIZE_VERTEX_FORMAT"), "packed") == VOX__bt__true) {
+        vertex_format = VOX__vft__packed;
+    }
+    VOX__use__use_shaders(shaders_programs[vertex_format]);
 
     // setup textures
     game_textures = VOX__create__test__game_textures__1();
 
-    // setup camera
+    // setup camera & the frame data every program reads
     camera = VOX__create__camera();
-    affect = 0.0f;
+    frame_uniform_buffer = VOX__open__frame_uniform_buffer();
+
+    // setup allocators (frame scratch is given back at the start of every frame)
+    VOX__open__global_allocators();
+    frame_allocator = VOX__open__allocator__arena(1 << 20);
 
-    // create data
-    pattern = VOX__open__drawable_object__object_data(VOX__create__test__object_data__6_squares(1.0f, 0.0f, 0.0f, 0.0f));
+    // create world
+    block_dictionary = VOX__create__test__block_dictionary__1();
+    gpu_arena = VOX__open__gpu_arena(1 << 20, 3 << 19, vertex_format, 4 << 20);
+    chunk_io = VOX__open__chunk_io(getenv("VOXELIZE_WORLD"), 0); // names the region directory, unset keeps the world in memory
+    world = VOX__create__world(8, 2, 2, 8, 0, chunk_io); // full detail two chunks out, then 2x, 4x & 8x cells
+    job_system = VOX__open__job_system(0);
+
+    // setup profiler
+    profiler = VOX__open__profiler(VOX__bt__true);
 
     // send data to gpu
     VOX__send__game_textures_to_opengl(game_textures);
-    VOX__send__drawable_object_to_opengl(pattern);
 
     // setup opengl drawing constants
     glEnable(GL_DEPTH_TEST);
     glClearColor(0.5f, 0.5f, 0.5f, 1.0f);
 
+    // setup simulation (VOXELIZE_TICK_RATE sets ticks a second, VOXELIZE_FRAME_CAP limits frames a second on top of vsync, 0 is uncapped)
+    ticks_per_second = VOX__clamp__ticks_per_second(VOX__read__environment_u64("VOXELIZE_TICK_RATE", VOX__dt__simulation_ticks_per_second));
+    simulation = VOX__create__simulation(VOX__create__3D_position(0.0f, 0.0f, 0.0f), ticks_per_second);
+    user_input = VOX__create_null__user_input();
+    loop_scheduler = VOX__create__loop_scheduler(ticks_per_second, VOX__read__environment_u64("VOXELIZE_FRAME_CAP", 0), VOX__dt__simulation_maximum_ticks_per_frame);
+
     // run window
     while (VOX__bt__true) {
+        VOX__start__profiler_frame(&profiler);
+        VOX__reset__allocator(&frame_allocator);
+
         // get keyboard input
-        user_input = VOX__create__user_input__from_sdl2_events();
+        VOX__start__profiler_scope(&profiler, VOX__pst__input);
+        user_input = VOX__create__user_input__from_sdl2_events(user_input);
+        VOX__stop__profiler_scope(&profiler, VOX__pst__input);
         
         // check if should quit
         if (user_input.p_quit == VOX__bt__true) {
             goto VOX__label__quit_game;
         }
 
+        // run the ticks owed since the last frame
+        VOX__start__profiler_scope(&profiler, VOX__pst__simulate);
+        tick_count = VOX__start__loop_scheduler_frame(&loop_scheduler);
+        for (u64 i = 0; i < tick_count; i++) {
+            VOX__tick__simulation(&simulation, user_input);
+        }
+        alpha = VOX__calculate__loop_scheduler_alpha(&loop_scheduler);
+        VOX__stop__profiler_scope(&profiler, VOX__pst__simulate);
+
         // clear window
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // setup affects
-        affect += 0.01f;
+        // move camera to the drawn moment between the last two ticks
+        VOX__start__profiler_scope(&profiler, VOX__pst__camera);
+        camera = VOX__move__camera__to_simulation(camera, &simulation, alpha, VOX__calculate__player_camera_rotation_movement(user_input, 1.0f));
+        VOX__stop__profiler_scope(&profiler, VOX__pst__camera);
+
+        // stream chunks around camera
+        VOX__start__profiler_scope(&profiler, VOX__pst__world);
+        VOX__update__world(&world, camera, &gpu_arena);
+
+        // dig or place the block looked at (every edit this frame is remeshed once per chunk by the jobs below)
+        if (user_input.p_dig == VOX__bt__true || user_input.p_place == VOX__bt__true) {
+            ray_hit = VOX__cast__ray_from_camera(&world, camera, 8.0f);
+            if (ray_hit.p_hit == VOX__bt__true && user_input.p_dig == VOX__bt__true) {
+                VOX__write__block_ID_to_world(&world, ray_hit.p_block[0], ray_hit.p_block[1], ray_hit.p_block[2], VOX__bit__air);
+            } else if (ray_hit.p_hit == VOX__bt__true && (ray_hit.p_normal[0] | ray_hit.p_normal[1] | ray_hit.p_normal[2]) != 0) {
+                VOX__write__block_ID_to_world(&world, ray_hit.p_block[0] + ray_hit.p_normal[0], ray_hit.p_block[1] + ray_hit.p_normal[1], ray_hit.p_block[2] + ray_hit.p_normal[2], VOX__bit__stone);
+            }
+        }
+        VOX__submit__world_mesh_jobs(&world, job_system, block_dictionary, gpu_arena.p_vertex_format);
+        VOX__stop__profiler_scope(&profiler, VOX__pst__world);
 
-        // move camera
-        camera = VOX__move__camera(camera, VOX__calculate__player_position_movement(user_input, 0.5f), VOX__calculate__player_camera_rotation_movement(user_input, 1.0f));
+        // upload finished meshes
+        VOX__start__profiler_scope(&profiler, VOX__pst__upload);
+        VOX__send__completed_world_meshes_to_gpu_arena(&world, job_system, &gpu_arena);
+        VOX__advance__gpu_arena_uploads(&gpu_arena);
+        VOX__stop__profiler_scope(&profiler, VOX__pst__upload);
 
         // bind blocks
+        VOX__start__profiler_scope(&profiler, VOX__pst__draw);
+        VOX__start__profiler_gpu_timer(&profiler);
         VOX__draw__bind__specific_game_textures_texture(game_textures, VOX__gtt__block_faces);
         
-        // pass camera and texture data to gpu
-        glUniform1i(glGetUniformLocation(shaders_program.p_program_ID, "u_sampler_2D_array"), 0);
-        glUniformMatrix4fv(glGetUniformLocation(shaders_program.p_program_ID, "u_camera"), 1, GL_FALSE, (const GLfloat*)&camera.p_change);
+        // pass camera data to gpu (once for every program)
+        VOX__send__frame_uniforms(frame_uniform_buffer, camera, (f32)VOX__calculate__simulation_seconds(&simulation, alpha));
         
-        // display square
-        VOX__draw__drawable_object(pattern);
+        // display world
+        frustum = VOX__create__frustum__from_camera(camera);
+        VOX__draw__world(&world, &gpu_arena, &frustum);
         VOX__draw__unbind__specific_game_textures_texture(game_textures, VOX__gtt__block_faces);
+        VOX__stop__profiler_gpu_timer(&profiler);
+        VOX__stop__profiler_scope(&profiler, VOX__pst__draw);
 
         *error = VOX__try_create__error__other_opengl();
         if (VOX__check__error__has_error_occured(error) == VOX__bt__true) {
@@ -1503,22 +10256,64 @@ void VOX__play(VOX__error* error) {
         }
 
         // display new buffer
+        VOX__start__profiler_scope(&profiler, VOX__pst__swap);
         SDL_GL_SwapWindow(graphics.p_window_context);
+        VOX__stop__profiler_scope(&profiler, VOX__pst__swap);
+
+        // hold the frame for the frame cap
+        VOX__start__profiler_scope(&profiler, VOX__pst__wait);
+        VOX__wait__loop_scheduler_frame(&loop_scheduler);
+        VOX__stop__profiler_scope(&profiler, VOX__pst__wait);
+
+        // finish frame timing
+        VOX__record__profiler_gpu_arena_counters(&profiler, &gpu_arena);
+        VOX__record__profiler_loop_scheduler_counters(&profiler, &loop_scheduler);
+        VOX__stop__profiler_frame(&profiler);
+        if (profiler.p_frame_count % 60 == 0) {
+            VOX__send__profiler_summary_to_window_title(&profiler, graphics, &frame_allocator);
+        }
     }
 
     VOX__label__quit_game:
 
-    // clean up textures
+    // report timings, dumping traces when VOXELIZE_TRACE names an output path prefix
+    VOX__print__profiler(&profiler);
+    VOX__print__loop_scheduler(&loop_scheduler);
+    printf("\tvsync: %s\n", VOX__read__vsync_mode_name(vsync_mode));
+    trace_path = getenv("VOXELIZE_TRACE");
+    if (trace_path != 0) {
+        trace_error = VOX__create__error__no_error();
+
+        snprintf(trace_file_path, sizeof(trace_file_path), "%s.csv", trace_path);
+        VOX__write__profiler_csv(&trace_error, &profiler, trace_file_path);
+        snprintf(trace_file_path, sizeof(trace_file_path), "%s.json", trace_path);
+        VOX__write__profiler_chrome_trace(&trace_error, &profiler, trace_file_path);
+
+        if (VOX__check__error__has_error_occured(&trace_error) == VOX__bt__true) {
+            VOX__print__error(trace_error);
+        }
+    }
+    VOX__close__profiler(profiler);
+
+    // clean up textures & frame data
     VOX__close__game_textures(game_textures);
+    VOX__close__frame_uniform_buffer(frame_uniform_buffer);
 
-    // clean up drawable objects
-    VOX__destroy__object_data(pattern.p_object_data);
-    VOX__close__drawable_object(pattern);
+    // clean up world
+    VOX__close__job_system(job_system);
+    VOX__destroy__world(world, &gpu_arena);
+    VOX__close__chunk_io(chunk_io);
+    VOX__close__gpu_arena(gpu_arena);
+    VOX__destroy__block_dictionary(block_dictionary);
+    VOX__close__allocator(&frame_allocator);
+    VOX__close__global_allocators();
 
     VOX__label__quit_game__shader_failure:
 
     // clean up opengl
-    VOX__close__shaders(shaders_program);
+    VOX__close__shaders(shaders_programs[VOX__vft__float]);
+    VOX__close__shaders(shaders_programs[VOX__vft__packed]);
+    VOX__close__shader_cache(shader_cache);
     VOX__close__graphics__old_window(graphics);
     VOX__destroy__window_configuration(configuration);
 
@@ -1528,4 +10323,84 @@ void VOX__play(VOX__error* error) {
     return;
 }
 
+/* Headless Loop - Simulation & World Streaming Without A Window */
+// real_time paces ticks to the wall clock (like a server), otherwise ticks run back to back as fast as they can
+void VOX__play__headless(u64 ticks_per_second, u64 tick_count, VOX__bt real_time) {
+    VOX__loop_scheduler loop_scheduler;
+    VOX__simulation simulation;
+    VOX__user_input user_input;
+    VOX__camera camera;
+    VOX__world world;
+    VOX__chunk_io* chunk_io;
+    VOX__profiler profiler;
+    u64 frame_tick_count;
+    u64 start_time;
+    f64 seconds;
+
+    // setup allocators
+    VOX__open__global_allocators();
+
+    // setup world (VOXELIZE_WORLD names the region directory like in game)
+    camera = VOX__create__camera();
+    chunk_io = VOX__open__chunk_io(getenv("VOXELIZE_WORLD"), 0);
+    world = VOX__create__world(8, 2, 2, 8, 0, chunk_io);
+
+    // setup simulation, one tick per frame so every tick streams the world
+    ticks_per_second = VOX__clamp__ticks_per_second(ticks_per_second);
+    simulation = VOX__create__simulation(VOX__create__3D_position(0.0f, 0.0f, 0.0f), ticks_per_second);
+    user_input = VOX__create_null__user_input();
+    user_input.p_w = VOX__bt__true;
+    loop_scheduler = VOX__create__loop_scheduler(ticks_per_second, (real_time == VOX__bt__true) ? ticks_per_second : 0, VOX__dt__simulation_maximum_ticks_per_frame);
+    profiler = VOX__open__profiler(VOX__bt__false);
+
+    // run ticks
+    start_time = VOX__calculate__nanoseconds();
+    while (simulation.p_tick_count < tick_count) {
+        VOX__start__profiler_frame(&profiler);
+
+        // ticks owed, the virtual clock owes exactly one
+        VOX__start__profiler_scope(&profiler, VOX__pst__simulate);
+        if (real_time == VOX__bt__true) {
+            frame_tick_count = VOX__start__loop_scheduler_frame(&loop_scheduler);
+        } else {
+            frame_tick_count = VOX__advance__loop_scheduler(&loop_scheduler, loop_scheduler.p_tick_length);
+        }
+        for (u64 i = 0; i < frame_tick_count; i++) {
+            // fly forward, weaving side to side once a second
+            user_input.p_a = (simulation.p_tick_count / ticks_per_second) % 2 == 0;
+            user_input.p_d = (simulation.p_tick_count / ticks_per_second) % 2 == 1;
+            VOX__tick__simulation(&simulation, user_input);
+        }
+        VOX__stop__profiler_scope(&profiler, VOX__pst__simulate);
+
+        // stream chunks around the latest tick
+        VOX__start__profiler_scope(&profiler, VOX__pst__world);
+        camera = VOX__move__camera__to_simulation(camera, &simulation, 1.0f, VOX__create__3D_position(0.0f, 0.0f, 0.0f));
+        VOX__update__world(&world, camera, 0);
+        VOX__stop__profiler_scope(&profiler, VOX__pst__world);
+
+        // hold for the tick rate
+        VOX__start__profiler_scope(&profiler, VOX__pst__wait);
+        VOX__wait__loop_scheduler_frame(&loop_scheduler);
+        VOX__stop__profiler_scope(&profiler, VOX__pst__wait);
+
+        VOX__record__profiler_loop_scheduler_counters(&profiler, &loop_scheduler);
+        VOX__stop__profiler_frame(&profiler);
+    }
+    seconds = (f64)(VOX__calculate__nanoseconds() - start_time) / 1000000000.0;
+
+    // report
+    printf("Voxelize Headless (%s): %lu ticks in %.3f s (%.1f ticks/s), %lu chunks loaded\n", (real_time == VOX__bt__true) ? "real time" : "as fast as possible", simulation.p_tick_count, seconds, (f64)simulation.p_tick_count / seconds, world.p_total_loads);
+    VOX__print__profiler(&profiler);
+    VOX__print__loop_scheduler(&loop_scheduler);
+
+    // clean up
+    VOX__close__profiler(profiler);
+    VOX__destroy__world(world, 0);
+    VOX__close__chunk_io(chunk_io);
+    VOX__close__global_allocators();
+
+    return;
+}
+
 #endif